@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+// Бенчмарки на примерах ответов из документации (Tests/Samples.h), без окна и игры
+// BENCHMARK(Name) регистрирует функцию; запуск: Bench [подстрока имени], отчёт - в stdout
+namespace Bench {
+    using Function = void (*)();
+
+    struct Registration {
+        Registration(const char* name, Function function);
+    };
+
+    // Лучшее время одного вызова body из runs (перед ними - один прогрев), наносекунды
+    template <typename Body>
+    uint64_t BestNs(int runs, Body&& body) {
+        body();
+        uint64_t best = UINT64_MAX;
+        for (int run = 0; run < runs; run++) {
+            auto start = std::chrono::steady_clock::now();
+            body();
+            uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            if (ns < best) best = ns;
+        }
+        return best;
+    }
+
+    inline double MBps(uint64_t bytes, uint64_t ns) { return ns > 0 ? (double)bytes * 1000.0 / (double)ns : 0.0; }
+    inline double Ms(uint64_t ns) { return (double)ns / 1000000.0; }
+
+    // Корневой массив из элементов примера (другой корень - один элемент), повторяемых по кругу до minSize байт
+    std::string RepeatElements(std::string_view sample, size_t minSize);
+
+    // Строка отчёта (printf-формат, перевод строки добавляется)
+    void Report(const char* format, ...);
+
+    // Результат, который компилятор не может выбросить вместе с замеряемой работой
+    void Consume(double value);
+}
+
+#define BENCHMARK(name) \
+    static void name(); \
+    static Bench::Registration name##Registration(#name, name); \
+    static void name()
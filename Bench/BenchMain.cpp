@@ -0,0 +1,66 @@
+#include "Bench.h"
+#include "JsonStream.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace Bench {
+    namespace {
+        struct Entry {
+            const char* name;
+            Function function;
+        };
+
+        std::vector<Entry>& Registry() {
+            static std::vector<Entry> entries;
+            return entries;
+        }
+
+        volatile double g_sink = 0.0;
+    }
+
+    Registration::Registration(const char* name, Function function) {
+        Registry().push_back(Entry{ name, function });
+    }
+
+    std::string RepeatElements(std::string_view sample, size_t minSize) {
+        std::vector<std::string> elements;
+        Json::StreamParser splitter;
+        splitter.SetElementCallback([&elements](std::string_view element) { elements.emplace_back(element); });
+        splitter.Feed(sample.data(), sample.size());
+        if (!splitter.Finish() || elements.empty()) return std::string();
+
+        std::string out = "[";
+        out.reserve(minSize + sample.size() + 2);
+        for (size_t i = 0; out.size() < minSize; i++) {
+            if (i > 0) out += ",\n";
+            out += elements[i % elements.size()];
+        }
+        out += "]";
+        return out;
+    }
+
+    void Report(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        std::vprintf(format, args);
+        va_end(args);
+        std::printf("\n");
+        std::fflush(stdout);
+    }
+
+    void Consume(double value) {
+        g_sink = g_sink + value;
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    for (const Bench::Entry& entry : Bench::Registry()) {
+        if (filter && !std::strstr(entry.name, filter)) continue;
+        std::printf("== %s\n", entry.name);
+        entry.function();
+    }
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include "Bench.h"
+#include "Samples.h"
+#include "JsonDiff.h"
+
+namespace {
+    constexpr size_t INPUT_SIZE = 1024 * 1024;
+    constexpr int RUNS = 10;
+    constexpr size_t CHANGE_EVERY = 4; // Меняется каждое четвёртое число (координаты, скорость, таймеры)
+
+    // Следующий снимок: последняя цифра каждого CHANGE_EVERY-го числа вне строк сдвигается на единицу
+    std::string NextSnapshot(const std::string& json) {
+        std::string next = json;
+        bool inString = false;
+        size_t numbers = 0;
+        for (size_t i = 0; i < next.size(); i++) {
+            char c = next[i];
+            if (inString) {
+                if (c == '\\') i++;
+                else if (c == '"') inString = false;
+                continue;
+            }
+            if (c == '"') {
+                inString = true;
+                continue;
+            }
+            bool digit = c >= '0' && c <= '9';
+            bool last = digit && (i + 1 == next.size() || next[i + 1] < '0' || next[i + 1] > '9');
+            if (!last) continue;
+            if (numbers++ % CHANGE_EVERY == 0) next[i] = c == '9' ? '8' : (char)(c + 1);
+        }
+        return next;
+    }
+}
+
+// Разница соседних снимков state/mission/map_obj: время Diff (без разбора) и размер патча JSON Patch относительно ответа
+BENCHMARK(JsonDiff) {
+    Bench::Report("%-16s %10s %8s %8s", "sample", "diff", "changes", "patch");
+    for (const char* url : { "/state", "/mission.json", "/map_obj.json" }) {
+        std::string before = Bench::RepeatElements(Samples::Find(url)->json, INPUT_SIZE);
+        std::string after = NextSnapshot(before);
+        Json::Document previous;
+        Json::Document current;
+        if (!previous.Parse(before) || !current.Parse(after)) continue;
+
+        Json::Patch patch;
+        uint64_t diffNs = Bench::BestNs(RUNS, [&] { Json::Diff(previous.Root(), current.Root(), patch); });
+        std::string text = patch.ToString();
+
+        Bench::Report("%-16s %7.3f ms %8zu %7.2f%%", url,
+            Bench::Ms(diffNs),
+            patch.Size(),
+            (double)text.size() * 100.0 / (double)after.size());
+    }
+}
@@ -0,0 +1,36 @@
+#include "Bench.h"
+#include "Samples.h"
+#include "JsonIndex.h"
+#include "JsonParser.h"
+
+namespace {
+    constexpr size_t INPUT_SIZE = 8 * 1024 * 1024;
+    constexpr int RUNS = 10;
+}
+
+// Первый проход (векторный и скалярный) и весь разбор в Document на примерах, размноженных до 8 МБ
+BENCHMARK(JsonIndexThroughput) {
+    Bench::Report("stage 1: %s", Json::StructuralIndex::GetImplementation());
+    Bench::Report("%-16s %6s %12s %12s %12s %12s", "sample", "MB", "index", "scalar", "parse", "borrowed");
+    for (const char* url : { "/map_obj.json", "/state", "/indicators", "/gamechat" }) {
+        const Samples::Sample* sample = Samples::Find(url);
+        std::string input = Bench::RepeatElements(sample->json, INPUT_SIZE);
+
+        Json::StructuralIndex index;
+        uint64_t indexNs = Bench::BestNs(RUNS, [&] { index.Build(input.data(), input.size()); });
+        uint64_t scalarNs = Bench::BestNs(RUNS, [&] { index.BuildScalar(input.data(), input.size()); });
+        Bench::Consume((double)index.Count());
+
+        Json::Document document;
+        uint64_t parseNs = Bench::BestNs(RUNS, [&] { document.Parse(input); });
+        uint64_t borrowedNs = Bench::BestNs(RUNS, [&] { document.ParseBorrowed(input); });
+        Bench::Consume((double)document.Root().size());
+
+        Bench::Report("%-16s %6.1f %7.0f MB/s %7.0f MB/s %7.0f MB/s %7.0f MB/s", url,
+            input.size() / (1024.0 * 1024.0),
+            Bench::MBps(input.size(), indexNs),
+            Bench::MBps(input.size(), scalarNs),
+            Bench::MBps(input.size(), parseNs),
+            Bench::MBps(input.size(), borrowedNs));
+    }
+}
@@ -0,0 +1,55 @@
+#include "Bench.h"
+#include "Samples.h"
+#include "JsonParser.h"
+
+namespace {
+    constexpr int RUNS = 20;
+
+    // Куча строки: короткие строки живут внутри std::string (SSO)
+    size_t StringHeapBytes(const std::string& text) {
+        return text.capacity() > std::string().capacity() ? text.capacity() + 1 : 0;
+    }
+
+    // Оценка памяти дерева Value: узел + блок управления make_shared, вектор указателей, узлы std::map
+    size_t EstimateValueBytes(const Json::Value& value) {
+        constexpr size_t SHARED_CONTROL_BYTES = 16;
+        constexpr size_t MAP_NODE_BYTES = 32; // Цвет, родитель, два потомка
+        size_t bytes = sizeof(Json::Value) + SHARED_CONTROL_BYTES + StringHeapBytes(value.stringValue);
+        bytes += value.arrayValue.capacity() * sizeof(std::shared_ptr<Json::Value>);
+        for (const auto& item : value.arrayValue) {
+            bytes += EstimateValueBytes(*item);
+        }
+        for (const auto& pair : value.objectValue) {
+            bytes += MAP_NODE_BYTES + sizeof(pair) + StringHeapBytes(pair.first) + EstimateValueBytes(*pair.second);
+        }
+        return bytes;
+    }
+
+    uint64_t CountNodes(const Json::Node& node) {
+        uint64_t count = 1;
+        for (const Json::Node& item : node.items()) count += CountNodes(item);
+        for (const Json::Member& member : node.members()) count += CountNodes(member.value);
+        return count;
+    }
+}
+
+// Раскладки на ответах из документации как есть: Document (компактные узлы в арене) против дерева Value,
+// время разбора и память на ответ
+BENCHMARK(JsonLayout) {
+    Bench::Report("%-16s %7s %9s %21s %21s", "sample", "nodes", "input", "Document", "Value");
+    for (const Samples::Sample& sample : Samples::ALL) {
+        std::string json(sample.json);
+        Json::Document document;
+        uint64_t compactNs = Bench::BestNs(RUNS, [&] { Bench::Consume(document.Parse(json) ? 1.0 : 0.0); });
+        std::shared_ptr<Json::Value> legacy;
+        uint64_t legacyNs = Bench::BestNs(RUNS, [&] { legacy = Json::Parse(json); });
+
+        Bench::Report("%-16s %7llu %6.1f KB %6.1f KB %7.3f ms %6.1f KB %7.3f ms", sample.url,
+            (unsigned long long)CountNodes(document.Root()),
+            json.size() / 1024.0,
+            (document.GetArena().GetStats().used + sizeof(Json::Node)) / 1024.0,
+            Bench::Ms(compactNs),
+            EstimateValueBytes(*legacy) / 1024.0,
+            Bench::Ms(legacyNs));
+    }
+}
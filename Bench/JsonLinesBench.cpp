@@ -0,0 +1,100 @@
+#include "Bench.h"
+#include "Samples.h"
+#include "JsonLines.h"
+#include "JsonStream.h"
+#include "JsonWriter.h"
+#include "MappedFile.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace {
+    constexpr uint64_t FILE_SIZE = 128 * 1024 * 1024;
+    constexpr int RUNS = 3;
+
+    // Объекты map_obj из примера, по компактной строке на объект, по кругу до targetBytes
+    bool WriteSyntheticLines(const std::string& path, uint64_t targetBytes) {
+        std::vector<std::string> lines;
+        Json::StreamParser splitter;
+        splitter.SetElementCallback([&lines](std::string_view element) {
+            Json::Document document;
+            if (!document.Parse(element.data(), element.size())) return;
+            std::string& line = lines.emplace_back();
+            Json::StringSink sink(line);
+            Json::Writer writer(sink);
+            writer.Write(document.Root());
+            writer.Flush();
+            line += '\n';
+        });
+        std::string_view sample = Samples::Find("/map_obj.json")->json;
+        if (!splitter.Feed(sample.data(), sample.size()) || !splitter.Finish() || lines.empty()) return false;
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+        for (uint64_t written = 0, i = 0; written < targetBytes; i++) {
+            const std::string& line = lines[i % lines.size()];
+            file.write(line.data(), (std::streamsize)line.size());
+            written += line.size();
+        }
+        return file.good();
+    }
+
+    // Строки буфера по '\n', пустые пропускаются; число разобранных строк
+    uint64_t ParseEachLine(Json::Document& document, const char* data, size_t size) {
+        uint64_t parsed = 0;
+        const char* cursor = data;
+        const char* end = data + size;
+        while (cursor < end) {
+            const char* newline = (const char*)std::memchr(cursor, '\n', (size_t)(end - cursor));
+            if (!newline) newline = end;
+            if (newline > cursor && document.ParseBorrowed(cursor, (size_t)(newline - cursor))) parsed++;
+            cursor = newline + (newline < end ? 1 : 0);
+        }
+        return parsed;
+    }
+}
+
+// Чтение записи сессии (NDJSON): старый путь (ifstream -> stringstream -> копия в std::string, затем разбор строк)
+// против разбора на месте всего отображённого файла и ParseLines окнами; файл во временной папке
+BENCHMARK(JsonLinesFile) {
+    std::error_code error;
+    std::filesystem::path path = std::filesystem::temp_directory_path(error) / "wt_map_lines_bench.jsonl";
+    std::string pathText = path.string();
+    if (error || !WriteSyntheticLines(pathText, FILE_SIZE)) {
+        Bench::Report("failed to write %s", pathText.c_str());
+        return;
+    }
+    uint64_t fileBytes = (uint64_t)std::filesystem::file_size(path, error);
+    Json::Document document;
+
+    uint64_t legacyLines = 0;
+    uint64_t legacyHeapBytes = 0;
+    uint64_t legacyNs = Bench::BestNs(RUNS, [&] {
+        std::ifstream file(pathText, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        std::string content = buffer.str();
+        legacyHeapBytes = (uint64_t)content.size() * 2; // Буфер stringstream и копия одновременно
+        legacyLines = ParseEachLine(document, content.data(), content.size());
+    });
+
+    uint64_t mappedLines = 0;
+    uint64_t mappedNs = Bench::BestNs(RUNS, [&] {
+        MappedFile file;
+        mappedLines = file.Open(pathText) && file.Map(0, (size_t)file.Size()) ? ParseEachLine(document, file.Data(), file.MappedSize()) : 0;
+    });
+
+    Json::LinesResult lines;
+    uint64_t linesNs = Bench::BestNs(RUNS, [&] {
+        lines = Json::ParseLines(pathText, [](const Json::Document&, uint64_t, bool) { return true; });
+    });
+    std::filesystem::remove(path, error);
+
+    bool success = lines.success && lines.failed == 0 && legacyLines == lines.lines && mappedLines == lines.lines;
+    Bench::Report("file %.0f MB, %llu lines%s", fileBytes / (1024.0 * 1024.0), (unsigned long long)lines.lines, success ? "" : " (line counts differ)");
+    Bench::Report("%-12s %7.0f MB/s  heap %.0f MB", "stringstream", Bench::MBps(fileBytes, legacyNs), legacyHeapBytes / (1024.0 * 1024.0));
+    Bench::Report("%-12s %7.0f MB/s", "mapped", Bench::MBps(fileBytes, mappedNs));
+    Bench::Report("%-12s %7.0f MB/s  window %.0f MB", "ParseLines", Bench::MBps(fileBytes, linesNs), lines.maxWindowBytes / (1024.0 * 1024.0));
+}
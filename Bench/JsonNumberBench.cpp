@@ -0,0 +1,61 @@
+#include "Bench.h"
+#include "Samples.h"
+#include "JsonParser.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr int RUNS = 10;
+
+    // Тексты чисел примера: токены индекса, начинающиеся с цифры или '-' (те же тексты, что видит разбор)
+    std::vector<std::pair<uint32_t, uint32_t>> CollectNumbers(const std::string& json) {
+        Json::Document document;
+        std::vector<std::pair<uint32_t, uint32_t>> numbers;
+        if (!document.Parse(json)) return numbers;
+        const Json::StructuralIndex& index = document.GetIndex();
+        for (size_t i = 0; i < index.Count(); i++) {
+            uint32_t begin = index.Positions()[i];
+            char c = json[begin];
+            if (c != '-' && (c < '0' || c > '9')) continue;
+            uint32_t end = i + 1 < index.Count() ? index.Positions()[i + 1] : (uint32_t)json.size();
+            while (end > begin && (json[end - 1] == ' ' || json[end - 1] == '\t' || json[end - 1] == '\n' || json[end - 1] == '\r')) end--;
+            numbers.emplace_back(begin, end);
+        }
+        return numbers;
+    }
+}
+
+// Разбор чисел: ParseNumber против прежнего пути (std::string + std::stod в try/catch), нс на число
+BENCHMARK(JsonNumbers) {
+    Bench::Report("%-16s %8s %12s %12s", "sample", "numbers", "ParseNumber", "stod");
+    for (const Samples::Sample& sample : Samples::ALL) {
+        std::string json = Bench::RepeatElements(sample.json, 1024 * 1024);
+        std::vector<std::pair<uint32_t, uint32_t>> numbers = CollectNumbers(json);
+        if (numbers.empty()) continue;
+
+        uint64_t parseNs = Bench::BestNs(RUNS, [&] {
+            double sum = 0.0;
+            for (const auto& range : numbers) {
+                double value = 0.0;
+                Json::ParseNumber(json.data() + range.first, json.data() + range.second, value);
+                sum += value;
+            }
+            Bench::Consume(sum);
+        });
+        uint64_t stodNs = Bench::BestNs(RUNS, [&] {
+            double sum = 0.0;
+            for (const auto& range : numbers) {
+                try {
+                    sum += std::stod(json.substr(range.first, range.second - range.first));
+                } catch (...) {
+                }
+            }
+            Bench::Consume(sum);
+        });
+
+        Bench::Report("%-16s %8zu %9.1f ns %9.1f ns", sample.url, numbers.size(),
+            (double)parseNs / (double)numbers.size(),
+            (double)stodNs / (double)numbers.size());
+    }
+}
@@ -0,0 +1,29 @@
+#include "Bench.h"
+#include "Samples.h"
+#include "JsonReader.h"
+
+namespace {
+    constexpr size_t INPUT_SIZE = 4 * 1024 * 1024;
+    constexpr int RUNS = 10;
+}
+
+// Обход событиями Reader (пустой обработчик - стоимость самого чтения для декодера на Reader)
+// против разбора в Document и дерева Value на тех же входах
+BENCHMARK(JsonReaderWalk) {
+    Bench::Report("%-16s %10s %10s %10s", "sample", "walk", "document", "value");
+    for (const Samples::Sample& sample : Samples::ALL) {
+        std::string input = Bench::RepeatElements(sample.json, INPUT_SIZE);
+
+        Json::Reader reader;
+        Json::Handler handler;
+        uint64_t walkNs = Bench::BestNs(RUNS, [&] {
+            reader.Reset(input);
+            Bench::Consume(reader.Walk(handler) ? 1.0 : 0.0);
+        });
+        Json::Document document;
+        uint64_t documentNs = Bench::BestNs(RUNS, [&] { Bench::Consume(document.Parse(input) ? 1.0 : 0.0); });
+        uint64_t valueNs = Bench::BestNs(RUNS, [&] { Bench::Consume((double)Json::Parse(input)->arrayValue.size()); });
+
+        Bench::Report("%-16s %7.2f ms %7.2f ms %7.2f ms", sample.url, Bench::Ms(walkNs), Bench::Ms(documentNs), Bench::Ms(valueNs));
+    }
+}
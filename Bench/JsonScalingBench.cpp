@@ -0,0 +1,30 @@
+#include "Bench.h"
+#include "Samples.h"
+#include "JsonParser.h"
+#include "WorkerPool.h"
+
+namespace {
+    constexpr size_t INPUT_SIZE = 8 * 1024 * 1024;
+    constexpr int RUNS = 5;
+    constexpr size_t THREADS[] = { 1, 2, 4, 8 };
+}
+
+// Масштабирование ParseParallel по числу потоков на синтетическом map_obj.json
+// (элементы примера, размноженные до 8 МБ); без частей - обычный Parse для сравнения
+BENCHMARK(JsonParseScaling) {
+    const Samples::Sample* sample = Samples::Find("/map_obj.json");
+    std::string input = Bench::RepeatElements(sample->json, INPUT_SIZE);
+    Bench::Report("input %.1f MB", input.size() / (1024.0 * 1024.0));
+
+    Json::Document document;
+    uint64_t serialNs = Bench::BestNs(RUNS, [&] { Bench::Consume(document.Parse(input) ? 1.0 : 0.0); });
+    Bench::Report("%-9s %7.0f MB/s", "Parse", Bench::MBps(input.size(), serialNs));
+
+    for (size_t threads : THREADS) {
+        WorkerPool pool(threads);
+        // Прогрев арен частей - в первом вызове BestNs
+        uint64_t ns = Bench::BestNs(RUNS, [&] { Bench::Consume(document.ParseParallel(input, pool) ? 1.0 : 0.0); });
+        Bench::Report("%zu %-7s %7.0f MB/s %5.2fx", threads, threads == 1 ? "thread" : "threads",
+            Bench::MBps(input.size(), ns), (double)serialNs / (double)ns);
+    }
+}
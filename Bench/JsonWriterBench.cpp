@@ -0,0 +1,39 @@
+#include "Bench.h"
+#include "Samples.h"
+#include "JsonWriter.h"
+
+namespace {
+    constexpr size_t INPUT_SIZE = 4 * 1024 * 1024;
+    constexpr int RUNS = 10;
+
+    uint64_t WriteNs(const Json::Document& document, Json::Writer::Style style, std::string& text) {
+        return Bench::BestNs(RUNS, [&] {
+            text.clear(); // Ёмкость сохраняется между прогонами, как у буфера потока
+            Json::StringSink sink(text);
+            Json::Writer writer(sink, style);
+            writer.Write(document.Root());
+            writer.Flush();
+        });
+    }
+}
+
+// Запись разобранного документа обратно в текст (Writer, компактно и с отступами)
+BENCHMARK(JsonWriter) {
+    Bench::Report("%-16s %12s %12s %8s", "sample", "compact", "pretty", "ratio");
+    for (const Samples::Sample& sample : Samples::ALL) {
+        std::string input = Bench::RepeatElements(sample.json, INPUT_SIZE);
+        Json::Document document;
+        if (!document.Parse(input)) continue;
+
+        std::string text;
+        uint64_t compactNs = WriteNs(document, Json::Writer::Style::Compact, text);
+        size_t compactBytes = text.size();
+        uint64_t prettyNs = WriteNs(document, Json::Writer::Style::Pretty, text);
+        size_t prettyBytes = text.size();
+
+        Bench::Report("%-16s %7.0f MB/s %7.0f MB/s %7.2f", sample.url,
+            Bench::MBps(compactBytes, compactNs),
+            Bench::MBps(prettyBytes, prettyNs),
+            (double)compactBytes / (double)input.size());
+    }
+}
@@ -0,0 +1,94 @@
+#include "Bench.h"
+#include "Samples.h"
+#include "Schema.h"
+#include <vector>
+
+namespace {
+    constexpr int RUNS = 10;
+    constexpr int ITERATIONS = 1000; // Разборов одного ответа в замере (ответы - единицы КБ)
+
+    struct Result {
+        uint64_t decodeNs = 0;  // Reset + Read/ReadList
+        uint64_t lookupNs = 0;  // ParseBorrowed + Lookup/LookupList
+        bool success = true;    // Оба пути прочитали ответ
+    };
+
+    template <typename Body>
+    uint64_t PerResponseNs(Body&& body) {
+        return Bench::BestNs(RUNS, [&] {
+            for (int i = 0; i < ITERATIONS; i++) body();
+        }) / ITERATIONS;
+    }
+
+    // Оба пути в одни и те же структуры (ёмкость векторов сохраняется между разборами)
+    template <typename T>
+    Result Measure(const std::string& json) {
+        Json::Reader reader;
+        Json::Document document;
+        T decoded;
+        T looked;
+        Result result;
+        result.decodeNs = PerResponseNs([&] {
+            reader.Reset(json);
+            result.success = Schema::Read(reader, decoded) && reader.Finish() && result.success;
+        });
+        result.lookupNs = PerResponseNs([&] {
+            result.success = document.ParseBorrowed(json) && result.success;
+            Schema::Lookup(document.RootView(), looked);
+        });
+        return result;
+    }
+
+    template <typename T>
+    Result MeasureList(const std::string& json) {
+        Json::Reader reader;
+        Json::Document document;
+        std::vector<T> decoded;
+        std::vector<T> looked;
+        Result result;
+        result.decodeNs = PerResponseNs([&] {
+            reader.Reset(json);
+            result.success = Schema::ReadList(reader, decoded) && reader.Finish() && result.success;
+        });
+        result.lookupNs = PerResponseNs([&] {
+            result.success = document.ParseBorrowed(json) && result.success;
+            Schema::LookupList(document.RootView(), looked);
+        });
+        return result;
+    }
+
+}
+
+// Сгенерированные декодеры (Schema::Read, один проход Reader) против тех же полей поиском по ключам
+// в Document (ParseBorrowed + Schema::Lookup)
+BENCHMARK(SchemaDecode) {
+    Bench::Report("%-16s %10s %10s", "sample", "decode", "lookup");
+    for (const Samples::Sample& sample : Samples::ALL) {
+        std::string json(sample.json);
+        std::string_view url = sample.url;
+        Result result;
+        if (url == "/gamechat") {
+            result = MeasureList<Schema::GameChatMessage>(json);
+        } else if (url == "/hudmsg") {
+            result = Measure<Schema::Hudmsg>(json);
+        } else if (url == "/indicators") {
+            result = Measure<Schema::Indicators>(json);
+        } else if (url == "/state") {
+            result = Measure<Schema::State>(json);
+        } else if (url == "/mission.json") {
+            result = Measure<Schema::Mission>(json);
+        } else if (url == "/map_info.json") {
+            result = Measure<Schema::MapInfo>(json);
+        } else if (url == "/map_obj.json") {
+            result = MeasureList<Schema::MapObject>(json);
+        } else {
+            continue;
+        }
+
+        Bench::Report("%-16s %7.2f us %7.2f us %5.0f MB/s%s", sample.url,
+            result.decodeNs / 1000.0,
+            result.lookupNs / 1000.0,
+            Bench::MBps(json.size(), result.decodeNs),
+            result.success ? "" : " (failed)");
+    }
+}
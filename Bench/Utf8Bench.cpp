@@ -0,0 +1,39 @@
+#include "Bench.h"
+#include "Samples.h"
+#include "Utf8.h"
+#include <cstring>
+
+namespace {
+    constexpr size_t INPUT_SIZE = 8 * 1024 * 1024;
+    constexpr int RUNS = 10;
+
+    // Многоязычный текст чата: кириллица, латиница с диакритикой, CJK и 4-байтные символы
+    const char MULTILINGUAL[] =
+        "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82, \xD0\xBC\xD0\xB8\xD1\x80! "
+        "Fran\xC3\xA7" "ais \xC3\xA9t\xC3\xA9 "
+        "\xE6\x88\xA6\xE8\xBB\x8A "
+        "\xF0\x9F\x9A\x80 ";
+
+    void Measure(const char* name, const std::string& input) {
+        std::string copy(input.size(), '\0');
+        uint64_t scanNs = Bench::BestNs(RUNS, [&] { Bench::Consume(Utf8::Scan(input.data(), input.size()).valid ? 1.0 : 0.0); });
+        uint64_t copyNs = Bench::BestNs(RUNS, [&] {
+            std::memcpy(copy.data(), input.data(), input.size());
+            Bench::Consume((double)copy[copy.size() / 2]);
+        });
+        Bench::Report("%-16s %7.0f MB/s %7.0f MB/s", name, Bench::MBps(input.size(), scanNs), Bench::MBps(input.size(), copyNs));
+    }
+}
+
+// Проверка UTF-8 ответов целиком (Utf8::Scan) против memcpy тех же байт (ориентир скорости)
+BENCHMARK(Utf8Scan) {
+    Bench::Report("implementation: %s", Utf8::GetImplementation());
+    Bench::Report("%-16s %12s %12s", "input", "scan", "memcpy");
+    for (const Samples::Sample& sample : Samples::ALL) {
+        Measure(sample.url, Bench::RepeatElements(sample.json, INPUT_SIZE));
+    }
+    std::string multilingual;
+    multilingual.reserve(INPUT_SIZE + sizeof(MULTILINGUAL));
+    while (multilingual.size() < INPUT_SIZE) multilingual += MULTILINGUAL;
+    Measure("multilingual", multilingual);
+}
@@ -1,458 +1,871 @@
 #include "ApiFetcher.h"
-#include <windows.h>
-#include <wininet.h>
 #include <sstream>
 #include <thread>
+#include <algorithm>
+#include <cmath>
 
-#pragma comment(lib, "wininet.lib")
+namespace {
+    struct EndpointConfig {
+        const char* name;
+        int priority; // 0 - наивысший
+    };
 
-ApiFetcher::ApiFetcher() 
-    : m_running(false)
-    , m_lastChatId(0)
-    , m_lastEventId(0)
+    // Приоритеты опроса (порядок совпадает с ApiEndpoint)
+    static const EndpointConfig g_endpointConfigs[(size_t)ApiEndpoint::Count] = {
+        { "gamechat", 2 },
+        { "hudmsg", 2 },
+        { "indicators", 0 },
+        { "state", 0 },
+        { "mission.json", 1 },
+        { "map_info.json", 1 },
+        { "map_obj.json", 1 }
+    };
+
+    // Интервалы опроса по профилям (мс), дедлайн периода - начало следующего
+    // gamechat, hudmsg, indicators, state, mission, map_info, map_obj
+    static const int g_profileIntervals[(size_t)PollProfile::NotRunning][(size_t)ApiEndpoint::Count] = {
+        { 5000, 5000, 500, 2000, 5000, 1000, 5000 }, // Hangar: indicators и map_info ловят начало боя
+        { 2000, 2000, 150, 150, 1500, 2000, 750 },   // BattleAir: полётные данные 100-200ms, карта 500-1000ms
+        { 2000, 2000, 200, 1000, 1500, 2000, 500 },  // BattleGround: state только для самолётов, тактическая карта чаще
+        { 5000, 5000, 1000, 2000, 5000, 5000, 3000 } // Minimized
+    };
+}
+
+ApiFetcher::ApiFetcher()
+    : m_nextBatchId(0)
+    , m_onlineEpoch(0)
+    , m_probeTimer(0)
+    , m_scheduleTimer(0)
+    , m_requestBudget(DEFAULT_REQUEST_BUDGET)
+    , m_budgetTokens(0.0)
+    , m_profile(PollProfile::NotRunning)
+    , m_profileSwitches(0)
+    , m_windowVisible(true)
+    , m_indicatorsValid(true) // До первых ответов считаем, что идёт бой (опрос на полной скорости)
+    , m_mapHudType(0)
+    , m_pipelining(true)
+    , m_batchCount(0)
+    , m_batchRequests(0)
+    , m_lastBatchSize(0)
+    , m_maxBatchSize(0)
+    , m_lastBatchUs(0)
+    , m_totalBatchUs(0)
+    , m_running(false)
 {
-    #ifdef _WIN32
-    // Инициализируем connection pool (переиспользуемое соединение)
-    m_hInternet = InternetOpenA("WarThunderAdvanced/1.0", INTERNET_OPEN_TYPE_DIRECT, NULL, NULL, 0);
-    if (m_hInternet) {
-        // Устанавливаем таймауты для connection pool
-        DWORD timeout = 5000; // 5 секунд
-        InternetSetOptionA(m_hInternet, INTERNET_OPTION_CONNECT_TIMEOUT, &timeout, sizeof(timeout));
-        InternetSetOptionA(m_hInternet, INTERNET_OPTION_RECEIVE_TIMEOUT, &timeout, sizeof(timeout));
-        InternetSetOptionA(m_hInternet, INTERNET_OPTION_SEND_TIMEOUT, &timeout, sizeof(timeout));
+    // Пул постоянных соединений к localhost:8111, тела ответов читаются в буферы из общего пула
+    m_bufferPool = BufferPool::Create();
+    m_httpPool = std::make_unique<Http::ConnectionPool>(API_HOST, API_PORT, HTTP_POOL_SIZE, m_bufferPool);
+
+    for (size_t i = 0; i < (size_t)ApiEndpoint::Count; i++) {
+        m_endpoints[i].name = g_endpointConfigs[i].name;
+        m_endpoints[i].priority = g_endpointConfigs[i].priority;
+        ApplyInterval((ApiEndpoint)i);
     }
-    #endif
 }
 
 ApiFetcher::~ApiFetcher() {
     Stop();
-    if (m_chatWorkerThread.joinable()) {
-        m_chatWorkerThread.join();
-    }
-    if (m_eventWorkerThread.joinable()) {
-        m_eventWorkerThread.join();
-    }
-    if (m_indicatorsWorkerThread.joinable()) {
-        m_indicatorsWorkerThread.join();
-    }
-    if (m_stateWorkerThread.joinable()) {
-        m_stateWorkerThread.join();
-    }
-    if (m_missionWorkerThread.joinable()) {
-        m_missionWorkerThread.join();
-    }
-    if (m_mapInfoWorkerThread.joinable()) {
-        m_mapInfoWorkerThread.join();
+    if (m_reactorThread.joinable()) {
+        m_reactorThread.join();
     }
-    if (m_mapObjectsWorkerThread.joinable()) {
-        m_mapObjectsWorkerThread.join();
+    if (m_dispatchThread.joinable()) {
+        m_dispatchThread.join();
     }
-    
-    #ifdef _WIN32
-    // Закрываем connection pool
-    if (m_hInternet) {
-        InternetCloseHandle(m_hInternet);
-        m_hInternet = nullptr;
-    }
-    #endif
+
+    // Закрываем пул соединений
+    m_reactor.reset();
+    m_httpPool.reset();
 }
 
 void ApiFetcher::SetChatCallback(ChatCallback callback) {
     std::lock_guard<std::mutex> lock(m_callbackMutex);
-    m_chatCallback = callback;
+    m_callbacks[(size_t)ApiEndpoint::Chat] = callback;
 }
 
 void ApiFetcher::SetEventCallback(EventCallback callback) {
     std::lock_guard<std::mutex> lock(m_callbackMutex);
-    m_eventCallback = callback;
+    m_callbacks[(size_t)ApiEndpoint::Events] = callback;
 }
 
 void ApiFetcher::SetIndicatorsCallback(IndicatorsCallback callback) {
     std::lock_guard<std::mutex> lock(m_callbackMutex);
-    m_indicatorsCallback = callback;
+    m_callbacks[(size_t)ApiEndpoint::Indicators] = callback;
 }
 
 void ApiFetcher::SetStateCallback(StateCallback callback) {
     std::lock_guard<std::mutex> lock(m_callbackMutex);
-    m_stateCallback = callback;
+    m_callbacks[(size_t)ApiEndpoint::State] = callback;
 }
 
 void ApiFetcher::SetMissionCallback(MissionCallback callback) {
     std::lock_guard<std::mutex> lock(m_callbackMutex);
-    m_missionCallback = callback;
+    m_callbacks[(size_t)ApiEndpoint::Mission] = callback;
 }
 
 void ApiFetcher::SetMapInfoCallback(MapInfoCallback callback) {
     std::lock_guard<std::mutex> lock(m_callbackMutex);
-    m_mapInfoCallback = callback;
+    m_callbacks[(size_t)ApiEndpoint::MapInfo] = callback;
 }
 
 void ApiFetcher::SetMapObjectsCallback(MapObjectsCallback callback) {
     std::lock_guard<std::mutex> lock(m_callbackMutex);
-    m_mapObjectsCallback = callback;
+    m_callbacks[(size_t)ApiEndpoint::MapObjects] = callback;
+}
+
+void ApiFetcher::SetEndpointStream(ApiEndpoint endpoint, EndpointStream* stream) {
+    m_streams[(size_t)endpoint] = stream;
 }
 
 void ApiFetcher::Start() {
     if (m_running) return;
-    
+
+    // Потоки предыдущего запуска (если был Stop)
+    if (m_reactorThread.joinable()) {
+        m_reactorThread.join();
+    }
+    if (m_dispatchThread.joinable()) {
+        m_dispatchThread.join();
+    }
+
+    m_reactor = std::make_unique<Reactor>();
+    m_pipelining = true;
     m_running = true;
-    
-    // Запускаем отдельные потоки для чата, событий, indicators, state, mission и map_info
-    m_chatWorkerThread = std::thread(&ApiFetcher::ChatWorkerThread, this);
-    m_eventWorkerThread = std::thread(&ApiFetcher::EventWorkerThread, this);
-    m_indicatorsWorkerThread = std::thread(&ApiFetcher::IndicatorsWorkerThread, this);
-    m_stateWorkerThread = std::thread(&ApiFetcher::StateWorkerThread, this);
-    m_missionWorkerThread = std::thread(&ApiFetcher::MissionWorkerThread, this);
-    m_mapInfoWorkerThread = std::thread(&ApiFetcher::MapInfoWorkerThread, this);
-    m_mapObjectsWorkerThread = std::thread(&ApiFetcher::MapObjectsWorkerThread, this);
-    
-    // Привязываем потоки к первому ядру
-    #ifdef _WIN32
-    SetThreadAffinityMask(m_chatWorkerThread.native_handle(), 0x1);
-    SetThreadAffinityMask(m_eventWorkerThread.native_handle(), 0x1);
-    SetThreadAffinityMask(m_indicatorsWorkerThread.native_handle(), 0x1);
-    SetThreadAffinityMask(m_stateWorkerThread.native_handle(), 0x1);
-    SetThreadAffinityMask(m_missionWorkerThread.native_handle(), 0x1);
-    SetThreadAffinityMask(m_mapInfoWorkerThread.native_handle(), 0x1);
-    SetThreadAffinityMask(m_mapObjectsWorkerThread.native_handle(), 0x1);
-    #endif
+
+    // Поток реактора (все запросы) и поток обработки ответов
+    m_reactorThread = std::thread(&ApiFetcher::ReactorThread, this);
+    m_dispatchThread = std::thread(&ApiFetcher::DispatchThread, this);
 }
 
 void ApiFetcher::Stop() {
     m_running = false;
-}
 
-// HttpGet с connection pooling и улучшенной обработкой ошибок
-std::string ApiFetcher::HttpGet(const std::string& url, bool& success) {
-    success = false;
-    
-    #ifdef _WIN32
-    std::lock_guard<std::mutex> lock(m_httpMutex);
-    
-    // Используем переиспользуемое соединение (connection pooling)
-    if (!m_hInternet) {
-        // Если соединение потеряно, пытаемся пересоздать
-        m_hInternet = InternetOpenA("WarThunderAdvanced/1.0", INTERNET_OPEN_TYPE_DIRECT, NULL, NULL, 0);
-        if (!m_hInternet) {
-            return "";
-        }
-        DWORD timeout = 5000;
-        InternetSetOptionA(m_hInternet, INTERNET_OPTION_CONNECT_TIMEOUT, &timeout, sizeof(timeout));
-        InternetSetOptionA(m_hInternet, INTERNET_OPTION_RECEIVE_TIMEOUT, &timeout, sizeof(timeout));
-        InternetSetOptionA(m_hInternet, INTERNET_OPTION_SEND_TIMEOUT, &timeout, sizeof(timeout));
-    }
-    
-    HINTERNET hConnect = InternetOpenUrlA(m_hInternet, url.c_str(), NULL, 0, INTERNET_FLAG_RELOAD, 0);
-    if (!hConnect) {
-        // Проверяем тип ошибки
-        DWORD error = GetLastError();
-        if (error == ERROR_INTERNET_TIMEOUT || error == ERROR_INTERNET_CONNECTION_ABORTED) {
-            // Временная ошибка - можно повторить
-        } else if (error == ERROR_INTERNET_NAME_NOT_RESOLVED || error == ERROR_INTERNET_CANNOT_CONNECT) {
-            // Игра не запущена или API недоступен
-        }
-        return "";
+    // Реактор просыпается сразу, без ожидания таймеров и таймаутов запросов
+    if (m_reactor) {
+        m_reactor->Stop();
     }
     
-    std::string result;
-    char buffer[4096];
-    DWORD bytesRead;
-    
-    while (InternetReadFile(hConnect, buffer, sizeof(buffer) - 1, &bytesRead) && bytesRead > 0) {
-        buffer[bytesRead] = '\0';
-        result += buffer;
+    // Необработанные ответы больше не нужны; буферы возвращаются в пул вне блокировки
+    std::queue<DispatchTask> dropped;
+    {
+        std::lock_guard<std::mutex> lock(m_dispatchMutex);
+        dropped.swap(m_dispatchQueue);
     }
-    
-    InternetCloseHandle(hConnect);
-    
-    // Проверяем, что получили данные
-    if (!result.empty() && result.find("error") == std::string::npos) {
-        success = true;
+    m_dispatchCondition.notify_all();
+}
+
+std::vector<Http::ConnectionStats> ApiFetcher::GetConnectionStats() const {
+    if (!m_httpPool) return {};
+    return m_httpPool->GetStats();
+}
+
+uint64_t ApiFetcher::GetReactorWakeups() const {
+    return m_reactor ? m_reactor->GetWakeupCount() : 0;
+}
+
+ApiFetcher::BatchStats ApiFetcher::GetBatchStats() const {
+    BatchStats stats;
+    stats.batches = m_batchCount.load(std::memory_order_relaxed);
+    stats.requests = m_batchRequests.load(std::memory_order_relaxed);
+    stats.lastSize = m_lastBatchSize.load(std::memory_order_relaxed);
+    stats.maxSize = m_maxBatchSize.load(std::memory_order_relaxed);
+    stats.lastWallUs = m_lastBatchUs.load(std::memory_order_relaxed);
+    stats.totalWallUs = m_totalBatchUs.load(std::memory_order_relaxed);
+    stats.pipelining = m_pipelining;
+    return stats;
+}
+
+std::vector<ApiFetcher::EndpointStats> ApiFetcher::GetEndpointStats() const {
+    std::vector<EndpointStats> result((size_t)ApiEndpoint::Count);
+    for (size_t i = 0; i < result.size(); i++) {
+        const EndpointCounters& counters = m_counters[i];
+        result[i].name = g_endpointConfigs[i].name;
+        result[i].responses = counters.responses.load(std::memory_order_relaxed);
+        result[i].unchanged = counters.unchanged.load(std::memory_order_relaxed);
+        result[i].callbacks = counters.callbacks.load(std::memory_order_relaxed);
+        result[i].callbackUs = counters.callbackUs.load(std::memory_order_relaxed);
+        result[i].deadlineMisses = counters.deadlineMisses.load(std::memory_order_relaxed);
+        result[i].shed = counters.shed.load(std::memory_order_relaxed);
+        result[i].priority = g_endpointConfigs[i].priority;
+        result[i].intervalMs = counters.intervalMs.load(std::memory_order_relaxed);
     }
-    
     return result;
-    #else
-    return "";
-    #endif
 }
 
-// HttpGet с retry логикой и circuit breaker
-std::string ApiFetcher::HttpGetWithRetry(const std::string& url, CircuitBreaker& breaker, int maxRetries) {
-    // Проверяем circuit breaker
-    {
-        std::lock_guard<std::mutex> lock(m_breakerMutex);
-        if (!breaker.CanMakeRequest()) {
-            return ""; // Circuit открыт - пропускаем запрос
+ApiFetcher::ConnectivityStats ApiFetcher::GetConnectivityStats() const {
+    ConnectivityStats stats;
+    stats.state = m_connectivity.state;
+    stats.probes = m_connectivity.probes;
+    stats.failedProbes = m_connectivity.failedProbes;
+    stats.probeDelayMs = m_connectivity.probeDelayMs;
+    return stats;
+}
+
+ApiFetcher::ProfileStats ApiFetcher::GetProfileStats() const {
+    ProfileStats stats;
+    stats.profile = m_profile;
+    stats.switches = m_profileSwitches.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < (size_t)ApiEndpoint::Count; i++) {
+        if (m_counters[i].stretched.load(std::memory_order_relaxed)) stats.stretched++;
+    }
+    return stats;
+}
+
+void ApiFetcher::SetWindowVisible(bool visible) {
+    if (m_windowVisible.exchange(visible) != visible) PostProfileUpdate();
+}
+
+void ApiFetcher::ReportIndicators(bool valid) {
+    if (m_indicatorsValid.exchange(valid) != valid) PostProfileUpdate();
+}
+
+void ApiFetcher::ReportMapInfo(bool valid, int hudType) {
+    int value = valid ? hudType : -1;
+    if (m_mapHudType.exchange(value) != value) PostProfileUpdate();
+}
+
+void ApiFetcher::PostProfileUpdate() {
+    // Профиль применяется в потоке реактора сразу, не дожидаясь следующего таймера опроса
+    if (m_running && m_reactor) {
+        m_reactor->Post([this] { UpdateProfile(); });
+    }
+}
+
+void ApiFetcher::SetRequestBudget(double requestsPerSecond) {
+    m_requestBudget = std::max(requestsPerSecond, 1.0);
+}
+
+BufferPool::Stats ApiFetcher::GetBufferStats() const {
+    return m_bufferPool->GetStats();
+}
+
+std::string ApiFetcher::BuildPath(ApiEndpoint endpoint) const {
+    switch (endpoint) {
+        case ApiEndpoint::Chat:
+            return "/gamechat?lastId=" + std::to_string(m_chatCursor.GetRequestId());
+        case ApiEndpoint::Events:
+            return "/hudmsg?lastEvt=" + std::to_string(m_eventCursor.GetRequestId()) + "&lastDmg=" + std::to_string(m_damageCursor.GetRequestId());
+        case ApiEndpoint::Indicators:
+            return "/indicators";
+        case ApiEndpoint::State:
+            return "/state";
+        case ApiEndpoint::Mission:
+            return "/mission.json";
+        case ApiEndpoint::MapInfo:
+            return "/map_info.json";
+        case ApiEndpoint::MapObjects:
+            return "/map_obj.json";
+        default:
+            return "/";
+    }
+}
+
+void ApiFetcher::ReactorThread() {
+    // Ядра потока задаёт правило роли I/O (по умолчанию без привязки)
+    ThreadPlacement::ScopedRole placement(ThreadPlacement::Role::Io);
+
+    for (size_t i = 0; i < (size_t)ApiEndpoint::Count; i++) {
+        m_endpoints[i].hasFingerprint = false; // После перезапуска первый ответ всегда уходит в callback
+        m_endpoints[i].unchangedStreak = 0;
+        ApplyInterval((ApiEndpoint)i);
+    }
+    m_connectivity.Reset();
+    m_probeTimer = 0;
+    m_scheduleTimer = 0;
+    UpdateProfile();
+
+    // Эндпоинты спят до первой успешной пробы
+    StartProbe();
+
+    m_reactor->Run();
+
+    AbortAll();
+}
+
+void ApiFetcher::StartProbe() {
+    m_probeTimer = 0;
+
+    Http::Connection* connection = m_httpPool->TryAcquire();
+    if (!connection) {
+        ScheduleProbe();
+        return;
+    }
+
+    m_connectivity.OnProbeStarted();
+    LaunchBatch(connection, {}, { PROBE_PATH }, PROBE_TIMEOUT_MS, true);
+}
+
+void ApiFetcher::ScheduleProbe() {
+    int delayMs = m_connectivity.NextProbeDelayMs();
+    m_probeTimer = m_reactor->AddTimer(std::chrono::milliseconds(delayMs), [this] { StartProbe(); });
+}
+
+void ApiFetcher::FinishProbe(bool success) {
+    m_connectivity.OnProbeResult(success);
+    if (success) {
+        GoOnline();
+    } else {
+        ScheduleProbe();
+    }
+}
+
+// Связь появилась - все эндпоинты опрашиваются сразу (одним пакетом)
+void ApiFetcher::GoOnline() {
+    m_onlineEpoch++;
+
+    // Игра могла перезапуститься - нумерация лент начнётся заново
+    RequestStreamVerify();
+    UpdateProfile();
+
+    auto now = Reactor::Clock::now();
+    for (size_t i = 0; i < (size_t)ApiEndpoint::Count; i++) {
+        EndpointState& state = m_endpoints[i];
+        state.busy = false;
+        state.sent = false;
+        state.attempt = 0;
+        state.release = now;
+    }
+    // Первый пакет после подключения уходит целиком
+    m_budgetTokens = (double)ApiEndpoint::Count;
+    m_budgetUpdated = now;
+
+    ArmScheduler(now);
+}
+
+void ApiFetcher::RequestStreamVerify() {
+    m_chatCursor.RequestVerify();
+    m_eventCursor.RequestVerify();
+    m_damageCursor.RequestVerify();
+}
+
+// Связь потеряна - останавливаем опрос эндпоинтов и возвращаемся к пробам
+void ApiFetcher::GoOffline() {
+    AbortAll();
+    m_httpPool->CloseIdle();
+    UpdateProfile();
+    ScheduleProbe();
+}
+
+PollProfile ApiFetcher::SelectProfile() const {
+    if (!m_connectivity.IsOnline()) return PollProfile::NotRunning;
+    if (!m_windowVisible) return PollProfile::Minimized;
+
+    // Карты нет и полётные данные невалидны - игрок в ангаре
+    int hudType = m_mapHudType;
+    if (hudType < 0 && !m_indicatorsValid) return PollProfile::Hangar;
+    return hudType == 1 ? PollProfile::BattleGround : PollProfile::BattleAir;
+}
+
+void ApiFetcher::UpdateProfile() {
+    PollProfile profile = SelectProfile();
+    if (profile == m_profile) return;
+
+    m_profile = profile;
+    m_profileSwitches.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < (size_t)ApiEndpoint::Count; i++) {
+        ApplyInterval((ApiEndpoint)i);
+    }
+
+    // Интервалы могли сократиться - периоды пересчитываются сразу
+    if (m_connectivity.IsOnline()) {
+        ArmScheduler(Reactor::Clock::now());
+    }
+}
+
+// Интервал эндпоинта: из таблицы профиля, удваивается каждые STRETCH_AFTER ответов без изменений
+void ApiFetcher::ApplyInterval(ApiEndpoint endpoint) {
+    EndpointState& state = GetEndpoint(endpoint);
+
+    // Без связи интервалы не используются - оставляем боевые до выбора профиля
+    PollProfile profile = m_profile;
+    if (profile == PollProfile::NotRunning) profile = PollProfile::BattleAir;
+    int baseMs = g_profileIntervals[(size_t)profile][(size_t)endpoint];
+
+    int stretch = 1;
+    for (int steps = state.unchangedStreak / STRETCH_AFTER; steps > 0 && stretch < MAX_STRETCH; steps--) {
+        stretch *= 2;
+    }
+    int intervalMs = std::min(baseMs * stretch, std::max(baseMs, MAX_STRETCHED_INTERVAL_MS));
+
+    state.interval = std::chrono::milliseconds(intervalMs);
+    state.deadline = state.interval;
+
+    EndpointCounters& counters = m_counters[(size_t)endpoint];
+    counters.intervalMs.store(intervalMs, std::memory_order_relaxed);
+    counters.stretched.store(intervalMs > baseMs, std::memory_order_relaxed);
+}
+
+// Перевод эндпоинта в текущий период опроса (границы периодов считаются от плановой точки, без накопления дрейфа)
+void ApiFetcher::AdvancePeriods(ApiEndpoint endpoint, Reactor::Clock::time_point now) {
+    EndpointState& state = GetEndpoint(endpoint);
+    EndpointCounters& counters = m_counters[(size_t)endpoint];
+
+    // Долгая остановка (сон системы, зависание) - начинаем с текущего момента, один пропуск
+    if (now - state.release > state.interval * 10) {
+        if (!state.sent) counters.deadlineMisses.fetch_add(1, std::memory_order_relaxed);
+        state.release = now;
+        state.sent = false;
+        return;
+    }
+
+    while (true) {
+        if (state.sent) {
+            if (now < state.release + state.interval) break;
+            state.release += state.interval;
+            state.sent = false;
+            continue;
         }
+
+        if (now < state.release + state.deadline) break;
+
+        // Период закончился без запроса: предыдущий ещё выполнялся или не хватило бюджета
+        counters.deadlineMisses.fetch_add(1, std::memory_order_relaxed);
+        if (!state.busy) counters.shed.fetch_add(1, std::memory_order_relaxed);
+        state.release += state.interval;
     }
-    
-    // Пытаемся выполнить запрос с retry
-    for (int attempt = 0; attempt <= maxRetries; attempt++) {
-        bool success = false;
-        std::string result = HttpGet(url, success);
-        
-        {
-            std::lock_guard<std::mutex> lock(m_breakerMutex);
-            if (success) {
-                breaker.RecordSuccess();
-                return result;
-            } else {
-                breaker.RecordError();
+}
+
+void ApiFetcher::RefillBudget(Reactor::Clock::time_point now) {
+    double rate = m_requestBudget;
+    double elapsed = std::chrono::duration<double>(now - m_budgetUpdated).count();
+    m_budgetUpdated = now;
+
+    // Запас не меньше одного полного пакета
+    double burst = std::max(rate * 0.5, (double)ApiEndpoint::Count);
+    m_budgetTokens = std::min(burst, m_budgetTokens + elapsed * rate);
+}
+
+void ApiFetcher::ArmScheduler(Reactor::Clock::time_point when) {
+    if (m_scheduleTimer != 0) {
+        if (m_scheduleAt <= when) return;
+        m_reactor->CancelTimer(m_scheduleTimer);
+    }
+    m_scheduleAt = when;
+    m_scheduleTimer = m_reactor->AddTimerAt(when, [this] {
+        m_scheduleTimer = 0;
+        RunScheduler();
+    });
+}
+
+// EDF: из готовых эндпоинтов бюджет получают сначала высокоприоритетные,
+// отправляются они в порядке дедлайнов (в pipelining ответы приходят в порядке запросов)
+void ApiFetcher::RunScheduler() {
+    // Связи нет - эндпоинты спят до следующей успешной пробы
+    if (!m_connectivity.IsOnline()) return;
+
+    auto now = Reactor::Clock::now();
+    auto horizon = now + std::chrono::milliseconds(BATCH_WINDOW_MS);
+    RefillBudget(now);
+
+    std::vector<ApiEndpoint> ready;
+    for (size_t i = 0; i < (size_t)ApiEndpoint::Count; i++) {
+        AdvancePeriods((ApiEndpoint)i, now);
+        const EndpointState& state = m_endpoints[i];
+        // Эндпоинты со сроком в ближайшие BATCH_WINDOW_MS уходят тем же пакетом
+        if (!state.sent && !state.busy && state.release <= horizon) {
+            ready.push_back((ApiEndpoint)i);
+        }
+    }
+
+    // Бюджета не хватает на всех - откладываем низкоприоритетные (при пропуске дедлайна они отбрасываются)
+    size_t allowed = (size_t)m_budgetTokens;
+    if (ready.size() > allowed) {
+        std::sort(ready.begin(), ready.end(), [this](ApiEndpoint a, ApiEndpoint b) {
+            const EndpointState& left = GetEndpoint(a);
+            const EndpointState& right = GetEndpoint(b);
+            if (left.priority != right.priority) return left.priority < right.priority;
+            if (left.release + left.deadline != right.release + right.deadline) return left.release + left.deadline < right.release + right.deadline;
+            // При равных сроках бюджет получает тот, кто дольше не отправлялся
+            return left.deadlineAt < right.deadlineAt;
+        });
+        ready.resize(allowed);
+    }
+
+    std::sort(ready.begin(), ready.end(), [this](ApiEndpoint a, ApiEndpoint b) {
+        const EndpointState& left = GetEndpoint(a);
+        const EndpointState& right = GetEndpoint(b);
+        return left.release + left.deadline < right.release + right.deadline;
+    });
+
+    for (ApiEndpoint endpoint : ready) {
+        EndpointState& state = GetEndpoint(endpoint);
+        state.sent = true;
+        state.busy = true;
+        state.attempt = 0;
+        state.deadlineAt = state.release + state.deadline;
+    }
+    m_budgetTokens -= (double)ready.size();
+
+    if (!ready.empty()) {
+        if (m_pipelining) {
+            StartBatch(ready);
+        } else {
+            for (ApiEndpoint endpoint : ready) {
+                StartBatch({ endpoint });
             }
         }
-        
-        // Если не последняя попытка, ждем перед retry (exponential backoff)
-        if (attempt < maxRetries) {
-            int delayMs = 100 * (1 << attempt); // 100ms, 200ms, 400ms...
-            std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+    }
+
+    // Следующее пробуждение: начало периода, дедлайн неотправленного или появление токена бюджета
+    auto next = Reactor::Clock::time_point::max();
+    for (size_t i = 0; i < (size_t)ApiEndpoint::Count; i++) {
+        const EndpointState& state = m_endpoints[i];
+        if (state.sent) {
+            next = std::min(next, state.release + state.interval);
+        } else if (state.busy) {
+            next = std::min(next, state.release + state.deadline);
+        } else if (state.release > now) {
+            next = std::min(next, state.release);
+        } else {
+            // Ждёт бюджета
+            double rate = std::max(m_requestBudget.load(), 0.1);
+            auto wait = std::chrono::duration_cast<Reactor::Clock::duration>(std::chrono::duration<double>((1.0 - (m_budgetTokens - std::floor(m_budgetTokens))) / rate));
+            next = std::min(next, std::min(now + wait, state.release + state.deadline));
         }
     }
-    
-    return "";
+    if (next != Reactor::Clock::time_point::max()) {
+        ArmScheduler(next);
+    }
 }
 
-void ApiFetcher::ChatWorkerThread() {
-    // Привязываем поток к первому ядру
-    #ifdef _WIN32
-    SetThreadAffinityMask(GetCurrentThread(), 0x1);
-    #endif
-    
-    auto lastUpdate = std::chrono::steady_clock::now();
-    const auto updateInterval = std::chrono::milliseconds(2000); // Обновление каждые 2 секунды (Communication: 2-5 seconds)
-    
-    while (m_running) {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastUpdate);
-        
-        if (elapsed >= updateInterval) {
-            lastUpdate = now;
-            
-            // Получаем игровой чат
-            int lastChatId;
-            {
-                std::lock_guard<std::mutex> lock(m_idMutex);
-                lastChatId = m_lastChatId;
-            }
-            
-            std::string chatUrl = "http://localhost:8111/gamechat?lastId=" + std::to_string(lastChatId);
-            std::string chatData = HttpGetWithRetry(chatUrl, m_chatBreaker);
-            
-            // Если получили данные - обрабатываем
-            if (!chatData.empty()) {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                if (m_chatCallback) {
-                    m_chatCallback(chatData);
-                }
+void ApiFetcher::StartBatch(const std::vector<ApiEndpoint>& endpoints) {
+    Http::Connection* connection = m_httpPool->TryAcquire();
+    if (!connection) {
+        // Все соединения заняты - ждём освобождения
+        for (ApiEndpoint endpoint : endpoints) {
+            EndpointState& state = GetEndpoint(endpoint);
+            if (!state.queued) {
+                state.queued = true;
+                m_waitingForConnection.push_back(endpoint);
             }
         }
-        
-        // Небольшая задержка, чтобы не нагружать CPU
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        return;
+    }
+
+    std::vector<std::string> paths;
+    paths.reserve(endpoints.size());
+    for (ApiEndpoint endpoint : endpoints) {
+        paths.push_back(BuildPath(endpoint));
     }
+
+    LaunchBatch(connection, endpoints, paths, HTTP_TIMEOUT_MS, false);
 }
 
-void ApiFetcher::EventWorkerThread() {
-    // Привязываем поток к первому ядру
-    #ifdef _WIN32
-    SetThreadAffinityMask(GetCurrentThread(), 0x1);
-    #endif
-    
-    auto lastUpdate = std::chrono::steady_clock::now();
-    const auto updateInterval = std::chrono::milliseconds(2000); // Обновление каждые 2 секунды (Communication: 2-5 seconds)
-    
-    while (m_running) {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastUpdate);
-        
-        if (elapsed >= updateInterval) {
-            lastUpdate = now;
-            
-            // Получаем события
-            int lastEventId;
-            {
-                std::lock_guard<std::mutex> lock(m_idMutex);
-                lastEventId = m_lastEventId;
-            }
-            
-            std::string eventUrl = "http://localhost:8111/hudmsg?lastEvt=0&lastDmg=" + std::to_string(lastEventId);
-            std::string eventData = HttpGetWithRetry(eventUrl, m_eventBreaker);
-            
-            // Если получили данные - обрабатываем
-            if (!eventData.empty()) {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                if (m_eventCallback) {
-                    m_eventCallback(eventData);
-                }
-            }
+void ApiFetcher::LaunchBatch(Http::Connection* connection, const std::vector<ApiEndpoint>& endpoints, const std::vector<std::string>& paths, int timeoutMs, bool probe) {
+    m_batches.push_back(std::make_unique<Batch>());
+    Batch* batch = m_batches.back().get();
+    batch->id = ++m_nextBatchId;
+    batch->endpoints = endpoints;
+    batch->connection = connection;
+    batch->probe = probe;
+    batch->start = Reactor::Clock::now();
+
+    // Тела эндпоинтов с потоковым получателем разбираются прямо при чтении сокета
+    std::vector<Http::BodyObserver*> observers;
+    for (ApiEndpoint endpoint : endpoints) {
+        observers.push_back(m_streams[(size_t)endpoint]);
+    }
+
+    if (!connection->BeginBatch(paths, observers)) {
+        FinishBatch(batch);
+        return;
+    }
+
+    // Таймер ищет пакет по id: пакет мог быть уже удалён другим обработчиком этого же прохода реактора
+    uint64_t id = batch->id;
+    batch->timeoutTimer = m_reactor->AddTimer(std::chrono::milliseconds(timeoutMs), [this, id] {
+        Batch* timedOut = FindBatch(id);
+        if (!timedOut) return;
+        timedOut->timeoutTimer = 0;
+        timedOut->connection->AbortAsync();
+        FinishBatch(timedOut);
+    });
+
+    UpdateWatch(batch);
+}
+
+ApiFetcher::Batch* ApiFetcher::FindBatch(uint64_t id) {
+    for (auto& batch : m_batches) {
+        if (batch->id == id) return batch.get();
+    }
+    return nullptr;
+}
+
+// Подписка реактора на текущий сокет соединения (сокет меняется при переподключении)
+void ApiFetcher::UpdateWatch(Batch* batch) {
+    Http::SocketHandle socket = batch->connection->GetSocket();
+    if (batch->watchedSocket != Http::InvalidSocket && batch->watchedSocket != socket) {
+        m_reactor->Unwatch(batch->watchedSocket);
+    }
+
+    if (socket != Http::InvalidSocket) {
+        bool wantWrite = batch->connection->WantsWrite();
+        m_reactor->Watch(socket, !wantWrite, wantWrite, [this, batch](bool readable, bool writable, bool error) {
+            OnBatchIo(batch, readable, writable, error);
+        });
+    }
+    batch->watchedSocket = socket;
+}
+
+void ApiFetcher::OnBatchIo(Batch* batch, bool readable, bool writable, bool error) {
+    Http::Connection::AsyncResult result = batch->connection->OnSocketEvent(readable, writable, error);
+    if (result == Http::Connection::AsyncResult::Pending) {
+        UpdateWatch(batch);
+        return;
+    }
+
+    FinishBatch(batch);
+}
+
+void ApiFetcher::RemoveBatch(Batch* batch) {
+    if (batch->timeoutTimer != 0) {
+        m_reactor->CancelTimer(batch->timeoutTimer);
+    }
+    if (batch->watchedSocket != Http::InvalidSocket) {
+        m_reactor->Unwatch(batch->watchedSocket);
+    }
+
+    m_httpPool->Release(batch->connection);
+    for (size_t i = 0; i < m_batches.size(); i++) {
+        if (m_batches[i].get() == batch) {
+            m_batches.erase(m_batches.begin() + i);
+            break;
         }
-        
-        // Небольшая задержка, чтобы не нагружать CPU
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
 }
 
-void ApiFetcher::IndicatorsWorkerThread() {
-    // Привязываем поток к первому ядру
-    #ifdef _WIN32
-    SetThreadAffinityMask(GetCurrentThread(), 0x1);
-    #endif
-    
-    auto lastUpdate = std::chrono::steady_clock::now();
-    const auto updateInterval = std::chrono::milliseconds(150); // Critical flight data: 100-200ms (рекомендуется 100-200ms)
-    
-    while (m_running) {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastUpdate);
-        
-        if (elapsed >= updateInterval) {
-            lastUpdate = now;
-            
-            std::string indicatorsUrl = "http://localhost:8111/indicators";
-            std::string indicatorsData = HttpGetWithRetry(indicatorsUrl, m_indicatorsBreaker);
-            
-            // Если получили данные - обрабатываем
-            if (!indicatorsData.empty()) {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                if (m_indicatorsCallback) {
-                    m_indicatorsCallback(indicatorsData);
+void ApiFetcher::FinishBatch(Batch* batch) {
+    // Ответы идут в порядке запросов; при обрыве приходит только начало пакета
+    std::vector<Http::Response>& responses = batch->connection->GetAsyncResponses();
+    size_t received = responses.size();
+
+    if (batch->probe) {
+        bool success = received > 0 && responses[0].status == 200;
+        RemoveBatch(batch);
+        FinishProbe(success);
+        return;
+    }
+
+    // Сервер ответил на часть пакета и закрыл соединение - дальше шлём запросы по отдельности
+    if (batch->endpoints.size() > 1 && received > 0 && received < batch->endpoints.size()) {
+        m_pipelining = false;
+    }
+
+    RecordBatch(batch->endpoints.size(), batch->start);
+
+    std::vector<ApiEndpoint> retries;
+    for (size_t i = 0; i < batch->endpoints.size(); i++) {
+        FinishEndpoint(batch->endpoints[i], i < received ? &responses[i] : nullptr, retries);
+    }
+
+    std::vector<ApiEndpoint> finishedEndpoints = std::move(batch->endpoints);
+    RemoveBatch(batch);
+
+    // Слишком много ошибок подряд - игра закрыта или API не отвечает
+    if (!m_connectivity.IsOnline()) {
+        GoOffline();
+        return;
+    }
+
+    // Retry с exponential backoff (100ms, 200ms...) через таймер вместо sleep, неудачные запросы пакета - снова одним пакетом
+    if (!retries.empty()) {
+        int delayMs = 100 * (1 << (GetEndpoint(retries.front()).attempt - 1));
+        uint64_t epoch = m_onlineEpoch;
+        m_reactor->AddTimer(std::chrono::milliseconds(delayMs), [this, retries, epoch] {
+            // Связь успела пропасть (и, возможно, восстановиться) - эндпоинты уже перезапущены
+            if (epoch != m_onlineEpoch || !m_connectivity.IsOnline()) return;
+
+            // Повтор тоже расходует бюджет; без бюджета период считается проваленным
+            RefillBudget(Reactor::Clock::now());
+            if (m_budgetTokens < (double)retries.size()) {
+                for (ApiEndpoint endpoint : retries) {
+                    GetEndpoint(endpoint).busy = false;
+                    m_counters[(size_t)endpoint].shed.fetch_add(1, std::memory_order_relaxed);
                 }
+                ArmScheduler(Reactor::Clock::now());
+                return;
             }
+            m_budgetTokens -= (double)retries.size();
+
+            if (m_pipelining) {
+                StartBatch(retries);
+            } else {
+                for (ApiEndpoint endpoint : retries) {
+                    StartBatch({ endpoint });
+                }
+            }
+        });
+    }
+
+    // Освободилось соединение - запускаем ожидающие запросы
+    StartQueued();
+
+    // Эндпоинт освободился до дедлайна нового периода - планировщик отправит его сразу
+    for (ApiEndpoint endpoint : finishedEndpoints) {
+        const EndpointState& state = GetEndpoint(endpoint);
+        if (!state.busy && !state.sent) {
+            ArmScheduler(Reactor::Clock::now());
+            break;
         }
-        
-        // Небольшая задержка, чтобы не нагружать CPU
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
     }
 }
 
-void ApiFetcher::StateWorkerThread() {
-    // Привязываем поток к первому ядру
-    #ifdef _WIN32
-    SetThreadAffinityMask(GetCurrentThread(), 0x1);
-    #endif
-    
-    auto lastUpdate = std::chrono::steady_clock::now();
-    const auto updateInterval = std::chrono::milliseconds(150); // Critical flight data: 100-200ms (рекомендуется 100-200ms)
-    
-    while (m_running) {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastUpdate);
-        
-        if (elapsed >= updateInterval) {
-            lastUpdate = now;
-            
-            std::string stateUrl = "http://localhost:8111/state";
-            std::string stateData = HttpGetWithRetry(stateUrl, m_stateBreaker);
-            
-            // Если получили данные - обрабатываем
-            if (!stateData.empty()) {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                if (m_stateCallback) {
-                    m_stateCallback(stateData);
-                }
+void ApiFetcher::FinishEndpoint(ApiEndpoint endpoint, Http::Response* response, std::vector<ApiEndpoint>& retries) {
+    EndpointState& state = GetEndpoint(endpoint);
+
+    // Проверяем, что получили данные
+    if (response && response->status == 200 && !response->body.Empty()) {
+        m_connectivity.RecordSuccess();
+        state.busy = false;
+        EndpointCounters& counters = m_counters[(size_t)endpoint];
+
+        // Ответ пришёл позже дедлайна своего периода
+        if (Reactor::Clock::now() > state.deadlineAt) {
+            counters.deadlineMisses.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Тело не изменилось с прошлого раза - callback не вызываем, опубликованное состояние остаётся прежним
+        counters.responses.fetch_add(1, std::memory_order_relaxed);
+        if (state.hasFingerprint && state.fingerprint == response->fingerprint) {
+            counters.unchanged.fetch_add(1, std::memory_order_relaxed);
+            if (state.unchangedStreak < STRETCH_AFTER * MAX_STRETCH) {
+                state.unchangedStreak++;
+                if (state.unchangedStreak % STRETCH_AFTER == 0) ApplyInterval(endpoint);
             }
+            return;
         }
-        
-        // Небольшая задержка, чтобы не нагружать CPU
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        // Данные снова меняются - сразу возвращаем интервал профиля
+        if (state.unchangedStreak >= STRETCH_AFTER) {
+            state.unchangedStreak = 0;
+            ApplyInterval(endpoint);
+            ArmScheduler(state.release + state.interval);
+        }
+        state.unchangedStreak = 0;
+        // Новый map_info - смена карты/матча, ленты перечитываются с начала
+        if (endpoint == ApiEndpoint::MapInfo && state.hasFingerprint) {
+            RequestStreamVerify();
+        }
+        state.fingerprint = response->fingerprint;
+        state.hasFingerprint = true;
+
+        if (EndpointStream* stream = m_streams[(size_t)endpoint]) {
+            stream->OnBodyDispatched(response->body.Str(), response->fingerprint);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_dispatchMutex);
+            m_dispatchQueue.push(DispatchTask{ endpoint, std::move(response->body), response->fingerprint });
+        }
+        m_dispatchCondition.notify_one();
+        return;
+    }
+
+    m_connectivity.RecordError();
+    if (state.attempt < HTTP_MAX_RETRIES) {
+        state.attempt++;
+        retries.push_back(endpoint);
+    } else {
+        state.busy = false;
     }
 }
 
-void ApiFetcher::MissionWorkerThread() {
-    // Привязываем поток к первому ядру
-    #ifdef _WIN32
-    SetThreadAffinityMask(GetCurrentThread(), 0x1);
-    #endif
-    
-    auto lastUpdate = std::chrono::steady_clock::now();
-    const auto updateInterval = std::chrono::milliseconds(1500); // Strategic information: 1-2 seconds (рекомендуется 1-2 секунды)
-    
-    while (m_running) {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastUpdate);
-        
-        if (elapsed >= updateInterval) {
-            lastUpdate = now;
-            
-            std::string missionUrl = "http://localhost:8111/mission.json";
-            std::string missionData = HttpGetWithRetry(missionUrl, m_missionBreaker);
-            
-            // Если получили данные - обрабатываем
-            if (!missionData.empty()) {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                if (m_missionCallback) {
-                    m_missionCallback(missionData);
-                }
-            }
+void ApiFetcher::RecordBatch(size_t size, Reactor::Clock::time_point start) {
+    uint64_t wallUs = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(Reactor::Clock::now() - start).count();
+
+    m_batchCount.fetch_add(1, std::memory_order_relaxed);
+    m_batchRequests.fetch_add(size, std::memory_order_relaxed);
+    m_lastBatchSize.store(size, std::memory_order_relaxed);
+    m_lastBatchUs.store(wallUs, std::memory_order_relaxed);
+    m_totalBatchUs.fetch_add(wallUs, std::memory_order_relaxed);
+    if (size > m_maxBatchSize.load(std::memory_order_relaxed)) {
+        m_maxBatchSize.store(size, std::memory_order_relaxed);
+    }
+}
+
+void ApiFetcher::StartQueued() {
+    while (!m_waitingForConnection.empty()) {
+        // Все ожидающие эндпоинты уходят одним пакетом (или по одному без pipelining)
+        std::vector<ApiEndpoint> endpoints;
+        if (m_pipelining) {
+            endpoints.assign(m_waitingForConnection.begin(), m_waitingForConnection.end());
+            m_waitingForConnection.clear();
+        } else {
+            endpoints.push_back(m_waitingForConnection.front());
+            m_waitingForConnection.pop_front();
+        }
+        for (ApiEndpoint endpoint : endpoints) {
+            GetEndpoint(endpoint).queued = false;
         }
-        
-        // Небольшая задержка, чтобы не нагружать CPU
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        StartBatch(endpoints);
+
+        // Соединений снова не хватило - эндпоинты вернулись в очередь
+        if (GetEndpoint(endpoints.front()).queued) break;
     }
 }
 
-void ApiFetcher::MapInfoWorkerThread() {
-    // Привязываем поток к первому ядру
-    #ifdef _WIN32
-    SetThreadAffinityMask(GetCurrentThread(), 0x1);
-    #endif
-    
-    auto lastUpdate = std::chrono::steady_clock::now();
-    const auto updateInterval = std::chrono::milliseconds(2000); // Обновление каждые 2 секунды (map_info редко меняется)
-    
-    while (m_running) {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastUpdate);
-        
-        if (elapsed >= updateInterval) {
-            lastUpdate = now;
-            
-            std::string mapInfoUrl = "http://localhost:8111/map_info.json";
-            std::string mapInfoData = HttpGetWithRetry(mapInfoUrl, m_mapInfoBreaker);
-            
-            // Если получили данные - обрабатываем
-            if (!mapInfoData.empty()) {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                if (m_mapInfoCallback) {
-                    m_mapInfoCallback(mapInfoData);
-                }
-            }
+void ApiFetcher::AbortAll() {
+    m_reactor->CancelTimer(m_probeTimer);
+    m_probeTimer = 0;
+
+    for (auto& batch : m_batches) {
+        if (batch->timeoutTimer != 0) {
+            m_reactor->CancelTimer(batch->timeoutTimer);
+        }
+        if (batch->watchedSocket != Http::InvalidSocket) {
+            m_reactor->Unwatch(batch->watchedSocket);
         }
-        
-        // Небольшая задержка, чтобы не нагружать CPU
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        batch->connection->AbortAsync();
+        m_httpPool->Release(batch->connection);
+    }
+    m_batches.clear();
+
+    m_reactor->CancelTimer(m_scheduleTimer);
+    m_scheduleTimer = 0;
+
+    for (size_t i = 0; i < (size_t)ApiEndpoint::Count; i++) {
+        EndpointState& state = m_endpoints[i];
+        state.busy = false;
+        state.sent = false;
+        state.queued = false;
     }
+    m_waitingForConnection.clear();
 }
 
-void ApiFetcher::MapObjectsWorkerThread() {
-    // Привязываем поток к первому ядру
-    #ifdef _WIN32
-    SetThreadAffinityMask(GetCurrentThread(), 0x1);
-    #endif
-    
-    auto lastUpdate = std::chrono::steady_clock::now();
-    const auto updateInterval = std::chrono::milliseconds(750); // Tactical information: 500-1000ms (рекомендуется 500-1000ms для map_obj.json)
-    
-    while (m_running) {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastUpdate);
-        
-        if (elapsed >= updateInterval) {
-            lastUpdate = now;
-            
-            std::string mapObjectsUrl = "http://localhost:8111/map_obj.json";
-            std::string mapObjectsData = HttpGetWithRetry(mapObjectsUrl, m_mapObjectsBreaker);
+void ApiFetcher::DispatchThread() {
+    // Callback'и разбирают ответы - роль Parse
+    ThreadPlacement::ScopedRole placement(ThreadPlacement::Role::Parse);
+
+    while (true) {
+        DispatchTask task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_dispatchMutex);
+            m_dispatchCondition.wait(lock, [this] {
+                return !m_dispatchQueue.empty() || !m_running;
+            });
+
+            if (!m_running) break;
+
+            task = std::move(m_dispatchQueue.front());
+            m_dispatchQueue.pop();
+        }
+
+        // Копия callback'а: обработчик может вызвать Set*Callback или Stop без взаимной блокировки
+        std::function<void(PooledBuffer jsonData, uint64_t fingerprint)> callback;
+        {
+            std::lock_guard<std::mutex> lock(m_callbackMutex);
+            callback = m_callbacks[(size_t)task.endpoint];
+        }
+        if (callback) {
+            size_t bytes = task.jsonData.Size();
+            auto start = std::chrono::steady_clock::now();
+            callback(std::move(task.jsonData), task.fingerprint);
+            uint64_t elapsedUs = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
             
-            // Если получили данные - обрабатываем
-            if (!mapObjectsData.empty()) {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                if (m_mapObjectsCallback) {
-                    m_mapObjectsCallback(mapObjectsData);
-                }
-            }
+            EndpointCounters& counters = m_counters[(size_t)task.endpoint];
+            counters.callbacks.fetch_add(1, std::memory_order_relaxed);
+            counters.callbackUs.fetch_add(elapsedUs, std::memory_order_relaxed);
+            ThreadPlacement::RecordParse(bytes, elapsedUs);
         }
-        
-        // Небольшая задержка, чтобы не нагружать CPU
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
     }
 }
-
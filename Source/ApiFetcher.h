@@ -6,60 +6,138 @@
 #include <mutex>
 #include <functional>
 #include <chrono>
+#include <vector>
+#include <memory>
+#include <deque>
+#include <queue>
+#include <condition_variable>
+#include <random>
+
+#include "HttpClient.h"
+#include "Reactor.h"
+#include "StreamCursor.h"
+#include "ThreadPlacement.h"
 
 #ifdef _WIN32
 #include <windows.h>
-#include <wininet.h>
 #endif
 
-// Circuit Breaker для защиты от перегрузки API
-struct CircuitBreaker {
-    int consecutiveErrors = 0;
-    std::chrono::steady_clock::time_point lastErrorTime;
-    bool isOpen = false; // true = circuit открыт (заблокирован)
-    static constexpr int MAX_ERRORS = 5; // Максимум ошибок перед блокировкой
-    static constexpr int COOLDOWN_MS = 5000; // Время блокировки (5 секунд)
-    
-    bool CanMakeRequest() {
-        if (!isOpen) return true;
-        
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastErrorTime);
-        
-        if (elapsed.count() >= COOLDOWN_MS) {
-            // Пробуем снова после cooldown
-            isOpen = false;
-            consecutiveErrors = 0;
-            return true;
+// Общее состояние связи с API игры (одно на все эндпоинты)
+// Disconnected -> Probing -> Connected <-> Degraded -> Disconnected
+// Пока связи нет, эндпоинты не опрашиваются - работает только одна проба с exponential backoff и jitter
+struct Connectivity {
+    enum class State {
+        Disconnected, // Игра не отвечает, ждём следующей пробы
+        Probing,      // Проба в процессе
+        Connected,    // Запросы проходят
+        Degraded      // Часть запросов неудачна, опрос продолжается
+    };
+    
+    static constexpr int MIN_PROBE_DELAY_MS = 100;
+    static constexpr int MAX_PROBE_DELAY_MS = 800; // Переподключение после запуска игры - меньше секунды
+    static constexpr int MAX_FAILURES = 5;         // Подряд неудачных запросов до перехода в Disconnected
+    
+    std::atomic<State> state{ State::Disconnected };
+    std::atomic<uint64_t> probes{ 0 };
+    std::atomic<uint64_t> failedProbes{ 0 };
+    std::atomic<int> probeDelayMs{ 0 }; // Текущая задержка до следующей пробы
+    int consecutiveFailures = 0;
+    int failedProbeStreak = 0;
+    std::minstd_rand random{ std::random_device{}() };
+    
+    void Reset() {
+        state = State::Disconnected;
+        consecutiveFailures = 0;
+        failedProbeStreak = 0;
+    }
+    
+    bool IsOnline() const {
+        State current = state;
+        return current == State::Connected || current == State::Degraded;
+    }
+    
+    void OnProbeStarted() {
+        state = State::Probing;
+        probes++;
+    }
+    
+    void OnProbeResult(bool success) {
+        if (success) {
+            state = State::Connected;
+            consecutiveFailures = 0;
+            failedProbeStreak = 0;
+        } else {
+            state = State::Disconnected;
+            failedProbes++;
+            failedProbeStreak++;
         }
-        return false;
     }
     
     void RecordSuccess() {
-        consecutiveErrors = 0;
-        isOpen = false;
+        consecutiveFailures = 0;
+        if (state == State::Degraded) state = State::Connected;
     }
     
-    void RecordError() {
-        consecutiveErrors++;
-        lastErrorTime = std::chrono::steady_clock::now();
-        
-        if (consecutiveErrors >= MAX_ERRORS) {
-            isOpen = true;
+    // Возвращает true, если связь потеряна (эндпоинты надо остановить)
+    bool RecordError() {
+        if (!IsOnline()) return false;
+        consecutiveFailures++;
+        if (consecutiveFailures >= MAX_FAILURES) {
+            state = State::Disconnected;
+            failedProbeStreak = 0;
+            return true;
         }
+        state = State::Degraded;
+        return false;
+    }
+    
+    // Задержка до следующей пробы: удваивается с каждой неудачей, jitter 75-100% против синхронных всплесков
+    int NextProbeDelayMs() {
+        int exponent = failedProbeStreak < 4 ? failedProbeStreak : 4;
+        int delay = MIN_PROBE_DELAY_MS << exponent;
+        if (delay > MAX_PROBE_DELAY_MS) delay = MAX_PROBE_DELAY_MS;
+        std::uniform_int_distribution<int> jitter(delay * 3 / 4, delay);
+        delay = jitter(random);
+        probeDelayMs = delay;
+        return delay;
     }
 };
 
+// Эндпоинты локального API игры
+enum class ApiEndpoint {
+    Chat,
+    Events,
+    Indicators,
+    State,
+    Mission,
+    MapInfo,
+    MapObjects,
+    Count
+};
+
+// Профили частоты опроса (выбираются автоматически по фазе игры и видимости окна)
+enum class PollProfile {
+    Hangar,       // Нет боя: опрашиваем редко, ждём появления карты
+    BattleAir,    // Бой, hud_type = 0
+    BattleGround, // Бой, hud_type = 1 (state не нужен, важнее карта)
+    Minimized,    // Окно свёрнуто - данные никто не видит
+    NotRunning,   // Игра не отвечает - работает только проба связи
+    Count
+};
+
 // Асинхронный загрузчик данных из War Thunder API
+// Один поток реактора опрашивает все эндпоинты, второй поток вызывает callback'и
+// Тело ответа передаётся в callback владением (буфер из пула, без копирования)
+// вместе с отпечатком fingerprint - Hash64 тела (Response::fingerprint), уже посчитанным при приёме
 class ApiFetcher {
 public:
-    using ChatCallback = std::function<void(const std::string& jsonData)>;
-    using EventCallback = std::function<void(const std::string& jsonData)>;
-    using IndicatorsCallback = std::function<void(const std::string& jsonData)>;
-    using StateCallback = std::function<void(const std::string& jsonData)>;
-    using MissionCallback = std::function<void(const std::string& jsonData)>;
-    using MapInfoCallback = std::function<void(const std::string& jsonData)>;
-    using MapObjectsCallback = std::function<void(const std::string& jsonData)>;
+    using ChatCallback = std::function<void(PooledBuffer jsonData, uint64_t fingerprint)>;
+    using EventCallback = std::function<void(PooledBuffer jsonData, uint64_t fingerprint)>;
+    using IndicatorsCallback = std::function<void(PooledBuffer jsonData, uint64_t fingerprint)>;
+    using StateCallback = std::function<void(PooledBuffer jsonData, uint64_t fingerprint)>;
+    using MissionCallback = std::function<void(PooledBuffer jsonData, uint64_t fingerprint)>;
+    using MapInfoCallback = std::function<void(PooledBuffer jsonData, uint64_t fingerprint)>;
+    using MapObjectsCallback = std::function<void(PooledBuffer jsonData, uint64_t fingerprint)>;
     
     ApiFetcher();
     ~ApiFetcher();
@@ -73,6 +151,18 @@ public:
     void SetMapInfoCallback(MapInfoCallback callback);
     void SetMapObjectsCallback(MapObjectsCallback callback);
     
+    // Потоковый получатель тела эндпоинта: порции приходят прямо из цикла чтения сокета (поток реактора),
+    // поэтому разбор идёт параллельно с приёмом. OnBodyDispatched - тело body пришло целиком, изменилось
+    // и сейчас будет передано в callback; по fingerprint callback находит свой результат,
+    // если промежуточные тела не дошли до разбора
+    class EndpointStream : public Http::BodyObserver {
+    public:
+        virtual void OnBodyDispatched(const std::string& body, uint64_t fingerprint) = 0;
+    };
+    
+    // Устанавливается до Start (nullptr - тело только целиком в callback)
+    void SetEndpointStream(ApiEndpoint endpoint, EndpointStream* stream);
+    
     // Начать/остановить загрузку
     void Start();
     void Stop();
@@ -80,70 +170,230 @@ public:
     // Проверить, работает ли загрузчик
     bool IsRunning() const { return m_running; }
     
-    // Получить/установить последние ID (для синхронизации)
-    int GetLastChatId() const { 
-        std::lock_guard<std::mutex> lock(m_idMutex);
-        return m_lastChatId; 
-    }
-    int GetLastEventId() const { 
-        std::lock_guard<std::mutex> lock(m_idMutex);
-        return m_lastEventId; 
-    }
-    void SetLastChatId(int id) { 
-        std::lock_guard<std::mutex> lock(m_idMutex);
-        m_lastChatId = id; 
-    }
-    void SetLastEventId(int id) { 
-        std::lock_guard<std::mutex> lock(m_idMutex);
-        m_lastEventId = id; 
-    }
+    // Курсоры инкрементальных лент: запросы берут из них id, декодеры разрешают по ним ответы
+    StreamCursor& GetChatCursor() { return m_chatCursor; }
+    StreamCursor& GetEventCursor() { return m_eventCursor; }
+    StreamCursor& GetDamageCursor() { return m_damageCursor; }
+    
+    // Сигналы для выбора профиля опроса (поток UI и декодеры ответов)
+    void SetWindowVisible(bool visible);
+    void ReportIndicators(bool valid);
+    void ReportMapInfo(bool valid, int hudType);
+    
+    // Счётчики соединений пула (для дебаг режима)
+    std::vector<Http::ConnectionStats> GetConnectionStats() const;
+    
+    // Количество пробуждений цикла реактора (для дебаг режима)
+    uint64_t GetReactorWakeups() const;
+    
+    // Статистика пакетной отправки запросов (для дебаг режима)
+    struct BatchStats {
+        uint64_t batches = 0;     // Отправленных пакетов (по одному на тик опроса)
+        uint64_t requests = 0;    // Запросов во всех пакетах
+        uint64_t lastSize = 0;    // Размер последнего пакета
+        uint64_t maxSize = 0;
+        uint64_t lastWallUs = 0;  // Время от отправки до последнего ответа (мкс)
+        uint64_t totalWallUs = 0;
+        bool pipelining = true;
+        
+        double AverageSize() const { return batches > 0 ? (double)requests / (double)batches : 0.0; }
+        double AverageWallMs() const { return batches > 0 ? (double)totalWallUs / (double)batches / 1000.0 : 0.0; }
+    };
+    BatchStats GetBatchStats() const;
+    
+    // Состояние связи с API (для дебаг режима)
+    struct ConnectivityStats {
+        Connectivity::State state = Connectivity::State::Disconnected;
+        uint64_t probes = 0;
+        uint64_t failedProbes = 0;
+        int probeDelayMs = 0;
+    };
+    ConnectivityStats GetConnectivityStats() const;
+    
+    // Текущий профиль опроса (для дебаг режима)
+    struct ProfileStats {
+        PollProfile profile = PollProfile::NotRunning;
+        uint64_t switches = 0;  // Смен профиля
+        uint64_t stretched = 0; // Эндпоинтов с увеличенным из-за неизменных данных интервалом
+    };
+    ProfileStats GetProfileStats() const;
+    
+    // Отпечатки тел ответов по эндпоинтам (для дебаг режима)
+    struct EndpointStats {
+        const char* name = "";
+        uint64_t responses = 0;   // Успешных ответов
+        uint64_t unchanged = 0;   // Из них с тем же телом, что и в прошлый раз (callback пропущен)
+        uint64_t callbacks = 0;   // Вызванных callback'ов
+        uint64_t callbackUs = 0;  // Суммарное время callback'ов (мкс)
+        uint64_t deadlineMisses = 0; // Периодов без ответа к дедлайну
+        uint64_t shed = 0;           // Из них не отправленных из-за бюджета запросов
+        int priority = 0;
+        int intervalMs = 0;          // Текущий интервал опроса (профиль + растяжение)
+        
+        double UnchangedRatio() const { return responses > 0 ? (double)unchanged / (double)responses : 0.0; }
+        double AverageCallbackMs() const { return callbacks > 0 ? (double)callbackUs / (double)callbacks / 1000.0 : 0.0; }
+        // Оценка сэкономленного времени разбора и блокировок: пропущенные вызовы * среднее время callback'а
+        double SavedMs() const { return (double)unchanged * AverageCallbackMs(); }
+    };
+    std::vector<EndpointStats> GetEndpointStats() const;
+    
+    // Счётчики пула буферов ответов (для дебаг режима)
+    BufferPool::Stats GetBufferStats() const;
+    
+    // Общий бюджет запросов к серверу игры (запросов в секунду)
+    void SetRequestBudget(double requestsPerSecond);
+    double GetRequestBudget() const { return m_requestBudget; }
+    
+    // Адрес локального API игры и размер пула соединений
+    static constexpr const char* API_HOST = "localhost";
+    static constexpr uint16_t API_PORT = 8111;
+    static constexpr size_t HTTP_POOL_SIZE = 4;
+    static constexpr int HTTP_TIMEOUT_MS = 5000;
+    static constexpr int HTTP_MAX_RETRIES = 2;
+    static constexpr const char* PROBE_PATH = "/state"; // Самый лёгкий эндпоинт для пробы связи
+    static constexpr int PROBE_TIMEOUT_MS = 1000;
+    static constexpr int BATCH_WINDOW_MS = 50; // Эндпоинты со сроком в этом окне уходят одним пакетом
+    static constexpr double DEFAULT_REQUEST_BUDGET = 30.0; // Запросов в секунду (штатный опрос - около 17)
+    static constexpr int STRETCH_AFTER = 8;                // Ответов без изменений до удвоения интервала
+    static constexpr int MAX_STRETCH = 4;
+    static constexpr int MAX_STRETCHED_INTERVAL_MS = 5000; // Растянутый интервал не больше (если профиль сам не медленнее)
     
 private:
-    void ChatWorkerThread();
-    void EventWorkerThread();
-    void IndicatorsWorkerThread();
-    void StateWorkerThread();
-    void MissionWorkerThread();
-    void MapInfoWorkerThread();
-    void MapObjectsWorkerThread();
-    std::string HttpGet(const std::string& url, bool& success);
-    std::string HttpGetWithRetry(const std::string& url, CircuitBreaker& breaker, int maxRetries = 2);
-    
-    // Connection pooling
-    #ifdef _WIN32
-    HINTERNET m_hInternet; // Переиспользуемое соединение
-    std::mutex m_httpMutex; // Защита для thread-safe доступа к m_hInternet
-    #endif
-    
-    // Circuit breakers для каждого endpoint
-    CircuitBreaker m_chatBreaker;
-    CircuitBreaker m_eventBreaker;
-    CircuitBreaker m_indicatorsBreaker;
-    CircuitBreaker m_stateBreaker;
-    CircuitBreaker m_missionBreaker;
-    CircuitBreaker m_mapInfoBreaker;
-    CircuitBreaker m_mapObjectsBreaker;
-    std::mutex m_breakerMutex; // Защита для circuit breakers
-    
-    std::thread m_chatWorkerThread;
-    std::thread m_eventWorkerThread;
-    std::thread m_indicatorsWorkerThread;
-    std::thread m_stateWorkerThread;
-    std::thread m_missionWorkerThread;
-    std::thread m_mapInfoWorkerThread;
-    std::thread m_mapObjectsWorkerThread;
+    // Состояние опроса одного эндпоинта (используется только потоком реактора)
+    struct EndpointState {
+        const char* name = "";
+        std::chrono::milliseconds interval{ 0 };
+        std::chrono::milliseconds deadline{ 0 }; // Ответ текущего периода нужен не позже release + deadline
+        int priority = 0;                        // 0 - наивысший, при нехватке бюджета отбрасываются старшие номера
+        Reactor::Clock::time_point release;      // Начало текущего периода опроса
+        Reactor::Clock::time_point deadlineAt;   // Дедлайн отправленного запроса
+        bool sent = false;                       // Запрос текущего периода уже отправлен
+        int unchangedStreak = 0;                 // Ответов подряд без изменений (растягивает интервал)
+        uint64_t fingerprint = 0;       // Отпечаток последнего переданного в callback тела
+        bool hasFingerprint = false;
+        int attempt = 0;
+        bool busy = false;      // Запрос (или ожидание retry) ещё не завершён
+        bool queued = false;    // Ждёт свободного соединения в пуле
+    };
+    
+    // Пакет запросов, отправленных одной записью по одному соединению (HTTP pipelining)
+    struct Batch {
+        uint64_t id = 0;
+        bool probe = false; // Проба связи, а не опрос эндпоинтов
+        std::vector<ApiEndpoint> endpoints;
+        Http::Connection* connection = nullptr;
+        Http::SocketHandle watchedSocket = Http::InvalidSocket;
+        Reactor::TimerId timeoutTimer = 0;
+        Reactor::Clock::time_point start;
+    };
+    
+    // Счётчики эндпоинта (пишут потоки реактора и callback'ов, читает UI)
+    struct EndpointCounters {
+        std::atomic<uint64_t> responses{ 0 };
+        std::atomic<uint64_t> unchanged{ 0 };
+        std::atomic<uint64_t> callbacks{ 0 };
+        std::atomic<uint64_t> callbackUs{ 0 };
+        std::atomic<uint64_t> deadlineMisses{ 0 };
+        std::atomic<uint64_t> shed{ 0 };
+        std::atomic<int> intervalMs{ 0 };
+        std::atomic<bool> stretched{ false };
+    };
+    
+    struct DispatchTask {
+        ApiEndpoint endpoint;
+        PooledBuffer jsonData;
+        uint64_t fingerprint = 0;
+    };
+    
+    void ReactorThread();
+    void DispatchThread();
+    
+    void RunScheduler();
+    void ArmScheduler(Reactor::Clock::time_point when);
+    void AdvancePeriods(ApiEndpoint endpoint, Reactor::Clock::time_point now);
+    void RefillBudget(Reactor::Clock::time_point now);
+    PollProfile SelectProfile() const;
+    void UpdateProfile();
+    void PostProfileUpdate();
+    void ApplyInterval(ApiEndpoint endpoint);
+    void StartProbe();
+    void ScheduleProbe();
+    void FinishProbe(bool success);
+    void GoOnline();
+    void GoOffline();
+    void RequestStreamVerify();
+    void StartBatch(const std::vector<ApiEndpoint>& endpoints);
+    void LaunchBatch(Http::Connection* connection, const std::vector<ApiEndpoint>& endpoints, const std::vector<std::string>& paths, int timeoutMs, bool probe);
+    Batch* FindBatch(uint64_t id);
+    void RemoveBatch(Batch* batch);
+    void OnBatchIo(Batch* batch, bool readable, bool writable, bool error);
+    void FinishBatch(Batch* batch);
+    void FinishEndpoint(ApiEndpoint endpoint, Http::Response* response, std::vector<ApiEndpoint>& retries);
+    void UpdateWatch(Batch* batch);
+    void RecordBatch(size_t size, Reactor::Clock::time_point start);
+    void StartQueued();
+    void AbortAll();
+    std::string BuildPath(ApiEndpoint endpoint) const;
+    
+    EndpointState& GetEndpoint(ApiEndpoint endpoint) { return m_endpoints[(size_t)endpoint]; }
+    
+    // Пул keep-alive соединений (без глобальной блокировки на время запроса)
+    std::unique_ptr<Http::ConnectionPool> m_httpPool;
+    
+    // Пул буферов тел ответов (буферы могут пережить ApiFetcher в очереди JsonParser)
+    std::shared_ptr<BufferPool> m_bufferPool;
+    
+    // Реактор: таймеры опроса + неблокирующие сокеты
+    std::unique_ptr<Reactor> m_reactor;
+    EndpointState m_endpoints[(size_t)ApiEndpoint::Count];
+    EndpointCounters m_counters[(size_t)ApiEndpoint::Count];
+    std::vector<std::unique_ptr<Batch>> m_batches;
+    uint64_t m_nextBatchId;
+    
+    // Одна на все эндпоинты проба связи вместо отдельного circuit breaker на каждый
+    Connectivity m_connectivity;
+    uint64_t m_onlineEpoch; // Растёт при каждом переходе в Connected (отсекает устаревшие retry таймеры)
+    Reactor::TimerId m_probeTimer;
+    
+    // EDF планировщик: один таймер на все эндпоинты + token bucket общего бюджета
+    Reactor::TimerId m_scheduleTimer;
+    Reactor::Clock::time_point m_scheduleAt;
+    std::atomic<double> m_requestBudget;
+    double m_budgetTokens;
+    Reactor::Clock::time_point m_budgetUpdated;
+    
+    // Профиль опроса: сигналы пишут UI и декодеры, применяет поток реактора
+    std::atomic<PollProfile> m_profile;
+    std::atomic<uint64_t> m_profileSwitches;
+    std::atomic<bool> m_windowVisible;
+    std::atomic<bool> m_indicatorsValid;
+    std::atomic<int> m_mapHudType; // -1 - карты нет
+    
+    std::deque<ApiEndpoint> m_waitingForConnection;
+    std::atomic<bool> m_pipelining; // Сбрасывается, если сервер не отвечает на все запросы пакета
+    
+    // Счётчики пакетов (пишет поток реактора, читает UI)
+    std::atomic<uint64_t> m_batchCount;
+    std::atomic<uint64_t> m_batchRequests;
+    std::atomic<uint64_t> m_lastBatchSize;
+    std::atomic<uint64_t> m_maxBatchSize;
+    std::atomic<uint64_t> m_lastBatchUs;
+    std::atomic<uint64_t> m_totalBatchUs;
+    
+    std::thread m_reactorThread;
+    std::thread m_dispatchThread;
     std::atomic<bool> m_running;
-    ChatCallback m_chatCallback;
-    EventCallback m_eventCallback;
-    IndicatorsCallback m_indicatorsCallback;
-    StateCallback m_stateCallback;
-    MissionCallback m_missionCallback;
-    MapInfoCallback m_mapInfoCallback;
-    MapObjectsCallback m_mapObjectsCallback;
+    
+    // Очередь готовых ответов для callback'ов
+    std::queue<DispatchTask> m_dispatchQueue;
+    std::mutex m_dispatchMutex;
+    std::condition_variable m_dispatchCondition;
+    
+    std::function<void(PooledBuffer jsonData, uint64_t fingerprint)> m_callbacks[(size_t)ApiEndpoint::Count];
+    EndpointStream* m_streams[(size_t)ApiEndpoint::Count] = {};
     std::mutex m_callbackMutex;
     
-    mutable std::mutex m_idMutex;
-    int m_lastChatId;
-    int m_lastEventId;
+    StreamCursor m_chatCursor;
+    StreamCursor m_eventCursor;
+    StreamCursor m_damageCursor;
 };
-
@@ -0,0 +1,107 @@
+#include "BufferPool.h"
+#include <algorithm>
+
+// ===== PooledBuffer =====
+
+PooledBuffer::PooledBuffer(std::shared_ptr<BufferPool> pool, std::string data)
+    : m_pool(std::move(pool))
+    , m_data(std::move(data))
+{
+}
+
+PooledBuffer::~PooledBuffer() {
+    Release();
+}
+
+PooledBuffer::PooledBuffer(PooledBuffer&& other) noexcept
+    : m_pool(std::move(other.m_pool))
+    , m_data(std::move(other.m_data))
+{
+    other.m_pool.reset();
+    other.m_data.clear();
+}
+
+PooledBuffer& PooledBuffer::operator=(PooledBuffer&& other) noexcept {
+    if (this != &other) {
+        Release();
+        m_pool = std::move(other.m_pool);
+        m_data = std::move(other.m_data);
+        other.m_pool.reset();
+        other.m_data.clear();
+    }
+    return *this;
+}
+
+void PooledBuffer::Release() {
+    if (m_pool) {
+        m_pool->Return(std::move(m_data));
+        m_pool.reset();
+    }
+    m_data = std::string();
+}
+
+// ===== BufferPool =====
+
+PooledBuffer BufferPool::Acquire(size_t sizeHint) {
+    std::string data;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_acquires++;
+        m_inUse++;
+        m_peakInUse = std::max(m_peakInUse, m_inUse);
+
+        // Самый маленький подходящий буфер, иначе самый большой из свободных (дорастёт при чтении)
+        size_t best = m_free.size();
+        for (size_t i = 0; i < m_free.size(); i++) {
+            size_t capacity = m_free[i].capacity();
+            if (best == m_free.size()) {
+                best = i;
+                continue;
+            }
+            size_t bestCapacity = m_free[best].capacity();
+            bool fits = sizeHint > 0 && capacity >= sizeHint;
+            bool bestFits = sizeHint > 0 && bestCapacity >= sizeHint;
+            if (fits && (!bestFits || capacity < bestCapacity)) best = i;
+            else if (!fits && !bestFits && capacity > bestCapacity) best = i;
+        }
+
+        if (best < m_free.size()) {
+            data = std::move(m_free[best]);
+            m_free[best] = std::move(m_free.back());
+            m_free.pop_back();
+            m_freeBytes -= data.capacity();
+            if (data.capacity() >= sizeHint) m_reuses++;
+        }
+    }
+
+    data.clear();
+    if (sizeHint > data.capacity()) {
+        data.reserve(sizeHint);
+    }
+    return PooledBuffer(shared_from_this(), std::move(data));
+}
+
+void BufferPool::Return(std::string&& data) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_inUse > 0) m_inUse--;
+
+    size_t capacity = data.capacity();
+    m_largestBuffer = std::max(m_largestBuffer, capacity);
+    if (capacity == 0 || capacity > MAX_RETAINED_CAPACITY || m_free.size() >= MAX_FREE_BUFFERS) return;
+
+    m_freeBytes += capacity;
+    m_free.push_back(std::move(data));
+}
+
+BufferPool::Stats BufferPool::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats;
+    stats.acquires = m_acquires;
+    stats.reuses = m_reuses;
+    stats.inUse = m_inUse;
+    stats.peakInUse = m_peakInUse;
+    stats.freeBuffers = m_free.size();
+    stats.freeBytes = m_freeBytes;
+    stats.largestBuffer = m_largestBuffer;
+    return stats;
+}
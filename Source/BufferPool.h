@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+class BufferPool;
+
+// Буфер тела ответа: передаётся только перемещением (callback'и, очередь JsonParser)
+// При уничтожении память возвращается в пул вместе с capacity строки
+class PooledBuffer {
+public:
+    PooledBuffer() = default;
+    explicit PooledBuffer(std::string data) : m_data(std::move(data)) {} // Без пула (обычная строка)
+    ~PooledBuffer();
+
+    PooledBuffer(PooledBuffer&& other) noexcept;
+    PooledBuffer& operator=(PooledBuffer&& other) noexcept;
+    PooledBuffer(const PooledBuffer&) = delete;
+    PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+    std::string& Str() { return m_data; }
+    const std::string& Str() const { return m_data; }
+
+    bool Empty() const { return m_data.empty(); }
+    size_t Size() const { return m_data.size(); }
+
+    // Вернуть буфер в пул досрочно
+    void Release();
+
+private:
+    friend class BufferPool;
+    PooledBuffer(std::shared_ptr<BufferPool> pool, std::string data);
+
+    std::shared_ptr<BufferPool> m_pool;
+    std::string m_data;
+};
+
+// Пул переиспользуемых буферов приёма (потокобезопасный)
+// Буфер выбирается по размеру из Content-Length, поэтому тело ответа не переаллоцируется при чтении
+class BufferPool : public std::enable_shared_from_this<BufferPool> {
+public:
+    static constexpr size_t MAX_FREE_BUFFERS = 16;                // Больше свободных буферов не храним
+    static constexpr size_t MAX_RETAINED_CAPACITY = 4 * 1024 * 1024; // Слишком большие буферы не возвращаются в пул
+
+    // Счётчики пула (для дебаг режима)
+    struct Stats {
+        uint64_t acquires = 0;      // Выдано буферов
+        uint64_t reuses = 0;        // Из них без новой аллокации
+        uint64_t inUse = 0;         // Сейчас на руках
+        uint64_t peakInUse = 0;     // Максимум одновременно на руках
+        uint64_t freeBuffers = 0;   // Свободных буферов в пуле
+        uint64_t freeBytes = 0;     // Их суммарная capacity
+        uint64_t largestBuffer = 0; // Самый большой буфер за всё время (байт)
+    };
+
+    static std::shared_ptr<BufferPool> Create() { return std::shared_ptr<BufferPool>(new BufferPool()); }
+
+    // Буфер с capacity не меньше sizeHint (0 - размер неизвестен, берётся самый большой свободный)
+    PooledBuffer Acquire(size_t sizeHint);
+
+    Stats GetStats() const;
+
+private:
+    friend class PooledBuffer;
+    BufferPool() = default;
+
+    void Return(std::string&& data);
+
+    std::vector<std::string> m_free;
+    uint64_t m_acquires = 0;
+    uint64_t m_reuses = 0;
+    uint64_t m_inUse = 0;
+    uint64_t m_peakInUse = 0;
+    size_t m_freeBytes = 0;
+    size_t m_largestBuffer = 0;
+    mutable std::mutex m_mutex;
+};
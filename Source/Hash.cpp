@@ -0,0 +1,127 @@
+#include "Hash.h"
+#include <cstring>
+
+namespace {
+    constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+
+    inline uint64_t RotateLeft(uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    // Чтение без требований к выравниванию (little-endian, как на x64)
+    inline uint64_t Read64(const unsigned char* p) {
+        uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint32_t Read32(const unsigned char* p) {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t Round(uint64_t acc, uint64_t input) {
+        acc += input * PRIME2;
+        acc = RotateLeft(acc, 31);
+        return acc * PRIME1;
+    }
+
+    inline uint64_t MergeRound(uint64_t acc, uint64_t value) {
+        acc ^= Round(0, value);
+        return acc * PRIME1 + PRIME4;
+    }
+}
+
+void Hash64::Reset(uint64_t seed) {
+    m_seed = seed;
+    m_acc[0] = seed + PRIME1 + PRIME2;
+    m_acc[1] = seed + PRIME2;
+    m_acc[2] = seed;
+    m_acc[3] = seed - PRIME1;
+    m_totalLength = 0;
+    m_bufferSize = 0;
+}
+
+void Hash64::Update(const void* data, size_t size) {
+    const unsigned char* p = (const unsigned char*)data;
+    const unsigned char* end = p + size;
+    m_totalLength += size;
+
+    // Дополняем неполную полосу с прошлого вызова
+    if (m_bufferSize > 0) {
+        size_t take = sizeof(m_buffer) - m_bufferSize;
+        if (take > size) take = size;
+        std::memcpy(m_buffer + m_bufferSize, p, take);
+        m_bufferSize += take;
+        p += take;
+        if (m_bufferSize < sizeof(m_buffer)) return;
+
+        for (int i = 0; i < 4; i++) {
+            m_acc[i] = Round(m_acc[i], Read64(m_buffer + i * 8));
+        }
+        m_bufferSize = 0;
+    }
+
+    while (end - p >= 32) {
+        for (int i = 0; i < 4; i++) {
+            m_acc[i] = Round(m_acc[i], Read64(p + i * 8));
+        }
+        p += 32;
+    }
+
+    if (p < end) {
+        std::memcpy(m_buffer, p, (size_t)(end - p));
+        m_bufferSize = (size_t)(end - p);
+    }
+}
+
+uint64_t Hash64::Digest() const {
+    uint64_t hash;
+    if (m_totalLength >= 32) {
+        hash = RotateLeft(m_acc[0], 1) + RotateLeft(m_acc[1], 7) + RotateLeft(m_acc[2], 12) + RotateLeft(m_acc[3], 18);
+        for (int i = 0; i < 4; i++) {
+            hash = MergeRound(hash, m_acc[i]);
+        }
+    } else {
+        hash = m_seed + PRIME5;
+    }
+    hash += m_totalLength;
+
+    // Хвост меньше 32 байт
+    const unsigned char* p = m_buffer;
+    const unsigned char* end = m_buffer + m_bufferSize;
+    while (end - p >= 8) {
+        hash ^= Round(0, Read64(p));
+        hash = RotateLeft(hash, 27) * PRIME1 + PRIME4;
+        p += 8;
+    }
+    if (end - p >= 4) {
+        hash ^= (uint64_t)Read32(p) * PRIME1;
+        hash = RotateLeft(hash, 23) * PRIME2 + PRIME3;
+        p += 4;
+    }
+    while (p < end) {
+        hash ^= (*p) * PRIME5;
+        hash = RotateLeft(hash, 11) * PRIME1;
+        p++;
+    }
+
+    // Финальное перемешивание
+    hash ^= hash >> 33;
+    hash *= PRIME2;
+    hash ^= hash >> 29;
+    hash *= PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+uint64_t Hash64::Compute(const void* data, size_t size, uint64_t seed) {
+    Hash64 hash(seed);
+    hash.Update(data, size);
+    return hash.Digest();
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Потоковый 64-битный хеш (алгоритм XXH64): тело ответа хешируется по мере приёма порций
+// Используется как отпечаток содержимого, а не для криптографии
+class Hash64 {
+public:
+    explicit Hash64(uint64_t seed = 0) { Reset(seed); }
+
+    void Reset(uint64_t seed = 0);
+    void Update(const void* data, size_t size);
+    uint64_t Digest() const;
+
+    // Хеш целого буфера за один вызов
+    static uint64_t Compute(const void* data, size_t size, uint64_t seed = 0);
+
+private:
+    uint64_t m_acc[4];
+    uint64_t m_seed;
+    uint64_t m_totalLength;
+    unsigned char m_buffer[32]; // Неполная 32-байтная полоса с прошлого вызова
+    size_t m_bufferSize;
+};
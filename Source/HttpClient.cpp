@@ -0,0 +1,870 @@
+#include "HttpClient.h"
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+
+#ifdef _WIN32
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <cerrno>
+#endif
+
+namespace Http {
+    namespace {
+        std::mutex g_socketsMutex;
+        int g_socketsRefCount = 0;
+
+        bool IsWouldBlock() {
+            #ifdef _WIN32
+            int error = WSAGetLastError();
+            return error == WSAEWOULDBLOCK || error == WSAEINPROGRESS;
+            #else
+            return errno == EWOULDBLOCK || errno == EAGAIN || errno == EINPROGRESS;
+            #endif
+        }
+
+        bool EqualsNoCase(const std::string& a, const char* b) {
+            size_t len = std::strlen(b);
+            if (a.size() != len) return false;
+            for (size_t i = 0; i < len; i++) {
+                if (std::tolower((unsigned char)a[i]) != std::tolower((unsigned char)b[i])) return false;
+            }
+            return true;
+        }
+
+        bool ContainsNoCase(const std::string& haystack, const char* needle) {
+            size_t len = std::strlen(needle);
+            if (len == 0 || haystack.size() < len) return false;
+            for (size_t i = 0; i + len <= haystack.size(); i++) {
+                size_t j = 0;
+                while (j < len && std::tolower((unsigned char)haystack[i + j]) == std::tolower((unsigned char)needle[j])) j++;
+                if (j == len) return true;
+            }
+            return false;
+        }
+
+        std::string Trim(const std::string& str) {
+            size_t start = 0;
+            size_t end = str.size();
+            while (start < end && (str[start] == ' ' || str[start] == '\t')) start++;
+            while (end > start && (str[end - 1] == ' ' || str[end - 1] == '\t')) end--;
+            return str.substr(start, end - start);
+        }
+
+        int RemainingMs(std::chrono::steady_clock::time_point deadline) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            return left.count() > 0 ? (int)left.count() : 0;
+        }
+
+        void UpdateMax(std::atomic<uint64_t>& target, uint64_t value) {
+            uint64_t current = target.load(std::memory_order_relaxed);
+            while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+    }
+
+    bool InitSockets() {
+        std::lock_guard<std::mutex> lock(g_socketsMutex);
+        #ifdef _WIN32
+        if (g_socketsRefCount == 0) {
+            WSADATA wsaData;
+            if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+                return false;
+            }
+        }
+        #endif
+        g_socketsRefCount++;
+        return true;
+    }
+
+    void ShutdownSockets() {
+        std::lock_guard<std::mutex> lock(g_socketsMutex);
+        if (g_socketsRefCount == 0) return;
+        g_socketsRefCount--;
+        #ifdef _WIN32
+        if (g_socketsRefCount == 0) {
+            WSACleanup();
+        }
+        #endif
+    }
+
+    void CloseSocket(SocketHandle socket) {
+        if (socket == InvalidSocket) return;
+        #ifdef _WIN32
+        closesocket(socket);
+        #else
+        close(socket);
+        #endif
+    }
+
+    bool SetNonBlocking(SocketHandle socket) {
+        #ifdef _WIN32
+        u_long mode = 1;
+        return ioctlsocket(socket, FIONBIO, &mode) == 0;
+        #else
+        int flags = fcntl(socket, F_GETFL, 0);
+        if (flags < 0) return false;
+        return fcntl(socket, F_SETFL, flags | O_NONBLOCK) == 0;
+        #endif
+    }
+
+    // ===== ResponseReader =====
+
+    void ResponseReader::Reset() {
+        m_state = State::StatusLine;
+        m_response = Response();
+        m_line.clear();
+        m_contentLength = 0;
+        m_remaining = 0;
+        m_bodySize = 0;
+        m_hasContentLength = false;
+        m_chunked = false;
+        m_started = false;
+        m_observer = nullptr;
+        m_bodyHash.Reset();
+    }
+
+    // Тело хешируется по мере приёма - отпечаток готов сразу после последнего байта
+    // Тело длиннее MAX_CONTENT_LENGTH - ошибка (chunked и тело до закрытия заранее длину не сообщают)
+    bool ResponseReader::AppendBody(const char* data, size_t size) {
+        if (size > MAX_CONTENT_LENGTH - m_bodySize) {
+            m_state = State::Error;
+            return false;
+        }
+        m_bodySize += size;
+        m_response.body.Str().append(data, size);
+        m_bodyHash.Update(data, size);
+        if (m_observer) m_observer->OnBodyData(data, size);
+        return true;
+    }
+
+    // Размер чанка: hex-цифры, затем пробелы и расширения после ';'
+    // Без цифр, с мусором или сверх MAX_CONTENT_LENGTH вместе с уже принятым телом - ошибка
+    bool ResponseReader::OnChunkSizeLine() {
+        size_t size = 0;
+        size_t pos = 0;
+        for (; pos < m_line.size(); pos++) {
+            char c = m_line[pos];
+            size_t digit;
+            if (c >= '0' && c <= '9') digit = (size_t)(c - '0');
+            else if (c >= 'a' && c <= 'f') digit = (size_t)(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') digit = (size_t)(c - 'A' + 10);
+            else break;
+            size = size * 16 + digit;
+            if (size > MAX_CONTENT_LENGTH - m_bodySize) {
+                m_state = State::Error;
+                return false;
+            }
+        }
+        size_t digits = pos;
+        while (pos < m_line.size() && (m_line[pos] == ' ' || m_line[pos] == '\t')) pos++;
+        if (digits == 0 || (pos < m_line.size() && m_line[pos] != ';')) {
+            m_state = State::Error;
+            return false;
+        }
+        m_remaining = size;
+        m_state = m_remaining > 0 ? State::ChunkData : State::Trailers;
+        return true;
+    }
+
+    // Накопление строки до CRLF (строка может прийти несколькими порциями)
+    bool ResponseReader::ReadLine(const char* data, size_t size, size_t& pos) {
+        while (pos < size) {
+            char c = data[pos++];
+            if (c == '\n') {
+                if (!m_line.empty() && m_line.back() == '\r') m_line.pop_back();
+                return true;
+            }
+            m_line += c;
+            if (m_line.size() > 16384) { // Защита от мусора вместо заголовков
+                m_state = State::Error;
+                return false;
+            }
+        }
+        return false;
+    }
+
+    void ResponseReader::OnStatusLine() {
+        // Формат: HTTP/1.1 200 OK
+        if (m_line.compare(0, 5, "HTTP/") != 0) {
+            m_state = State::Error;
+            return;
+        }
+        size_t space = m_line.find(' ');
+        if (space == std::string::npos) {
+            m_state = State::Error;
+            return;
+        }
+        m_response.status = std::atoi(m_line.c_str() + space + 1);
+        // HTTP/1.0 по умолчанию закрывает соединение
+        m_response.keepAlive = m_line.compare(0, 8, "HTTP/1.0") != 0;
+        m_state = State::Headers;
+    }
+
+    void ResponseReader::OnHeaderLine() {
+        size_t colon = m_line.find(':');
+        if (colon == std::string::npos) return;
+
+        std::string name = Trim(m_line.substr(0, colon));
+        std::string value = Trim(m_line.substr(colon + 1));
+
+        if (EqualsNoCase(name, "Content-Length")) {
+            // Только десятичные цифры и не больше MAX_CONTENT_LENGTH, иначе ответ ошибочный
+            size_t length = 0;
+            bool valid = !value.empty();
+            for (char c : value) {
+                if (c < '0' || c > '9' || length > MAX_CONTENT_LENGTH) {
+                    valid = false;
+                    break;
+                }
+                length = length * 10 + (size_t)(c - '0');
+            }
+            if (!valid || length > MAX_CONTENT_LENGTH || (m_hasContentLength && length != m_contentLength)) {
+                m_state = State::Error;
+                return;
+            }
+            m_contentLength = length;
+            m_hasContentLength = true;
+        } else if (EqualsNoCase(name, "Transfer-Encoding")) {
+            m_chunked = ContainsNoCase(value, "chunked");
+        } else if (EqualsNoCase(name, "Connection")) {
+            if (ContainsNoCase(value, "close")) m_response.keepAlive = false;
+            else if (ContainsNoCase(value, "keep-alive")) m_response.keepAlive = true;
+        }
+    }
+
+    void ResponseReader::OnHeadersComplete() {
+        if (m_observer) m_observer->OnBodyBegin();
+        if (m_chunked) {
+            if (m_bufferPool) m_response.body = m_bufferPool->Acquire(0);
+            m_state = State::ChunkSize;
+        } else if (m_hasContentLength) {
+            m_remaining = m_contentLength;
+            // Буфер сразу нужного размера - тело не переаллоцируется при чтении
+            // Заранее - не больше буфера, который пул держит; длиннее тело дорастёт при чтении
+            size_t reserve = std::min(m_contentLength, BufferPool::MAX_RETAINED_CAPACITY);
+            if (m_bufferPool) m_response.body = m_bufferPool->Acquire(reserve);
+            else m_response.body.Str().reserve(reserve);
+            m_state = m_remaining > 0 ? State::Body : State::Done;
+        } else if (m_response.status == 204 || m_response.status == 304 || m_response.status / 100 == 1) {
+            m_state = State::Done;
+        } else {
+            // Тело до закрытия соединения
+            if (m_bufferPool) m_response.body = m_bufferPool->Acquire(0);
+            m_response.keepAlive = false;
+            m_state = State::UntilClose;
+        }
+    }
+
+    size_t ResponseReader::Feed(const char* data, size_t size) {
+        size_t pos = 0;
+        if (size > 0) m_started = true;
+
+        while (pos < size && m_state != State::Done && m_state != State::Error) {
+            switch (m_state) {
+                case State::StatusLine:
+                    if (ReadLine(data, size, pos)) {
+                        if (m_line.empty()) break; // Пропускаем лишние CRLF между ответами
+                        OnStatusLine();
+                        m_line.clear();
+                    }
+                    break;
+
+                case State::Headers:
+                    if (ReadLine(data, size, pos)) {
+                        if (m_line.empty()) {
+                            OnHeadersComplete();
+                        } else {
+                            OnHeaderLine();
+                        }
+                        m_line.clear();
+                    }
+                    break;
+
+                case State::Body: {
+                    size_t take = std::min(m_remaining, size - pos);
+                    if (!AppendBody(data + pos, take)) break;
+                    pos += take;
+                    m_remaining -= take;
+                    if (m_remaining == 0) m_state = State::Done;
+                    break;
+                }
+
+                case State::ChunkSize:
+                    if (ReadLine(data, size, pos)) {
+                        OnChunkSizeLine();
+                        m_line.clear();
+                    }
+                    break;
+
+                case State::ChunkData: {
+                    size_t take = std::min(m_remaining, size - pos);
+                    if (!AppendBody(data + pos, take)) break;
+                    pos += take;
+                    m_remaining -= take;
+                    if (m_remaining == 0) m_state = State::ChunkDataEnd;
+                    break;
+                }
+
+                case State::ChunkDataEnd:
+                    // После данных чанка - пустая строка, иначе размер чанка не совпал с данными
+                    if (ReadLine(data, size, pos)) {
+                        m_state = m_line.empty() ? State::ChunkSize : State::Error;
+                        m_line.clear();
+                    }
+                    break;
+
+                case State::Trailers:
+                    if (ReadLine(data, size, pos)) {
+                        if (m_line.empty()) m_state = State::Done;
+                        m_line.clear();
+                    }
+                    break;
+
+                case State::UntilClose:
+                    if (!AppendBody(data + pos, size - pos)) break;
+                    pos = size;
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        if (m_state == State::Done) {
+            m_response.fingerprint = m_bodyHash.Digest();
+        }
+        return pos;
+    }
+
+    void ResponseReader::OnConnectionClosed() {
+        if (m_state == State::UntilClose) {
+            m_state = State::Done;
+            m_response.fingerprint = m_bodyHash.Digest();
+        } else if (m_state != State::Done) {
+            m_state = State::Error;
+        }
+    }
+
+    // ===== Connection =====
+
+    Connection::Connection(const std::string& host, uint16_t port)
+        : m_host(host)
+        , m_port(port)
+        , m_socket(InvalidSocket)
+        , m_asyncState(AsyncState::Idle)
+        , m_addressIndex(0)
+        , m_sendOffset(0)
+        , m_expectedResponses(0)
+        , m_asyncReused(false)
+        , m_asyncRetried(false)
+        , m_requests(0)
+        , m_reuses(0)
+        , m_connects(0)
+        , m_failures(0)
+        , m_lastLatencyUs(0)
+        , m_maxLatencyUs(0)
+        , m_totalLatencyUs(0)
+    {
+    }
+
+    Connection::~Connection() {
+        Close();
+    }
+
+    void Connection::SetBufferPool(std::shared_ptr<BufferPool> pool) {
+        m_bufferPool = pool;
+        m_reader.SetBufferPool(std::move(pool));
+    }
+
+    void Connection::Close() {
+        CloseSocket(m_socket);
+        m_socket = InvalidSocket;
+    }
+
+    ConnectionStats Connection::GetStats() const {
+        ConnectionStats stats;
+        stats.requests = m_requests.load(std::memory_order_relaxed);
+        stats.reuses = m_reuses.load(std::memory_order_relaxed);
+        stats.connects = m_connects.load(std::memory_order_relaxed);
+        stats.failures = m_failures.load(std::memory_order_relaxed);
+        stats.lastLatencyUs = m_lastLatencyUs.load(std::memory_order_relaxed);
+        stats.maxLatencyUs = m_maxLatencyUs.load(std::memory_order_relaxed);
+        stats.totalLatencyUs = m_totalLatencyUs.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    std::string Connection::BuildRequest(const std::string& path) const {
+        std::string request;
+        request.reserve(128 + path.size());
+        request += "GET ";
+        request += path;
+        request += " HTTP/1.1\r\nHost: ";
+        request += m_host;
+        request += ':';
+        request += std::to_string(m_port);
+        request += "\r\nConnection: keep-alive\r\nAccept: */*\r\n\r\n";
+        return request;
+    }
+
+    void Connection::RecordSuccess(Clock::time_point start, bool reused) {
+        if (reused) m_reuses.fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t latencyUs = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+        m_lastLatencyUs.store(latencyUs, std::memory_order_relaxed);
+        m_totalLatencyUs.fetch_add(latencyUs, std::memory_order_relaxed);
+        UpdateMax(m_maxLatencyUs, latencyUs);
+    }
+
+    bool Connection::WaitSocket(bool forWrite, Clock::time_point deadline) {
+        #ifdef _WIN32
+        WSAPOLLFD pfd = {};
+        pfd.fd = m_socket;
+        pfd.events = forWrite ? POLLWRNORM : POLLRDNORM;
+        int result = WSAPoll(&pfd, 1, RemainingMs(deadline));
+        #else
+        pollfd pfd = {};
+        pfd.fd = m_socket;
+        pfd.events = forWrite ? POLLOUT : POLLIN;
+        int result;
+        do {
+            result = poll(&pfd, 1, RemainingMs(deadline));
+        } while (result < 0 && errno == EINTR);
+        #endif
+        if (result <= 0) return false;
+        // POLLHUP/POLLERR тоже считаем готовностью: ошибку вернёт следующий recv/send
+        return true;
+    }
+
+    // Адреса разрешаются один раз (localhost может дать и ::1, и 127.0.0.1)
+    bool Connection::ResolveAddresses() {
+        if (!m_addresses.empty()) return true;
+
+        addrinfo hints = {};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_protocol = IPPROTO_TCP;
+
+        addrinfo* addresses = nullptr;
+        std::string port = std::to_string(m_port);
+        if (getaddrinfo(m_host.c_str(), port.c_str(), &hints, &addresses) != 0 || !addresses) {
+            return false;
+        }
+
+        for (addrinfo* addr = addresses; addr; addr = addr->ai_next) {
+            Address address;
+            std::memcpy(&address.storage, addr->ai_addr, addr->ai_addrlen);
+            address.length = (int)addr->ai_addrlen;
+            address.family = addr->ai_family;
+            m_addresses.push_back(address);
+        }
+
+        freeaddrinfo(addresses);
+        return !m_addresses.empty();
+    }
+
+    // Неблокирующий connect: 1 - подключено, 0 - в процессе, -1 - ошибка
+    int Connection::StartConnect(size_t addressIndex) {
+        Close();
+        if (addressIndex >= m_addresses.size()) return -1;
+
+        const Address& address = m_addresses[addressIndex];
+        SocketHandle sock = socket(address.family, SOCK_STREAM, IPPROTO_TCP);
+        if (sock == InvalidSocket) return -1;
+
+        if (!SetNonBlocking(sock)) {
+            CloseSocket(sock);
+            return -1;
+        }
+
+        // Маленькие запросы - отправляем сразу без алгоритма Нейгла
+        int noDelay = 1;
+        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (const char*)&noDelay, sizeof(noDelay));
+
+        int result = connect(sock, (const sockaddr*)&address.storage, address.length);
+        if (result != 0 && !IsWouldBlock()) {
+            CloseSocket(sock);
+            return -1;
+        }
+
+        m_socket = sock;
+        if (result == 0) {
+            m_connects.fetch_add(1, std::memory_order_relaxed);
+            return 1;
+        }
+        return 0;
+    }
+
+    bool Connection::FinishConnect() {
+        int error = 0;
+        socklen_t len = sizeof(error);
+        if (getsockopt(m_socket, SOL_SOCKET, SO_ERROR, (char*)&error, &len) != 0 || error != 0) {
+            Close();
+            return false;
+        }
+        m_connects.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool Connection::Connect(Clock::time_point deadline) {
+        if (!ResolveAddresses()) return false;
+
+        for (size_t i = 0; i < m_addresses.size(); i++) {
+            int result = StartConnect(i);
+            if (result > 0) return true;
+            if (result < 0) continue;
+
+            // Ждём завершения неблокирующего connect
+            if (WaitSocket(true, deadline) && FinishConnect()) return true;
+            Close();
+        }
+        return false;
+    }
+
+    bool Connection::SendAll(const std::string& data, Clock::time_point deadline) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            int result = send(m_socket, data.data() + sent, (int)(data.size() - sent), 0);
+            if (result > 0) {
+                sent += (size_t)result;
+                continue;
+            }
+            if (result < 0 && IsWouldBlock()) {
+                if (!WaitSocket(true, deadline)) return false;
+                continue;
+            }
+            return false;
+        }
+        return true;
+    }
+
+    bool Connection::ReceiveResponse(ResponseReader& reader, Clock::time_point deadline) {
+        char buffer[16384];
+        while (!reader.IsDone() && !reader.IsError()) {
+            int received = recv(m_socket, buffer, sizeof(buffer), 0);
+            if (received > 0) {
+                reader.Feed(buffer, (size_t)received);
+                continue;
+            }
+            if (received == 0) {
+                reader.OnConnectionClosed();
+                break;
+            }
+            if (IsWouldBlock()) {
+                if (!WaitSocket(false, deadline)) return false;
+                continue;
+            }
+            return false;
+        }
+        return reader.IsDone();
+    }
+
+    bool Connection::TryGet(const std::string& request, Response& out, Clock::time_point deadline, bool& reused, bool& retryable) {
+        reused = IsOpen();
+        retryable = false;
+        if (!reused && !Connect(deadline)) {
+            return false;
+        }
+
+        if (!SendAll(request, deadline)) {
+            Close();
+            retryable = reused;
+            return false;
+        }
+
+        ResponseReader reader;
+        reader.SetBufferPool(m_bufferPool);
+        if (!ReceiveResponse(reader, deadline)) {
+            Close();
+            // Сервер закрыл простаивающее keep-alive соединение до ответа - можно повторить на новом
+            retryable = reused && !reader.HasStarted();
+            return false;
+        }
+
+        out = std::move(reader.GetResponse());
+        if (!out.keepAlive) {
+            Close();
+        }
+        return true;
+    }
+
+    bool Connection::Get(const std::string& path, Response& out, int timeoutMs) {
+        auto start = Clock::now();
+        auto deadline = start + std::chrono::milliseconds(timeoutMs);
+        std::string request = BuildRequest(path);
+
+        m_requests.fetch_add(1, std::memory_order_relaxed);
+
+        bool reused = false;
+        bool retryable = false;
+        bool ok = TryGet(request, out, deadline, reused, retryable);
+        if (!ok && retryable) {
+            // Устаревшее keep-alive соединение: одна повторная попытка на свежем сокете
+            ok = TryGet(request, out, deadline, reused, retryable);
+        }
+
+        if (!ok) {
+            m_failures.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        RecordSuccess(start, reused);
+        return true;
+    }
+
+    // ===== Асинхронный режим =====
+
+    bool Connection::AsyncConnectNext() {
+        while (m_addressIndex < m_addresses.size()) {
+            int result = StartConnect(m_addressIndex++);
+            if (result > 0) {
+                m_asyncState = AsyncState::Sending;
+                return true;
+            }
+            if (result == 0) {
+                m_asyncState = AsyncState::Connecting;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Connection::AsyncRestart() {
+        m_responses.clear();
+        ResetReader();
+        m_sendOffset = 0;
+        m_asyncReused = IsOpen();
+        if (m_asyncReused) {
+            m_asyncState = AsyncState::Sending;
+            return true;
+        }
+        if (!ResolveAddresses()) return false;
+        m_addressIndex = 0;
+        return AsyncConnectNext();
+    }
+
+    bool Connection::BeginGet(const std::string& path) {
+        return BeginBatch(std::vector<std::string>{ path });
+    }
+
+    // Все запросы пакета отправляются одной записью, ответы приходят по порядку (HTTP pipelining)
+    bool Connection::BeginBatch(const std::vector<std::string>& paths, const std::vector<BodyObserver*>& observers) {
+        m_asyncStart = Clock::now();
+        m_observers = observers;
+        m_sendBuffer.clear();
+        for (const auto& path : paths) {
+            m_sendBuffer += BuildRequest(path);
+        }
+        m_expectedResponses = paths.size();
+        m_asyncRetried = false;
+        m_requests.fetch_add(paths.size(), std::memory_order_relaxed);
+
+        if (!AsyncRestart()) {
+            FailAsync();
+            return false;
+        }
+        return true;
+    }
+
+    // Неполученные ответы пакета считаются ошибками
+    void Connection::FailAsync() {
+        Close();
+        m_asyncState = AsyncState::Idle;
+        if (m_expectedResponses > m_responses.size()) {
+            m_failures.fetch_add(m_expectedResponses - m_responses.size(), std::memory_order_relaxed);
+        }
+    }
+
+    void Connection::AbortAsync() {
+        if (m_asyncState != AsyncState::Idle) {
+            FailAsync();
+        }
+    }
+
+    // Устаревшее keep-alive соединение: одна повторная попытка на свежем сокете
+    Connection::AsyncResult Connection::RetryOrFail() {
+        Close();
+        if (m_asyncReused && !m_asyncRetried && m_responses.empty() && !m_reader.HasStarted()) {
+            m_asyncRetried = true;
+            if (AsyncRestart()) return AsyncResult::Pending;
+        }
+        FailAsync();
+        return AsyncResult::Failed;
+    }
+
+    // Следующий ответ пакета - со своим получателем тела
+    void Connection::ResetReader() {
+        m_reader.Reset();
+        size_t index = m_responses.size();
+        m_reader.SetBodyObserver(index < m_observers.size() ? m_observers[index] : nullptr);
+    }
+
+    // Разбор принятых байт: в одной порции может закончиться один ответ и начаться следующий
+    bool Connection::FeedResponses(const char* data, size_t size) {
+        size_t offset = 0;
+        while (offset < size && m_responses.size() < m_expectedResponses) {
+            offset += m_reader.Feed(data + offset, size - offset);
+            if (m_reader.IsError()) return false;
+            if (!m_reader.IsDone()) break;
+
+            bool keepAlive = m_reader.GetResponse().keepAlive;
+            m_responses.push_back(std::move(m_reader.GetResponse()));
+            ResetReader();
+            RecordSuccess(m_asyncStart, m_asyncReused);
+
+            // Сервер закрывает соединение - остальные ответы пакета не придут
+            if (!keepAlive) return m_responses.size() == m_expectedResponses;
+        }
+        return true;
+    }
+
+    Connection::AsyncResult Connection::OnSocketEvent(bool readable, bool writable, bool error) {
+        if (m_asyncState == AsyncState::Connecting) {
+            if (!writable && !error) return AsyncResult::Pending;
+            if (!FinishConnect()) {
+                // Пробуем следующий адрес
+                if (AsyncConnectNext()) return AsyncResult::Pending;
+                FailAsync();
+                return AsyncResult::Failed;
+            }
+            m_asyncState = AsyncState::Sending;
+            writable = true;
+        }
+
+        if (m_asyncState == AsyncState::Sending && (writable || error)) {
+            while (m_sendOffset < m_sendBuffer.size()) {
+                int result = send(m_socket, m_sendBuffer.data() + m_sendOffset, (int)(m_sendBuffer.size() - m_sendOffset), 0);
+                if (result > 0) {
+                    m_sendOffset += (size_t)result;
+                    continue;
+                }
+                if (result < 0 && IsWouldBlock()) return AsyncResult::Pending;
+                return RetryOrFail();
+            }
+            m_asyncState = AsyncState::Receiving;
+            // Ответ обычно ещё не пришёл - ждём готовности на чтение
+            return AsyncResult::Pending;
+        }
+
+        if (m_asyncState == AsyncState::Receiving && (readable || error)) {
+            char buffer[16384];
+            bool closed = false;
+            while (m_responses.size() < m_expectedResponses) {
+                int received = recv(m_socket, buffer, sizeof(buffer), 0);
+                if (received > 0) {
+                    if (!FeedResponses(buffer, (size_t)received)) return RetryOrFail();
+                    continue;
+                }
+                if (received == 0) {
+                    closed = true;
+                    m_reader.OnConnectionClosed();
+                    if (m_reader.IsDone()) {
+                        m_responses.push_back(std::move(m_reader.GetResponse()));
+                        ResetReader();
+                        RecordSuccess(m_asyncStart, m_asyncReused);
+                    }
+                    break;
+                }
+                if (IsWouldBlock()) return AsyncResult::Pending;
+                return RetryOrFail();
+            }
+
+            if (m_responses.size() < m_expectedResponses) return RetryOrFail();
+
+            if (closed || !m_responses.back().keepAlive) {
+                Close();
+            }
+            m_asyncState = AsyncState::Idle;
+            return AsyncResult::Completed;
+        }
+
+        return AsyncResult::Pending;
+    }
+
+    // ===== ConnectionPool =====
+
+    ConnectionPool::ConnectionPool(const std::string& host, uint16_t port, size_t size, std::shared_ptr<BufferPool> bufferPool) {
+        InitSockets();
+        if (size == 0) size = 1;
+        m_connections.reserve(size);
+        for (size_t i = 0; i < size; i++) {
+            m_connections.push_back(std::make_unique<Connection>(host, port));
+            m_connections.back()->SetBufferPool(bufferPool);
+        }
+        // Последний в векторе выдаётся первым
+        for (size_t i = size; i-- > 0;) {
+            m_idle.push_back(m_connections[i].get());
+        }
+    }
+
+    ConnectionPool::~ConnectionPool() {
+        m_connections.clear();
+        ShutdownSockets();
+    }
+
+    Connection* ConnectionPool::Acquire(std::chrono::steady_clock::time_point deadline) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_condition.wait_until(lock, deadline, [this] { return !m_idle.empty(); })) {
+            return nullptr;
+        }
+        Connection* connection = m_idle.back();
+        m_idle.pop_back();
+        return connection;
+    }
+
+    Connection* ConnectionPool::TryAcquire() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_idle.empty()) return nullptr;
+        Connection* connection = m_idle.back();
+        m_idle.pop_back();
+        return connection;
+    }
+
+    void ConnectionPool::Release(Connection* connection) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_idle.push_back(connection);
+        }
+        m_condition.notify_one();
+    }
+
+    bool ConnectionPool::Get(const std::string& path, Response& out, int timeoutMs) {
+        // Один срок на ожидание соединения и сам запрос
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        Connection* connection = Acquire(deadline);
+        if (!connection) return false;
+
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0) {
+            Release(connection);
+            return false;
+        }
+        bool ok = connection->Get(path, out, (int)remaining.count());
+        Release(connection);
+        return ok;
+    }
+
+    void ConnectionPool::CloseIdle() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (Connection* connection : m_idle) {
+            connection->Close();
+        }
+    }
+
+    std::vector<ConnectionStats> ConnectionPool::GetStats() const {
+        std::vector<ConnectionStats> stats;
+        stats.reserve(m_connections.size());
+        for (const auto& connection : m_connections) {
+            stats.push_back(connection->GetStats());
+        }
+        return stats;
+    }
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstddef>
+
+#include "BufferPool.h"
+#include "Hash.h"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#endif
+
+// Минимальный HTTP/1.1 клиент поверх сокетов (Windows + POSIX)
+// Держит постоянные keep-alive соединения к локальному API игры
+namespace Http {
+#ifdef _WIN32
+    using SocketHandle = SOCKET;
+    static constexpr SocketHandle InvalidSocket = INVALID_SOCKET;
+#else
+    using SocketHandle = int;
+    static constexpr SocketHandle InvalidSocket = -1;
+#endif
+
+    // Инициализация сетевого стека (WSAStartup на Windows, no-op на POSIX)
+    bool InitSockets();
+    void ShutdownSockets();
+    void CloseSocket(SocketHandle socket);
+    bool SetNonBlocking(SocketHandle socket);
+
+    // Ответ сервера (тело - буфер из пула, передаётся дальше перемещением)
+    struct Response {
+        int status = 0;
+        bool keepAlive = true;
+        PooledBuffer body;
+        uint64_t fingerprint = 0; // 64-битный хеш тела, считается при приёме
+    };
+
+    // Получатель тела ответа по мере приёма (вызывается потоком, читающим сокет)
+    // Тело после снятия chunked-кодирования, теми же порциями, что пришли из сокета
+    class BodyObserver {
+    public:
+        virtual ~BodyObserver() = default;
+        virtual void OnBodyBegin() = 0; // Заголовки приняты (в том числе перед пустым телом)
+        virtual void OnBodyData(const char* data, size_t size) = 0;
+    };
+
+    // Инкрементальный разбор ответа HTTP/1.1 (Content-Length, chunked, до закрытия)
+    class ResponseReader {
+    public:
+        // Тело длиннее - ответ ошибочный при любом способе передачи (Content-Length, chunked, до закрытия);
+        // тела localhost:8111 - килобайты и единицы мегабайт
+        static constexpr size_t MAX_CONTENT_LENGTH = 256 * 1024 * 1024;
+
+        ResponseReader() { Reset(); }
+
+        void Reset();
+
+        // Пул, из которого берутся буферы тел ответов (без пула - обычные строки)
+        void SetBufferPool(std::shared_ptr<BufferPool> pool) { m_bufferPool = std::move(pool); }
+
+        // Получатель тела текущего ответа (сбрасывается в Reset)
+        void SetBodyObserver(BodyObserver* observer) { m_observer = observer; }
+
+        // Передать очередную порцию байт из сокета, возвращает количество поглощённых байт
+        size_t Feed(const char* data, size_t size);
+
+        // Соединение закрыто сервером (завершает тело без Content-Length)
+        void OnConnectionClosed();
+
+        bool IsDone() const { return m_state == State::Done; }
+        bool IsError() const { return m_state == State::Error; }
+        bool HasStarted() const { return m_started; }
+
+        Response& GetResponse() { return m_response; }
+
+    private:
+        enum class State {
+            StatusLine,
+            Headers,
+            Body,
+            ChunkSize,
+            ChunkData,
+            ChunkDataEnd,
+            Trailers,
+            UntilClose,
+            Done,
+            Error
+        };
+
+        bool ReadLine(const char* data, size_t size, size_t& pos);
+        void OnStatusLine();
+        void OnHeaderLine();
+        void OnHeadersComplete();
+        bool OnChunkSizeLine();
+        bool AppendBody(const char* data, size_t size);
+
+        State m_state;
+        Response m_response;
+        std::shared_ptr<BufferPool> m_bufferPool;
+        BodyObserver* m_observer;
+        Hash64 m_bodyHash;
+        std::string m_line;
+        size_t m_contentLength;
+        size_t m_remaining;
+        size_t m_bodySize;
+        bool m_hasContentLength;
+        bool m_chunked;
+        bool m_started;
+    };
+
+    // Снимок счётчиков соединения (для отладки и сравнения с WinINet)
+    struct ConnectionStats {
+        uint64_t requests = 0;      // Всего запросов
+        uint64_t reuses = 0;        // Запросов по уже открытому сокету
+        uint64_t connects = 0;      // Установленных TCP соединений
+        uint64_t failures = 0;      // Неудачных запросов
+        uint64_t lastLatencyUs = 0; // Время последнего запроса (мкс)
+        uint64_t maxLatencyUs = 0;
+        uint64_t totalLatencyUs = 0;
+
+        double AverageLatencyMs() const {
+            uint64_t done = requests - failures;
+            return done > 0 ? (double)totalLatencyUs / (double)done / 1000.0 : 0.0;
+        }
+    };
+
+    // Одно постоянное соединение (используется одним потоком за раз)
+    class Connection {
+    public:
+        Connection(const std::string& host, uint16_t port);
+        ~Connection();
+
+        Connection(const Connection&) = delete;
+        Connection& operator=(const Connection&) = delete;
+
+        // Синхронный GET с общим таймаутом на весь запрос
+        bool Get(const std::string& path, Response& out, int timeoutMs);
+
+        // Асинхронный режим (неблокирующий сокет под управлением реактора)
+        enum class AsyncResult {
+            Pending,
+            Completed,
+            Failed
+        };
+
+        bool BeginGet(const std::string& path);
+        // Pipelining: все запросы одной записью; observers[i] (если есть) получает тело i-го ответа по мере приёма
+        bool BeginBatch(const std::vector<std::string>& paths, const std::vector<BodyObserver*>& observers = {});
+        AsyncResult OnSocketEvent(bool readable, bool writable, bool error);
+        void AbortAsync(); // Таймаут или остановка - соединение закрывается
+        bool WantsWrite() const { return m_asyncState == AsyncState::Connecting || m_asyncState == AsyncState::Sending; }
+        // Полученные ответы в порядке запросов (при ошибке - только успевшие прийти)
+        std::vector<Response>& GetAsyncResponses() { return m_responses; }
+
+        void SetBufferPool(std::shared_ptr<BufferPool> pool);
+
+        void Close();
+        bool IsOpen() const { return m_socket != InvalidSocket; }
+        SocketHandle GetSocket() const { return m_socket; }
+
+        ConnectionStats GetStats() const;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        enum class AsyncState {
+            Idle,
+            Connecting,
+            Sending,
+            Receiving
+        };
+
+        struct Address {
+            sockaddr_storage storage;
+            int length = 0;
+            int family = 0;
+        };
+
+        bool ResolveAddresses();
+        int StartConnect(size_t addressIndex);
+        bool FinishConnect();
+        bool Connect(Clock::time_point deadline);
+        bool SendAll(const std::string& data, Clock::time_point deadline);
+        bool ReceiveResponse(ResponseReader& reader, Clock::time_point deadline);
+        bool WaitSocket(bool forWrite, Clock::time_point deadline);
+        bool TryGet(const std::string& request, Response& out, Clock::time_point deadline, bool& reused, bool& retryable);
+        std::string BuildRequest(const std::string& path) const;
+        void RecordSuccess(Clock::time_point start, bool reused);
+
+        bool AsyncConnectNext();
+        bool AsyncRestart();
+        AsyncResult RetryOrFail();
+        bool FeedResponses(const char* data, size_t size);
+        void ResetReader();
+        void FailAsync();
+
+        std::string m_host;
+        uint16_t m_port;
+        SocketHandle m_socket;
+        std::vector<Address> m_addresses;
+        std::shared_ptr<BufferPool> m_bufferPool;
+
+        // Состояние асинхронного запроса
+        AsyncState m_asyncState;
+        size_t m_addressIndex;
+        std::string m_sendBuffer;
+        size_t m_sendOffset;
+        size_t m_expectedResponses;
+        ResponseReader m_reader;
+        std::vector<BodyObserver*> m_observers;
+        std::vector<Response> m_responses;
+        Clock::time_point m_asyncStart;
+        bool m_asyncReused;
+        bool m_asyncRetried;
+
+        std::atomic<uint64_t> m_requests;
+        std::atomic<uint64_t> m_reuses;
+        std::atomic<uint64_t> m_connects;
+        std::atomic<uint64_t> m_failures;
+        std::atomic<uint64_t> m_lastLatencyUs;
+        std::atomic<uint64_t> m_maxLatencyUs;
+        std::atomic<uint64_t> m_totalLatencyUs;
+    };
+
+    // Пул из N постоянных соединений к одному хосту
+    // Запросы из разных потоков идут параллельно, блокировка только на выдачу соединения
+    class ConnectionPool {
+    public:
+        ConnectionPool(const std::string& host, uint16_t port, size_t size, std::shared_ptr<BufferPool> bufferPool = nullptr);
+        ~ConnectionPool();
+
+        // timeoutMs - на весь запрос, включая ожидание свободного соединения
+        bool Get(const std::string& path, Response& out, int timeoutMs);
+
+        // Выдача соединения без ожидания (для реактора), nullptr если все заняты
+        Connection* TryAcquire();
+        void Release(Connection* connection);
+
+        // Закрыть все простаивающие соединения
+        void CloseIdle();
+
+        std::vector<ConnectionStats> GetStats() const;
+        size_t GetSize() const { return m_connections.size(); }
+
+    private:
+        Connection* Acquire(std::chrono::steady_clock::time_point deadline);
+
+        std::vector<std::unique_ptr<Connection>> m_connections;
+        std::vector<Connection*> m_idle; // LIFO: последним освобождённое (самое "тёплое") соединение выдаётся первым
+        mutable std::mutex m_mutex;
+        std::condition_variable m_condition;
+    };
+}
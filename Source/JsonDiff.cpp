@@ -0,0 +1,334 @@
+#include "JsonDiff.h"
+#include "JsonWriter.h"
+#include <chrono>
+#include <algorithm>
+#include <charconv>
+
+namespace Json {
+    // Проход по двум деревьям: текущий путь растёт и укорачивается вместе с рекурсией
+    class Differ {
+    public:
+        Differ(Patch& patch, std::string& path, std::vector<uint8_t>& matched)
+            : m_patch(patch), m_path(path), m_matched(matched), m_sink(patch.m_values), m_writer(m_sink) {}
+
+        void Compare(const Node& before, const Node& after) {
+            if (before.type() != after.type()) {
+                Emit(Change::Op::Replace, &after);
+                return;
+            }
+            switch (after.type()) {
+                case ValueType::Null:
+                    break;
+                case ValueType::Boolean:
+                    if (before.asBool() != after.asBool()) Emit(Change::Op::Replace, &after);
+                    break;
+                case ValueType::Number:
+                    if (before.asNumber() != after.asNumber()) Emit(Change::Op::Replace, &after);
+                    break;
+                case ValueType::String:
+                    if (before.asStringView() != after.asStringView()) Emit(Change::Op::Replace, &after);
+                    break;
+                case ValueType::Array:
+                    CompareArrays(before.items(), after.items());
+                    break;
+                case ValueType::Object:
+                    CompareObjects(before.members(), after.members());
+                    break;
+            }
+        }
+
+        void Finish() { m_writer.Flush(); }
+
+    private:
+        // Элементы с одинаковыми номерами; лишние в конце - добавления или удаления (с конца)
+        void CompareArrays(std::span<const Node> before, std::span<const Node> after) {
+            size_t length = m_path.size();
+            size_t common = std::min(before.size(), after.size());
+            for (size_t i = 0; i < common; i++) {
+                PushIndex(i);
+                Compare(before[i], after[i]);
+                m_path.resize(length);
+            }
+            for (size_t i = common; i < after.size(); i++) {
+                PushIndex(i);
+                Emit(Change::Op::Add, &after[i]);
+                m_path.resize(length);
+            }
+            for (size_t i = before.size(); i > common; i--) {
+                PushIndex(i - 1);
+                Emit(Change::Op::Remove, nullptr);
+                m_path.resize(length);
+            }
+        }
+
+        // Обычно ключи идут в том же порядке - сравнение по позиции, пока совпадают
+        // С первого расхождения остаток ищется по хешу ключа (с той же позиции по кругу)
+        void CompareObjects(std::span<const Member> before, std::span<const Member> after) {
+            size_t length = m_path.size();
+            size_t i = 0;
+            while (i < before.size() && i < after.size() && SameKey(before[i], after[i])) {
+                PushKey(after[i].key());
+                Compare(before[i].value, after[i].value);
+                m_path.resize(length);
+                i++;
+            }
+            if (i == before.size() && i == after.size()) return;
+
+            // Отметки найденных старых полей (область этого уровня в общем стеке)
+            size_t rest = before.size() - i;
+            size_t base = m_matched.size();
+            m_matched.resize(base + rest, 0);
+            for (size_t j = i; j < after.size(); j++) {
+                size_t found = SIZE_MAX;
+                for (size_t k = 0; k < rest; k++) {
+                    size_t candidate = (j - i + k) % rest;
+                    if (!m_matched[base + candidate] && SameKey(before[i + candidate], after[j])) {
+                        found = candidate;
+                        break;
+                    }
+                }
+                PushKey(after[j].key());
+                if (found != SIZE_MAX) {
+                    m_matched[base + found] = 1;
+                    Compare(before[i + found].value, after[j].value);
+                } else {
+                    Emit(Change::Op::Add, &after[j].value);
+                }
+                m_path.resize(length);
+            }
+            for (size_t k = 0; k < rest; k++) {
+                if (m_matched[base + k]) continue;
+                PushKey(before[i + k].key());
+                Emit(Change::Op::Remove, nullptr);
+                m_path.resize(length);
+            }
+            m_matched.resize(base);
+        }
+
+        static bool SameKey(const Member& a, const Member& b) {
+            return a.keyHash == b.keyHash && a.key() == b.key();
+        }
+
+        // Ключ в JSON Pointer: '~' -> "~0", '/' -> "~1"
+        void PushKey(std::string_view key) {
+            m_path += '/';
+            for (char c : key) {
+                if (c == '~') {
+                    m_path += "~0";
+                } else if (c == '/') {
+                    m_path += "~1";
+                } else {
+                    m_path += c;
+                }
+            }
+        }
+
+        void PushIndex(size_t index) {
+            char text[24];
+            std::to_chars_result result = std::to_chars(text, text + sizeof(text), index);
+            m_path += '/';
+            m_path.append(text, result.ptr);
+        }
+
+        void Emit(Change::Op op, const Node* value) {
+            Change change;
+            change.op = op;
+            change.pathOffset = (uint32_t)m_patch.m_paths.size();
+            change.pathSize = (uint32_t)m_path.size();
+            m_patch.m_paths += m_path;
+            if (value) {
+                // Значения идут в один поток писателя: смещение - число записанных байт
+                change.valueOffset = (uint32_t)m_writer.GetBytesWritten();
+                m_writer.Write(*value);
+                change.valueSize = (uint32_t)(m_writer.GetBytesWritten() - change.valueOffset);
+            }
+            m_patch.m_changes.push_back(change);
+        }
+
+        Patch& m_patch;
+        std::string& m_path;
+        std::vector<uint8_t>& m_matched;
+        StringSink m_sink;
+        Writer m_writer;
+    };
+
+    void Patch::Clear() {
+        m_changes.clear();
+        m_paths.clear();
+        m_values.clear();
+    }
+
+    void Patch::Write(Writer& writer) const {
+        static const char* const OP_NAMES[] = { "replace", "add", "remove" };
+        writer.BeginArray();
+        for (const Change& change : m_changes) {
+            writer.BeginObject();
+            writer.Key("op");
+            writer.String(OP_NAMES[(size_t)change.op]);
+            writer.Key("path");
+            writer.String(GetPath(change));
+            if (change.op != Change::Op::Remove) {
+                writer.Key("value");
+                writer.Raw(GetValue(change));
+            }
+            writer.EndObject();
+        }
+        writer.EndArray();
+    }
+
+    std::string Patch::ToString() const {
+        std::string result;
+        StringSink sink(result);
+        Writer writer(sink);
+        Write(writer);
+        writer.Flush();
+        return result;
+    }
+
+    void Diff(const Node& before, const Node& after, Patch& patch) {
+        // Рабочая память прохода (ёмкость сохраняется между вызовами)
+        thread_local std::string path;
+        thread_local std::vector<uint8_t> matched;
+        path.clear();
+        matched.clear();
+        patch.Clear();
+
+        Differ differ(patch, path, matched);
+        differ.Compare(before, after);
+        differ.Finish();
+    }
+
+    // ===== Применение к Value =====
+
+    namespace {
+        // Следующий шаг JSON Pointer из pointer (без '/'), с раскрытием ~0 и ~1; more - за ним есть ещё шаги
+        std::string NextSegment(std::string_view& pointer, bool& more) {
+            size_t end = pointer.find('/');
+            more = end != std::string_view::npos;
+            std::string_view raw = pointer.substr(0, end);
+            pointer = more ? pointer.substr(end + 1) : std::string_view();
+
+            std::string segment;
+            segment.reserve(raw.size());
+            for (size_t i = 0; i < raw.size(); i++) {
+                if (raw[i] == '~' && i + 1 < raw.size()) {
+                    segment += raw[++i] == '1' ? '/' : '~';
+                } else {
+                    segment += raw[i];
+                }
+            }
+            return segment;
+        }
+
+        bool ParseIndex(const std::string& segment, size_t& index) {
+            if (segment.empty()) return false;
+            std::from_chars_result result = std::from_chars(segment.data(), segment.data() + segment.size(), index);
+            return result.ec == std::errc() && result.ptr == segment.data() + segment.size();
+        }
+
+        std::shared_ptr<Value> ParseValue(std::string_view text) {
+            thread_local Document document;
+            if (!document.Parse(text.data(), text.size())) return nullptr;
+            return document.Root().toValue();
+        }
+
+        bool ApplyChange(Value& root, const Change& change, std::string_view pointer, std::string_view valueText) {
+            std::shared_ptr<Value> value;
+            if (change.op != Change::Op::Remove) {
+                value = ParseValue(valueText);
+                if (!value) return false;
+            }
+
+            // Пустой путь - сам корень
+            if (pointer.empty()) {
+                if (change.op == Change::Op::Remove) return false;
+                root = *value;
+                return true;
+            }
+            if (pointer[0] != '/') return false;
+            pointer.remove_prefix(1);
+
+            // Спуск до родителя последнего шага
+            Value* parent = &root;
+            bool more;
+            std::string segment = NextSegment(pointer, more);
+            while (more) {
+                Value* next = nullptr;
+                if (parent->isObject()) {
+                    auto it = parent->objectValue.find(segment);
+                    if (it != parent->objectValue.end()) next = it->second.get();
+                } else if (parent->isArray()) {
+                    size_t index;
+                    if (ParseIndex(segment, index) && index < parent->arrayValue.size()) next = parent->arrayValue[index].get();
+                }
+                if (!next) return false;
+                parent = next;
+                segment = NextSegment(pointer, more);
+            }
+
+            if (parent->isObject()) {
+                if (change.op == Change::Op::Remove) {
+                    return parent->objectValue.erase(segment) > 0;
+                }
+                if (change.op == Change::Op::Replace && parent->objectValue.find(segment) == parent->objectValue.end()) return false;
+                parent->objectValue[segment] = value;
+                return true;
+            }
+            if (parent->isArray()) {
+                std::vector<std::shared_ptr<Value>>& items = parent->arrayValue;
+                size_t index;
+                if (segment == "-" && change.op == Change::Op::Add) {
+                    index = items.size();
+                } else if (!ParseIndex(segment, index)) {
+                    return false;
+                }
+                switch (change.op) {
+                    case Change::Op::Replace:
+                        if (index >= items.size()) return false;
+                        items[index] = value;
+                        return true;
+                    case Change::Op::Add:
+                        if (index > items.size()) return false;
+                        items.insert(items.begin() + (ptrdiff_t)index, value);
+                        return true;
+                    case Change::Op::Remove:
+                        if (index >= items.size()) return false;
+                        items.erase(items.begin() + (ptrdiff_t)index);
+                        return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    bool ApplyPatch(Value& root, const Patch& patch) {
+        for (const Change& change : patch.Changes()) {
+            if (!ApplyChange(root, change, patch.GetPath(change), patch.GetValue(change))) return false;
+        }
+        return true;
+    }
+
+    // ===== Снимки канала =====
+
+    bool SnapshotDiff::Update(const char* data, size_t size) {
+        m_patch.Clear();
+        m_diffNs = 0;
+        // Новый снимок разбирается на место предпоследнего
+        size_t next = m_hasCurrent ? 1 - m_current : m_current;
+        if (!m_documents[next].Parse(data, size)) {
+            if (!m_hasCurrent) return false;
+            // Документ предыдущего снимка не тронут, но предпоследнего больше нет
+            m_hasPrevious = false;
+            return false;
+        }
+        if (m_hasCurrent) {
+            auto start = std::chrono::steady_clock::now();
+            Diff(m_documents[m_current].Root(), m_documents[next].Root(), m_patch);
+            m_diffNs = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            m_hasPrevious = true;
+        }
+        m_current = next;
+        m_hasCurrent = true;
+        return true;
+    }
+}
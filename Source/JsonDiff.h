@@ -0,0 +1,89 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+#include "JsonParser.h"
+
+// Разница между соседними снимками эндпоинта: список изменений вместо целого ответа
+// Сравнение - один проход по обоим документам: массивы по номерам элементов, объекты по ключам (хеши Json::Key)
+namespace Json {
+    class Writer;
+
+    // Одно изменение; путь - JSON Pointer ("/army/3/x"), значение - компактный текст JSON
+    struct Change {
+        enum class Op : uint8_t {
+            Replace, // Значение по пути заменено (в том числе на другой тип)
+            Add,     // Новый ключ объекта или элемент в конце массива
+            Remove   // Ключ или элемент удалён (значения нет)
+        };
+
+        Op op = Op::Replace;
+        uint32_t pathOffset = 0;
+        uint32_t pathSize = 0;
+        uint32_t valueOffset = 0;
+        uint32_t valueSize = 0;
+    };
+
+    // Список изменений; тексты путей и значений лежат в двух буферах (ёмкость сохраняется между Diff)
+    // Изменения применяются по порядку: удаления элементов массива идут с конца
+    class Patch {
+    public:
+        void Clear();
+        bool Empty() const { return m_changes.empty(); }
+        size_t Size() const { return m_changes.size(); }
+        std::span<const Change> Changes() const { return m_changes; }
+
+        std::string_view GetPath(const Change& change) const {
+            return std::string_view(m_paths.data() + change.pathOffset, change.pathSize);
+        }
+        std::string_view GetValue(const Change& change) const {
+            return std::string_view(m_values.data() + change.valueOffset, change.valueSize);
+        }
+
+        // Запись в формате JSON Patch (RFC 6902): [{"op":"replace","path":"/a","value":1}, ...]
+        void Write(Writer& writer) const;
+        std::string ToString() const;
+
+    private:
+        friend class Differ;
+
+        std::vector<Change> m_changes;
+        std::string m_paths;
+        std::string m_values;
+    };
+
+    // Изменения, превращающие before в after (patch очищается)
+    void Diff(const Node& before, const Node& after, Patch& patch);
+
+    // Применение к дереву Value (получатели, которым нужен изменяемый снимок)
+    // false - путь не найден или значение не разобрано; изменения до ошибки уже применены
+    bool ApplyPatch(Value& root, const Patch& patch);
+
+    // Два последних снимка канала: каждый новый ответ разбирается и сравнивается с предыдущим
+    // Документы чередуются, память арен переиспользуется
+    class SnapshotDiff {
+    public:
+        // false - ответ не разобран (предыдущий снимок остаётся, патч пуст)
+        // Первый снимок даёт пустой патч (HasPrevious() == false)
+        bool Update(const char* data, size_t size);
+        bool Update(const std::string& json) { return Update(json.data(), json.size()); }
+
+        bool HasPrevious() const { return m_hasPrevious; }
+        const Patch& GetPatch() const { return m_patch; }
+        const Document& Current() const { return m_documents[m_current]; }
+        uint64_t GetDiffNs() const { return m_diffNs; } // Время последнего сравнения (без разбора)
+
+    private:
+        Document m_documents[2];
+        size_t m_current = 0;
+        bool m_hasCurrent = false;
+        bool m_hasPrevious = false;
+        uint64_t m_diffNs = 0;
+        Patch m_patch;
+    };
+}
@@ -0,0 +1,238 @@
+#include "JsonIndex.h"
+#include <bit>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define JSON_INDEX_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define JSON_INDEX_SSE2
+#endif
+
+namespace Json {
+    namespace {
+        // Маски одного 64-байтного блока: бит i - байт i блока
+        struct BlockMasks {
+            uint64_t quote = 0;
+            uint64_t backslash = 0;
+            uint64_t whitespace = 0; // Пробел, \t, \n, \r
+            uint64_t structural = 0; // { } [ ] : ,
+        };
+
+        // Скалярный вариант (ARM и прочие; в векторных сборках - для сверки): класс байта из таблицы
+        // Для NEON достаточно своей Classify - остальной проход общий
+        enum : uint8_t {
+            CLASS_QUOTE = 1,
+            CLASS_BACKSLASH = 2,
+            CLASS_WHITESPACE = 4,
+            CLASS_STRUCTURAL = 8
+        };
+
+        struct ClassTable {
+            uint8_t classes[256] = {};
+
+            constexpr ClassTable() {
+                classes[(unsigned char)'"'] = CLASS_QUOTE;
+                classes[(unsigned char)'\\'] = CLASS_BACKSLASH;
+                classes[(unsigned char)' '] = CLASS_WHITESPACE;
+                classes[(unsigned char)'\t'] = CLASS_WHITESPACE;
+                classes[(unsigned char)'\n'] = CLASS_WHITESPACE;
+                classes[(unsigned char)'\r'] = CLASS_WHITESPACE;
+                for (char c : { '{', '}', '[', ']', ':', ',' }) {
+                    classes[(unsigned char)c] = CLASS_STRUCTURAL;
+                }
+            }
+        };
+
+        constexpr ClassTable g_classTable;
+
+        BlockMasks ClassifyScalar(const char* block) {
+            BlockMasks masks;
+            for (int i = 0; i < 64; i++) {
+                uint8_t byteClass = g_classTable.classes[(unsigned char)block[i]];
+                if (byteClass == 0) continue;
+                uint64_t bit = 1ull << i;
+                if (byteClass & CLASS_QUOTE) masks.quote |= bit;
+                if (byteClass & CLASS_BACKSLASH) masks.backslash |= bit;
+                if (byteClass & CLASS_WHITESPACE) masks.whitespace |= bit;
+                if (byteClass & CLASS_STRUCTURAL) masks.structural |= bit;
+            }
+            return masks;
+        }
+
+#if defined(JSON_INDEX_AVX2)
+        inline uint64_t Equal(__m256i chunk, char c) {
+            return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(c)));
+        }
+
+        BlockMasks Classify(const char* block) {
+            BlockMasks masks;
+            for (int half = 0; half < 2; half++) {
+                __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + half * 32));
+                // '[' | 0x20 == '{', ']' | 0x20 == '}': две скобки одним сравнением
+                __m256i folded = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+                int shift = half * 32;
+                masks.quote |= Equal(chunk, '"') << shift;
+                masks.backslash |= Equal(chunk, '\\') << shift;
+                masks.whitespace |= (Equal(chunk, ' ') | Equal(chunk, '\t') | Equal(chunk, '\n') | Equal(chunk, '\r')) << shift;
+                masks.structural |= (Equal(folded, '{') | Equal(folded, '}') | Equal(chunk, ':') | Equal(chunk, ',')) << shift;
+            }
+            return masks;
+        }
+#elif defined(JSON_INDEX_SSE2)
+        inline uint64_t Equal(__m128i chunk, char c) {
+            return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(c)));
+        }
+
+        BlockMasks Classify(const char* block) {
+            BlockMasks masks;
+            for (int part = 0; part < 4; part++) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + part * 16));
+                // '[' | 0x20 == '{', ']' | 0x20 == '}': две скобки одним сравнением
+                __m128i folded = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+                int shift = part * 16;
+                masks.quote |= Equal(chunk, '"') << shift;
+                masks.backslash |= Equal(chunk, '\\') << shift;
+                masks.whitespace |= (Equal(chunk, ' ') | Equal(chunk, '\t') | Equal(chunk, '\n') | Equal(chunk, '\r')) << shift;
+                masks.structural |= (Equal(folded, '{') | Equal(folded, '}') | Equal(chunk, ':') | Equal(chunk, ',')) << shift;
+            }
+            return masks;
+        }
+#else
+        BlockMasks Classify(const char* block) {
+            return ClassifyScalar(block);
+        }
+#endif
+
+        // Байты после нечётной серии '\' (экранированные); серия может продолжаться из прошлого блока
+        // '\' в ответах игры редки, поэтому обычный цикл по битам дешевле полной битовой арифметики
+        inline uint64_t FindEscaped(uint64_t backslash, bool& escapeNext) {
+            uint64_t escaped = 0;
+            if (escapeNext) {
+                escaped = 1;
+                backslash &= ~1ull;
+                escapeNext = false;
+            }
+            while (backslash) {
+                int bit = std::countr_zero(backslash);
+                if (bit == 63) {
+                    escapeNext = true;
+                    break;
+                }
+                escaped |= 2ull << bit;
+                backslash &= ~(3ull << bit); // Экранированный '\' не начинает новую серию
+            }
+            return escaped;
+        }
+
+        // Префиксный XOR: бит i - чётность кавычек в позициях 0..i (1 - внутри строки)
+        inline uint64_t PrefixXor(uint64_t bits) {
+            bits ^= bits << 1;
+            bits ^= bits << 2;
+            bits ^= bits << 4;
+            bits ^= bits << 8;
+            bits ^= bits << 16;
+            bits ^= bits << 32;
+            return bits;
+        }
+
+        // Проход по блокам: позиции токенов в out (count - их число); true - вход закончился внутри строки
+        template <BlockMasks (*ClassifyBlock)(const char*)>
+        bool ScanBlocks(const char* data, size_t size, bool startsInString, uint32_t* out, size_t& count) {
+            uint32_t* first = out;
+            uint64_t inStringCarry = startsInString ? ~0ull : 0; // Все единицы, если прошлый блок закончился внутри строки
+            uint64_t scalarCarry = 0;   // Прошлый блок закончился внутри числа или литерала
+            bool escapeNext = false;
+
+            for (size_t offset = 0; offset < size; offset += 64) {
+                BlockMasks masks;
+                if (size - offset >= 64) {
+                    masks = ClassifyBlock(data + offset);
+                } else {
+                    // Хвост дополняется пробелами до целого блока
+                    char tail[64];
+                    std::memset(tail, ' ', sizeof(tail));
+                    std::memcpy(tail, data + offset, size - offset);
+                    masks = ClassifyBlock(tail);
+                }
+
+                uint64_t escaped = masks.backslash || escapeNext ? FindEscaped(masks.backslash, escapeNext) : 0;
+                uint64_t quotes = masks.quote & ~escaped;
+                // Открывающая кавычка и текст строки - единицы, закрывающая - ноль
+                uint64_t inString = PrefixXor(quotes) ^ inStringCarry;
+                inStringCarry = (uint64_t)((int64_t)inString >> 63);
+
+                uint64_t structural = masks.structural & ~inString;
+                // Остальные байты вне строк: числа, литералы и всё недопустимое
+                uint64_t scalar = ~(masks.whitespace | masks.structural | masks.quote | inString);
+                uint64_t scalarStarts = scalar & ~((scalar << 1) | scalarCarry);
+                scalarCarry = scalar >> 63;
+
+                uint64_t tokens = structural | quotes | scalarStarts;
+                while (tokens) {
+                    *out++ = (uint32_t)(offset + std::countr_zero(tokens));
+                    tokens &= tokens - 1;
+                }
+            }
+
+            count = out - first;
+            return inStringCarry != 0;
+        }
+    }
+
+    bool StructuralIndex::Build(const char* data, size_t size) {
+        m_count = 0;
+        if (size > MAX_INPUT_SIZE) return false;
+        return !Scan(data, size, false, false);
+    }
+
+    bool StructuralIndex::BuildScalar(const char* data, size_t size) {
+        m_count = 0;
+        if (size > MAX_INPUT_SIZE) return false;
+        return !Scan(data, size, false, true);
+    }
+
+    bool StructuralIndex::BuildPart(const char* data, size_t size, bool startsInString) {
+        m_count = 0;
+        return Scan(data, size, startsInString, false);
+    }
+
+    void StructuralIndex::Resize(size_t count) {
+        if (m_capacity < count) {
+            m_positions.reset(new uint32_t[count]);
+            m_capacity = count;
+        }
+        m_count = count;
+    }
+
+    void StructuralIndex::CopyFrom(size_t first, const StructuralIndex& part, uint32_t offset) {
+        uint32_t* out = m_positions.get() + first;
+        const uint32_t* positions = part.Positions();
+        for (size_t i = 0; i < part.Count(); i++) {
+            out[i] = positions[i] + offset;
+        }
+    }
+
+    bool StructuralIndex::Scan(const char* data, size_t size, bool startsInString, bool scalar) {
+        // Каждый байт даёт не больше одной позиции
+        if (m_capacity < size) {
+            m_positions.reset(new uint32_t[size]);
+            m_capacity = size;
+        }
+
+        return scalar
+            ? ScanBlocks<ClassifyScalar>(data, size, startsInString, m_positions.get(), m_count)
+            : ScanBlocks<Classify>(data, size, startsInString, m_positions.get(), m_count);
+    }
+
+    const char* StructuralIndex::GetImplementation() {
+#if defined(JSON_INDEX_AVX2)
+        return "AVX2";
+#elif defined(JSON_INDEX_SSE2)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+}
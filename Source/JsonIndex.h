@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+// Первый проход разбора JSON: позиции всех токенов документа за один векторный проход
+// Вход обрабатывается блоками по 64 байта: маски кавычек, '\', пробелов и структурных символов
+// (SSE2/AVX2, иначе скалярно), затем битовыми операциями отсекается содержимое строк
+// Второй проход (DocumentBuilder) идёт по готовым позициям, не просматривая пробелы и тексты строк
+namespace Json {
+    class StructuralIndex {
+    public:
+        // Индекс в одном массиве не больше 4 ГБ входа (позиции 32-битные)
+        static constexpr size_t MAX_INPUT_SIZE = 0xFFFFFFFFu;
+
+        StructuralIndex() = default;
+        StructuralIndex(const StructuralIndex&) = delete;
+        StructuralIndex& operator=(const StructuralIndex&) = delete;
+
+        // В индекс попадают: {}[]:, вне строк, обе кавычки каждой строки и начало каждого
+        // другого токена (число, литерал или мусор) - всё, что лежит между ними, пробелы
+        // Возвращает false, если последняя строка не закрыта или вход слишком большой
+        bool Build(const char* data, size_t size);
+
+        // Тот же проход со скалярной классификацией блоков в любой сборке (сверка с векторной, бенчмарк)
+        bool BuildScalar(const char* data, size_t size);
+
+        // Первый проход по части входа (параллельный разбор): позиции - от начала части
+        // Часть может начинаться внутри строки (startsInString), но не сразу после '\' или внутри числа/литерала
+        // Возвращает состояние в конце части: true - незакрытая строка
+        bool BuildPart(const char* data, size_t size, bool startsInString);
+
+        // Сборка индекса из частей: Resize под общее число позиций, затем CopyFrom каждой части
+        // (разные части можно копировать из разных потоков)
+        void Resize(size_t count);
+        void CopyFrom(size_t first, const StructuralIndex& part, uint32_t offset);
+
+        const uint32_t* Positions() const { return m_positions.get(); }
+        size_t Count() const { return m_count; }
+
+        // Реализация первого прохода в этой сборке ("AVX2", "SSE2" или "scalar")
+        static const char* GetImplementation();
+
+    private:
+        bool Scan(const char* data, size_t size, bool startsInString, bool scalar);
+
+        std::unique_ptr<uint32_t[]> m_positions; // Ёмкость сохраняется между разборами
+        size_t m_capacity = 0;
+        size_t m_count = 0;
+    };
+}
@@ -0,0 +1,74 @@
+#include "JsonLines.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Json {
+    namespace {
+        bool IsBlank(const char* data, size_t size) {
+            for (size_t i = 0; i < size; i++) {
+                char c = data[i];
+                if (c != ' ' && c != '\t' && c != '\r') return false;
+            }
+            return true;
+        }
+    }
+
+    LinesResult ParseLines(const std::string& path, const LineCallback& callback, size_t windowBytes) {
+        LinesResult result;
+        MappedFile file;
+        if (!file.Open(path)) {
+            result.error = "Failed to open file: " + path;
+            return result;
+        }
+
+        Document document;
+        size_t window = std::max(windowBytes, MappedFile::Granularity());
+        uint64_t offset = 0; // Начало первой неразобранной строки
+        uint64_t lineNumber = 0;
+        bool stopped = false;
+        while (offset < file.Size() && !stopped) {
+            if (!file.Map(offset, window)) {
+                result.error = "Failed to map file: " + path;
+                return result;
+            }
+            result.maxWindowBytes = std::max(result.maxWindowBytes, file.MappedSize());
+
+            const char* begin = file.Data();
+            const char* end = begin + file.MappedSize();
+            bool last = offset + file.MappedSize() == file.Size();
+            const char* cursor = begin;
+            while (cursor < end) {
+                const char* newline = (const char*)std::memchr(cursor, '\n', (size_t)(end - cursor));
+                if (!newline) {
+                    if (!last) break; // Конец строки - в следующем окне
+                    newline = end;
+                }
+                lineNumber++;
+                size_t size = (size_t)(newline - cursor);
+                if (!IsBlank(cursor, size)) {
+                    bool success = document.ParseBorrowed(cursor, size);
+                    result.lines++;
+                    if (!success) result.failed++;
+                    result.maxLineBytes = std::max(result.maxLineBytes, size);
+                    if (!callback(document, lineNumber, success)) {
+                        stopped = true;
+                        cursor = newline;
+                        break;
+                    }
+                }
+                cursor = newline + (newline < end ? 1 : 0);
+            }
+
+            if (cursor == begin && !stopped) {
+                window *= 2; // Строка длиннее окна
+                continue;
+            }
+            offset += (uint64_t)(cursor - begin);
+        }
+
+        result.bytes = offset;
+        result.success = true;
+        return result;
+    }
+}
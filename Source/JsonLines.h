@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+#include "JsonParser.h"
+
+// NDJSON (JSON Lines) - файлы записи сессий: по документу на строку
+// Файл читается окнами MappedFile, строки разбираются на месте (Document::ParseBorrowed)
+// Память ограничена окном и самой длинной строкой: одна арена Document на весь файл
+namespace Json {
+    constexpr size_t DEFAULT_LINE_WINDOW = 64 * 1024 * 1024;
+
+    struct LinesResult {
+        bool success = false;     // Файл прочитан до конца или остановлен обработчиком
+        uint64_t lines = 0;       // Разобрано строк (пустые не считаются)
+        uint64_t failed = 0;      // Из них с ошибкой разбора
+        uint64_t bytes = 0;       // Прочитано байт файла
+        size_t maxLineBytes = 0;
+        size_t maxWindowBytes = 0; // Окно растёт, только если строка длиннее окна
+        std::string error;        // Файл не открыт или не отображён
+    };
+
+    // Обработчик строки - Json::LineCallback (JsonParser.h)
+    LinesResult ParseLines(const std::string& path, const LineCallback& callback, size_t windowBytes = DEFAULT_LINE_WINDOW);
+}
@@ -1,14 +1,24 @@
 #include "JsonParser.h"
-#include <fstream>
-#include <sstream>
+#include "JsonWriter.h"
+#include "JsonLines.h"
+#include "MappedFile.h"
+#include "ThreadPlacement.h"
+#include "Utf8.h"
 #include <algorithm>
 #include <cctype>
 #include <condition_variable>
-#ifdef _WIN32
-#include <windows.h>
-#endif
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <charconv>
 
 namespace Json {
+    namespace {
+        // Общий результат промахов Value::operator[] (раньше - make_shared на каждый промах)
+        const std::shared_ptr<Value> g_nullValue = std::make_shared<Value>();
+    }
+    
     Value::Value() : type(ValueType::Null) {}
     
     Value::Value(bool val) : type(ValueType::Boolean), boolValue(val) {}
@@ -30,11 +40,9 @@ namespace Json {
         if (type == ValueType::Number) return numberValue;
         if (type == ValueType::Boolean) return boolValue ? 1.0 : 0.0;
         if (type == ValueType::String) {
-            try {
-                return std::stod(stringValue);
-            } catch (...) {
-                return 0.0;
-            }
+            double result = 0.0;
+            ParseNumber(stringValue.data(), stringValue.data() + stringValue.size(), result);
+            return result;
         }
         return 0.0;
     }
@@ -51,7 +59,7 @@ namespace Json {
         if (type == ValueType::Array && index < arrayValue.size()) {
             return arrayValue[index];
         }
-        return std::make_shared<Value>();
+        return g_nullValue;
     }
     
     std::shared_ptr<Value> Value::operator[](const std::string& key) const {
@@ -61,333 +69,1149 @@ namespace Json {
                 return it->second;
             }
         }
-        return std::make_shared<Value>();
+        return g_nullValue;
     }
     
     std::string Value::toString(int indent) const {
-        std::string indentStr(indent * 2, ' ');
-        std::string nextIndentStr((indent + 1) * 2, ' ');
+        return ToString(*this, Writer::Style::Pretty, indent);
+    }
+    
+    // ===== Числа =====
+    
+    bool ParseNumber(const char* begin, const char* end, double& out) {
+        auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
         
-        switch (type) {
-            case ValueType::Null:
-                return "null";
+        // Проверка грамматики: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+        const char* p = begin;
+        bool negative = p < end && *p == '-';
+        if (negative) p++;
+        const char* digits = p;
+        uint64_t mantissa = 0;
+        if (p < end && *p == '0') {
+            p++;
+        } else {
+            while (p < end && isDigit(*p)) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                p++;
+            }
+        }
+        size_t integerDigits = p - digits;
+        if (integerDigits == 0) return false;
+        
+        bool integer = true;
+        bool negativeExponent = false;
+        if (p < end && *p == '.') {
+            integer = false;
+            const char* fraction = ++p;
+            while (p < end && isDigit(*p)) p++;
+            if (p == fraction) return false;
+        }
+        if (p < end && (*p == 'e' || *p == 'E')) {
+            integer = false;
+            p++;
+            if (p < end && (*p == '+' || *p == '-')) {
+                negativeExponent = *p == '-';
+                p++;
+            }
+            const char* exponent = p;
+            while (p < end && isDigit(*p)) p++;
+            if (p == exponent) return false;
+        }
+        if (p != end) return false;
+        
+        // Целое до 15 цифр точно представимо в double - без from_chars (координаты, id, счётчики)
+        if (integer && integerDigits <= 15) {
+            out = negative ? -(double)mantissa : (double)mantissa;
+            return true;
+        }
+        
+        double value = 0.0;
+        std::from_chars_result result = std::from_chars(begin, end, value);
+        if (result.ec == std::errc::result_out_of_range) {
+            // Как strtod: переполнение - бесконечность, потеря значимости - ноль
+            value = negativeExponent ? 0.0 : HUGE_VAL;
+            out = negative ? -value : value;
+            return true;
+        }
+        if (result.ec != std::errc() || result.ptr != end) return false;
+        out = value;
+        return true;
+    }
+    
+    // ===== Arena =====
+    
+    void Arena::AddBlock(size_t minSize) {
+        Block block;
+        block.size = std::max(minSize, MIN_BLOCK_SIZE);
+        block.data.reset(new char[block.size]);
+        m_blocks.push_back(std::move(block));
+        m_allocations++;
+    }
+    
+    void* Arena::Allocate(size_t size, size_t align) {
+        while (true) {
+            if (m_current < m_blocks.size()) {
+                Block& block = m_blocks[m_current];
+                size_t offset = (m_offset + align - 1) & ~(align - 1);
+                if (offset + size <= block.size) {
+                    m_offset = offset + size;
+                    m_used += size;
+                    m_peakUsed = std::max(m_peakUsed, m_used);
+                    return block.data.get() + offset;
+                }
+                // Блок закончился - следующий уже выделенный или новый (в два раза больше последнего)
+                m_current++;
+                m_offset = 0;
+                if (m_current < m_blocks.size()) continue;
+            }
+            size_t lastSize = m_blocks.empty() ? 0 : m_blocks.back().size;
+            AddBlock(std::max(lastSize * 2, size + align));
+            m_current = m_blocks.size() - 1;
+            m_offset = 0;
+        }
+    }
+    
+    void Arena::Reset() {
+        // Документ не поместился в один блок - в следующий раз поместится (один malloc на прогреве)
+        if (m_blocks.size() > 1) {
+            size_t total = 0;
+            for (const Block& block : m_blocks) total += block.size;
+            m_blocks.clear();
+            AddBlock(total);
+        }
+        m_current = 0;
+        m_offset = 0;
+        m_used = 0;
+    }
+    
+    Arena::Stats Arena::GetStats() const {
+        Stats stats;
+        stats.blocks = m_blocks.size();
+        for (const Block& block : m_blocks) stats.capacity += block.size;
+        stats.used = m_used;
+        stats.peakUsed = m_peakUsed;
+        stats.allocations = m_allocations;
+        return stats;
+    }
+    
+    // ===== Node =====
+    
+    namespace {
+        const Node g_nullNode;
+    }
+    
+    namespace {
+        int HexDigit(char c) {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        }
+        
+        // Четыре шестнадцатеричные цифры \uXXXX
+        bool ParseHex4(const char* text, uint32_t& out) {
+            uint32_t value = 0;
+            for (int i = 0; i < 4; i++) {
+                int digit = HexDigit(text[i]);
+                if (digit < 0) return false;
+                value = (value << 4) | (uint32_t)digit;
+            }
+            out = value;
+            return true;
+        }
+        
+        // Участок без escape-последовательностей
+        size_t CopyRun(const char* data, size_t size, char* out, bool validUtf8) {
+            if (!validUtf8) return Utf8::Repair(data, size, out);
+            if (size > 0) std::memcpy(out, data, size);
+            return size;
+        }
+    }
+    
+    size_t FindInvalidEscape(const char* raw, size_t size) {
+        size_t i = 0;
+        while (i < size) {
+            const char* slash = static_cast<const char*>(std::memchr(raw + i, '\\', size - i));
+            if (!slash) return size;
+            i = (size_t)(slash - raw);
+            if (i + 1 >= size) return i;
+            switch (raw[i + 1]) {
+                case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+                    i += 2;
+                    break;
+                case 'u': {
+                    uint32_t codepoint;
+                    if (i + 6 > size || !ParseHex4(raw + i + 2, codepoint)) return i;
+                    i += 6;
+                    break;
+                }
+                default:
+                    return i;
+            }
+        }
+        return size;
+    }
+    
+    // Участки между '\' копируются целиком (поиск - memchr)
+    // \uXXXX (6 байт) даёт не больше 3 байт UTF-8, пара суррогатов (12) - 4, поэтому без неверных байт результат не длиннее входа
+    size_t DecodeEscapes(const char* raw, size_t size, char* out, bool validUtf8) {
+        size_t length = 0;
+        size_t i = 0;
+        while (i < size) {
+            const char* slash = static_cast<const char*>(std::memchr(raw + i, '\\', size - i));
+            size_t runEnd = slash ? (size_t)(slash - raw) : size;
+            length += CopyRun(raw + i, runEnd - i, out + length, validUtf8);
+            i = runEnd;
+            if (i >= size) break;
+            if (i + 1 >= size) {
+                out[length++] = '\\';
+                break;
+            }
+            
+            char c = raw[i + 1];
+            i += 2;
+            switch (c) {
+                case 'n': out[length++] = '\n'; break;
+                case 't': out[length++] = '\t'; break;
+                case 'r': out[length++] = '\r'; break;
+                case 'b': out[length++] = '\b'; break;
+                case 'f': out[length++] = '\f'; break;
+                case 'u': {
+                    uint32_t codepoint;
+                    if (i + 4 > size || !ParseHex4(raw + i, codepoint)) {
+                        // Не escape по грамматике: как раньше, остаётся буква (U+FFFD длиннее "\\u")
+                        out[length++] = c;
+                        break;
+                    }
+                    i += 4;
+                    if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                        // Старший суррогат: точка целиком только вместе со следующим \uDC00..\uDFFF
+                        uint32_t low;
+                        if (i + 6 <= size && raw[i] == '\\' && raw[i + 1] == 'u' && ParseHex4(raw + i + 2, low) && low >= 0xDC00 && low <= 0xDFFF) {
+                            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                            i += 6;
+                        }
+                    }
+                    // Одиночные суррогаты Encode заменяет на U+FFFD
+                    length += Utf8::Encode(codepoint, out + length);
+                    break;
+                }
+                default: out[length++] = c; break;
+            }
+        }
+        return length;
+    }
+    
+    const Node& Node::Null() {
+        return g_nullNode;
+    }
+    
+    bool Node::asBool() const {
+        if (m_type == ValueType::Boolean) return m_bool;
+        if (m_type == ValueType::Number) return m_payload.number != 0.0;
+        if (m_type == ValueType::String) return m_size > 0;
+        return false;
+    }
+    
+    double Node::asNumber() const {
+        if (m_type == ValueType::Number) return m_payload.number;
+        if (m_type == ValueType::Boolean) return m_bool ? 1.0 : 0.0;
+        if (m_type == ValueType::String) {
+            std::string_view text = asStringView();
+            double result = 0.0;
+            ParseNumber(text.data(), text.data() + text.size(), result);
+            return result;
+        }
+        return 0.0;
+    }
+    
+    std::string Node::asString() const {
+        if (m_type == ValueType::String) {
+            if (!m_escaped) return std::string(asStringView());
+            bool valid = Utf8::IsValid(m_payload.string, m_size);
+            std::string result(DecodedCapacity(m_size, valid), '\0');
+            result.resize(DecodeEscapes(m_payload.string, m_size, result.data(), valid));
+            return result;
+        }
+        if (m_type == ValueType::Number) return std::to_string(m_payload.number);
+        if (m_type == ValueType::Boolean) return m_bool ? "true" : "false";
+        if (m_type == ValueType::Null) return "null";
+        return "";
+    }
+    
+    std::string_view Node::asStringView() const {
+        if (m_type != ValueType::String) return std::string_view();
+        return std::string_view(m_inline ? m_payload.inlineString : m_payload.string, m_size);
+    }
+    
+    std::span<const Node> Node::items() const {
+        if (m_type != ValueType::Array || m_size == 0) return {};
+        return std::span<const Node>(m_payload.items, m_size);
+    }
+    
+    std::span<const Member> Node::members() const {
+        if (m_type != ValueType::Object || m_size == 0) return {};
+        return std::span<const Member>(m_payload.members, m_size);
+    }
+    
+    const Node& Node::operator[](size_t index) const {
+        if (m_type == ValueType::Array && index < m_size) return m_payload.items[index];
+        return g_nullNode;
+    }
+    
+    const Member* Node::find(const Key& key) const {
+        if (m_type != ValueType::Object) return nullptr;
+        // Последнее вхождение ключа (как при записи в std::map у Value), строки сравниваются только при совпадении хеша
+        for (size_t i = m_size; i > 0; i--) {
+            const Member& member = m_payload.members[i - 1];
+            if (member.keyHash == key.hash && member.key() == key.name) return &member;
+        }
+        return nullptr;
+    }
+    
+    const Node& Node::operator[](const Key& key) const {
+        const Member* member = find(key);
+        return member ? member->value : g_nullNode;
+    }
+    
+    std::string Node::toString(int indent) const {
+        return ToString(*this, Writer::Style::Pretty, indent);
+    }
+    
+    std::shared_ptr<Value> Node::toValue() const {
+        switch (m_type) {
             case ValueType::Boolean:
-                return boolValue ? "true" : "false";
+                return std::make_shared<Value>(m_bool);
             case ValueType::Number:
-                return std::to_string(numberValue);
+                return std::make_shared<Value>(m_payload.number);
             case ValueType::String:
-                return "\"" + stringValue + "\"";
+                return std::make_shared<Value>(asString());
             case ValueType::Array: {
-                std::string result = "[\n";
-                for (size_t i = 0; i < arrayValue.size(); ++i) {
-                    result += nextIndentStr + arrayValue[i]->toString(indent + 1);
-                    if (i < arrayValue.size() - 1) result += ",";
-                    result += "\n";
+                auto result = std::make_shared<Value>();
+                result->type = ValueType::Array;
+                result->arrayValue.reserve(m_size);
+                for (const Node& item : items()) {
+                    result->arrayValue.push_back(item.toValue());
                 }
-                result += indentStr + "]";
                 return result;
             }
             case ValueType::Object: {
-                std::string result = "{\n";
-                size_t i = 0;
-                for (const auto& pair : objectValue) {
-                    result += nextIndentStr + "\"" + pair.first + "\": " + pair.second->toString(indent + 1);
-                    if (++i < objectValue.size()) result += ",";
-                    result += "\n";
+                auto result = std::make_shared<Value>();
+                result->type = ValueType::Object;
+                for (const Member& member : members()) {
+                    result->objectValue[std::string(member.key())] = member.value.toValue();
                 }
-                result += indentStr + "}";
                 return result;
             }
+            default:
+                return std::make_shared<Value>();
         }
-        return "";
     }
     
-    // Простой JSON парсер
-    class Parser {
+    // ===== View =====
+    
+    std::string_view View::asStringView() const {
+        const Node& node = *m_node;
+        if (!node.m_escaped || !m_arena) return node.asStringView();
+        // Первое обращение к строке с escape-последовательностями: декодируем в арену и запоминаем в узле
+        Node& mutableNode = const_cast<Node&>(node);
+        bool valid = Utf8::IsValid(node.m_payload.string, node.m_size);
+        char* decoded = m_arena->AllocateArray<char>(DecodedCapacity(node.m_size, valid));
+        mutableNode.m_size = (uint32_t)DecodeEscapes(node.m_payload.string, node.m_size, decoded, valid);
+        mutableNode.m_payload.string = decoded;
+        mutableNode.m_escaped = false;
+        return node.asStringView();
+    }
+    
+    std::string_view View::keyAt(size_t index) const {
+        std::span<const Member> members = m_node->members();
+        return index < members.size() ? members[index].key() : std::string_view();
+    }
+    
+    View View::valueAt(size_t index) const {
+        std::span<const Member> members = m_node->members();
+        return index < members.size() ? View(members[index].value, m_arena) : View();
+    }
+    
+    // ===== Document =====
+    
+    namespace {
+        // Счётчики двух проходов разбора (все документы, все потоки)
+        std::atomic<uint64_t> g_parsedDocuments{0};
+        std::atomic<uint64_t> g_parsedBytes{0};
+        std::atomic<uint64_t> g_indexNs{0};
+        std::atomic<uint64_t> g_buildNs{0};
+        
+        std::atomic<uint64_t> g_parallelDocuments{0};
+        
+        void RecordParserStats(size_t bytes, uint64_t indexNs, uint64_t buildNs, bool parallel = false) {
+            g_parsedDocuments.fetch_add(1, std::memory_order_relaxed);
+            if (parallel) g_parallelDocuments.fetch_add(1, std::memory_order_relaxed);
+            g_parsedBytes.fetch_add(bytes, std::memory_order_relaxed);
+            g_indexNs.fetch_add(indexNs, std::memory_order_relaxed);
+            g_buildNs.fetch_add(buildNs, std::memory_order_relaxed);
+        }
+    }
+    
+    // Второй проход: разбор в арену документа по позициям из StructuralIndex
+    // Дети собираются на стеке документа и копируются в арену одним блоком
+    // Параллельный разбор строит так же части корневого массива: у каждой своя арена и стеки
+    class DocumentBuilder {
     private:
+        Arena& m_arena;
+        std::vector<Node>& m_itemStack;
+        std::vector<Member>& m_memberStack;
+        std::string& m_error;
+        bool m_borrowed; // Строки ссылаются на исходный буфер
         const char* m_data;
-        size_t m_pos;
         size_t m_length;
+        const uint32_t* m_tokens;
+        size_t m_tokenCount;
+        size_t m_limit;  // Токены дальше не читаются (конец части)
+        size_t m_next;   // Следующий токен
+        size_t m_pos;    // Позиция текущего токена (для сообщений об ошибках)
+        int m_depth;
+        
+        bool Fail(const char* message) {
+            if (m_error.empty()) {
+                m_error = std::string(message) + " at offset " + std::to_string(m_pos);
+            }
+            return false;
+        }
+        
+        static bool IsWhitespace(char c) {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
         
-        void SkipWhitespace() {
-            while (m_pos < m_length && std::isspace(m_data[m_pos])) {
-                m_pos++;
+        // Перейти к следующему токену, false - токены кончились
+        bool NextToken(char& c) {
+            if (m_next >= m_limit) {
+                m_pos = m_length;
+                return false;
             }
+            m_pos = m_tokens[m_next++];
+            c = m_data[m_pos];
+            return true;
         }
         
-        char Current() const {
-            return m_pos < m_length ? m_data[m_pos] : '\0';
+        char PeekToken() const {
+            return m_next < m_limit ? m_data[m_tokens[m_next]] : '\0';
         }
         
-        char Next() {
-            if (m_pos < m_length) m_pos++;
-            return Current();
+        // Конец числа или литерала: следующий токен без пробелов перед ним
+        size_t ScalarEnd() const {
+            size_t end = m_next < m_tokenCount ? m_tokens[m_next] : m_length;
+            while (end > m_pos && IsWhitespace(m_data[end - 1])) end--;
+            return end;
         }
         
-        std::string ParseString() {
-            if (Current() != '"') return "";
-            Next(); // Skip opening quote
-            
-            std::string result;
-            while (m_pos < m_length && Current() != '"') {
-                if (Current() == '\\') {
-                    Next();
-                    switch (Current()) {
-                        case 'n': result += '\n'; break;
-                        case 't': result += '\t'; break;
-                        case 'r': result += '\r'; break;
-                        case '\\': result += '\\'; break;
-                        case '"': result += '"'; break;
-                        default: result += Current(); break;
-                    }
-                    Next();
-                } else {
-                    result += Current();
-                    Next();
-                }
+        bool MatchLiteral(const char* literal, size_t size) {
+            if (ScalarEnd() - m_pos != size || std::memcmp(m_data + m_pos, literal, size) != 0) {
+                return Fail("Invalid literal");
             }
-            if (Current() == '"') Next(); // Skip closing quote
-            return result;
+            return true;
         }
         
-        double ParseNumber() {
-            std::string numStr;
-            bool hasDot = false;
-            
-            if (Current() == '-') {
-                numStr += Current();
-                Next();
+        // Строка копируется в арену (исходный буфер после разбора возвращается в пул)
+        // Короткие строки не трогают арену: out указывает на inline буфер узла
+        // В режиме m_borrowed строка не копируется; escape-последовательности значений остаются
+        // в исходном виде (outEscaped), ключи декодируются сразу (по ним считается хеш)
+        // Неверный UTF-8 декодируется так же, как escape-последовательности (с заменой на U+FFFD)
+        bool ParseString(char* inlineBuffer, const char*& outData, uint32_t& outSize, bool* outEscaped) {
+            // Закрывающая кавычка - следующий токен: внутри строки первый проход токенов не ставит
+            size_t start = m_pos + 1;
+            if (m_next >= m_limit) return Fail("Unterminated string");
+            m_pos = m_tokens[m_next++];
+            size_t rawSize = m_pos - start;
+            if (rawSize > UINT32_MAX) return Fail("String too long");
+            // Один проход: проверка UTF-8 и поиск '\\'
+            Utf8::ScanResult scan = Utf8::Scan(m_data + start, rawSize);
+            bool escaped = scan.backslash || !scan.valid;
+            if (scan.backslash) {
+                size_t invalid = FindInvalidEscape(m_data + start, rawSize);
+                if (invalid < rawSize) {
+                    m_pos = start + invalid;
+                    return Fail("Invalid escape");
+                }
             }
             
-            while (m_pos < m_length) {
-                if (std::isdigit(Current())) {
-                    numStr += Current();
-                    Next();
-                } else if (Current() == '.' && !hasDot) {
-                    numStr += Current();
-                    hasDot = true;
-                    Next();
-                } else {
-                    break;
-                }
+            if (m_borrowed && (!escaped || outEscaped)) {
+                outData = m_data + start;
+                outSize = (uint32_t)rawSize;
+                if (outEscaped) *outEscaped = escaped;
+                return true;
             }
             
-            try {
-                return std::stod(numStr);
-            } catch (...) {
-                return 0.0;
+            // Экранированная строка не длиннее исходной, поэтому хватает rawSize байт (кроме неверного UTF-8)
+            size_t capacity = DecodedCapacity(rawSize, scan.valid);
+            char* out = (inlineBuffer && capacity <= Node::INLINE_CAPACITY) ? inlineBuffer : m_arena.AllocateArray<char>(capacity);
+            if (!escaped) {
+                if (rawSize > 0) std::memcpy(out, m_data + start, rawSize);
+                outData = out;
+                outSize = (uint32_t)rawSize;
+                return true;
             }
+            
+            outData = out;
+            outSize = (uint32_t)DecodeEscapes(m_data + start, rawSize, out, scan.valid);
+            return true;
+        }
+        
+        bool ParseString(Node& out) {
+            out.m_type = ValueType::String;
+            const char* data = nullptr;
+            if (!ParseString(out.m_payload.inlineString, data, out.m_size, &out.m_escaped)) return false;
+            out.m_inline = data == out.m_payload.inlineString;
+            if (!out.m_inline) out.m_payload.string = data;
+            return true;
+        }
+        
+        bool ParseNumber(Node& out) {
+            out.m_type = ValueType::Number;
+            if (!Json::ParseNumber(m_data + m_pos, m_data + ScalarEnd(), out.m_payload.number)) return Fail("Invalid number");
+            return true;
         }
         
-        std::shared_ptr<Value> ParseValue() {
-            SkipWhitespace();
+        bool ParseArray(Node& out) {
+            std::vector<Node>& stack = m_itemStack;
+            size_t base = stack.size();
             
-            switch (Current()) {
-                case 'n': // null
-                    if (m_length - m_pos >= 4 && 
-                        m_data[m_pos] == 'n' && m_data[m_pos+1] == 'u' && 
-                        m_data[m_pos+2] == 'l' && m_data[m_pos+3] == 'l') {
-                        m_pos += 4;
-                        return std::make_shared<Value>();
-                    }
-                    break;
-                    
-                case 't': // true
-                    if (m_length - m_pos >= 4 && 
-                        m_data[m_pos] == 't' && m_data[m_pos+1] == 'r' && 
-                        m_data[m_pos+2] == 'u' && m_data[m_pos+3] == 'e') {
-                        m_pos += 4;
-                        return std::make_shared<Value>(true);
-                    }
-                    break;
-                    
-                case 'f': // false
-                    if (m_length - m_pos >= 5 && 
-                        m_data[m_pos] == 'f' && m_data[m_pos+1] == 'a' && 
-                        m_data[m_pos+2] == 'l' && m_data[m_pos+3] == 's' && 
-                        m_data[m_pos+4] == 'e') {
-                        m_pos += 5;
-                        return std::make_shared<Value>(false);
-                    }
-                    break;
-                    
-                case '"': {
-                    auto val = std::make_shared<Value>(ParseString());
-                    return val;
+            if (PeekToken() == ']') {
+                m_next++;
+            } else {
+                while (true) {
+                    Node item;
+                    if (!ParseValue(item)) return false;
+                    stack.push_back(item);
+                    char c;
+                    if (!NextToken(c) || (c != ',' && c != ']')) return Fail("Expected ',' or ']'");
+                    if (c == ']') break;
                 }
-                    
-                case '[': {
-                    auto arr = std::make_shared<Value>();
-                    arr->type = ValueType::Array;
-                    Next(); // Skip '['
-                    SkipWhitespace();
-                    
-                    if (Current() != ']') {
-                        while (true) {
-                            arr->arrayValue.push_back(ParseValue());
-                            SkipWhitespace();
-                            if (Current() == ']') break;
-                            if (Current() != ',') break;
-                            Next(); // Skip ','
-                        }
-                    }
-                    if (Current() == ']') Next(); // Skip ']'
-                    return arr;
+            }
+            
+            size_t count = stack.size() - base;
+            if (count > UINT32_MAX) return Fail("Array too large");
+            Node* items = m_arena.AllocateArray<Node>(count);
+            std::copy(stack.begin() + base, stack.end(), items);
+            out.m_type = ValueType::Array;
+            out.m_size = (uint32_t)count;
+            out.m_payload.items = items;
+            stack.resize(base);
+            return true;
+        }
+        
+        bool ParseObject(Node& out) {
+            std::vector<Member>& stack = m_memberStack;
+            size_t base = stack.size();
+            
+            if (PeekToken() == '}') {
+                m_next++;
+            } else {
+                while (true) {
+                    char c;
+                    if (!NextToken(c) || c != '"') return Fail("Expected key");
+                    Member member;
+                    if (!ParseString(nullptr, member.keyData, member.keySize, nullptr)) return false;
+                    member.keyHash = Key::Hash(member.key());
+                    if (!NextToken(c) || c != ':') return Fail("Expected ':'");
+                    if (!ParseValue(member.value)) return false;
+                    stack.push_back(member);
+                    if (!NextToken(c) || (c != ',' && c != '}')) return Fail("Expected ',' or '}'");
+                    if (c == '}') break;
                 }
-                
+            }
+            
+            size_t count = stack.size() - base;
+            if (count > UINT32_MAX) return Fail("Object too large");
+            Member* members = m_arena.AllocateArray<Member>(count);
+            std::copy(stack.begin() + base, stack.end(), members);
+            out.m_type = ValueType::Object;
+            out.m_size = (uint32_t)count;
+            out.m_payload.members = members;
+            stack.resize(base);
+            return true;
+        }
+        
+        bool ParseValue(Node& out) {
+            char c;
+            if (!NextToken(c)) return Fail("Unexpected character");
+            
+            switch (c) {
+                case 'n':
+                    return MatchLiteral("null", 4);
+                case 't':
+                    out.m_type = ValueType::Boolean;
+                    out.m_bool = true;
+                    return MatchLiteral("true", 4);
+                case 'f':
+                    out.m_type = ValueType::Boolean;
+                    return MatchLiteral("false", 5);
+                case '"':
+                    return ParseString(out);
+                case '[':
                 case '{': {
-                    auto obj = std::make_shared<Value>();
-                    obj->type = ValueType::Object;
-                    Next(); // Skip '{'
-                    SkipWhitespace();
-                    
-                    if (Current() != '}') {
-                        while (true) {
-                            SkipWhitespace();
-                            if (Current() != '"') break;
-                            std::string key = ParseString();
-                            SkipWhitespace();
-                            if (Current() != ':') break;
-                            Next(); // Skip ':'
-                            obj->objectValue[key] = ParseValue();
-                            SkipWhitespace();
-                            if (Current() == '}') break;
-                            if (Current() != ',') break;
-                            Next(); // Skip ','
-                        }
-                    }
-                    if (Current() == '}') Next(); // Skip '}'
-                    return obj;
+                    if (++m_depth > Document::MAX_DEPTH) return Fail("Nesting too deep");
+                    bool ok = c == '[' ? ParseArray(out) : ParseObject(out);
+                    m_depth--;
+                    return ok;
                 }
-                
                 case '-':
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                case '8':
-                case '9': {
-                    return std::make_shared<Value>(ParseNumber());
-                }
+                case '0': case '1': case '2': case '3': case '4':
+                case '5': case '6': case '7': case '8': case '9':
+                    return ParseNumber(out);
             }
             
-            return std::make_shared<Value>(); // null
+            return Fail("Unexpected character");
         }
         
     public:
-        Parser(const std::string& json) 
-            : m_data(json.c_str()), m_pos(0), m_length(json.length()) {}
+        DocumentBuilder(Document& document, bool borrowed, const char* data, size_t length)
+            : m_arena(document.m_arena), m_itemStack(document.m_itemStack), m_memberStack(document.m_memberStack),
+              m_error(document.m_error), m_borrowed(borrowed), m_data(data), m_length(length),
+              m_tokens(document.m_index.Positions()), m_tokenCount(document.m_index.Count()),
+              m_limit(m_tokenCount), m_next(0), m_pos(0), m_depth(0) {}
+        
+        // Часть корневого массива документа: узлы в арене части, индекс - общий
+        DocumentBuilder(Document& document, Document::Part& part, const char* data, size_t length)
+            : m_arena(part.arena), m_itemStack(part.itemStack), m_memberStack(part.memberStack),
+              m_error(part.error), m_borrowed(false), m_data(data), m_length(length),
+              m_tokens(document.m_index.Positions()), m_tokenCount(document.m_index.Count()),
+              m_limit(m_tokenCount), m_next(0), m_pos(0), m_depth(0) {}
         
-        std::shared_ptr<Value> Parse() {
-            SkipWhitespace();
-            return ParseValue();
+        bool Build(Node& root) {
+            if (!ParseValue(root)) return false;
+            if (m_next < m_tokenCount) {
+                m_pos = m_tokens[m_next];
+                return Fail("Trailing characters");
+            }
+            return true;
+        }
+        
+        // Элементы корня между токенами [first, last) (запятые между ними - внутри диапазона)
+        // Элементы остаются на стеке элементов части, их дети - в её арене
+        bool BuildItems(size_t first, size_t last) {
+            m_next = first;
+            m_limit = last;
+            m_depth = 1;
+            m_itemStack.clear();
+            m_memberStack.clear();
+            while (m_next < m_limit) {
+                Node item;
+                if (!ParseValue(item)) return false;
+                m_itemStack.push_back(item);
+                char c;
+                if (m_next < m_limit && (!NextToken(c) || c != ',' || m_next == m_limit)) return Fail("Expected ',' or ']'");
+            }
+            return true;
+        }
+        
+        // Корневой массив из элементов всех частей (по порядку) в арене документа
+        static bool JoinItems(Document& document, size_t partCount) {
+            size_t count = 0;
+            for (size_t i = 0; i < partCount; i++) count += document.m_parts[i]->itemStack.size();
+            if (count > UINT32_MAX) return false;
+            Node* items = document.m_arena.AllocateArray<Node>(count);
+            Node* out = items;
+            for (size_t i = 0; i < partCount; i++) {
+                const std::vector<Node>& partItems = document.m_parts[i]->itemStack;
+                out = std::copy(partItems.begin(), partItems.end(), out);
+            }
+            document.m_root.m_type = ValueType::Array;
+            document.m_root.m_size = (uint32_t)count;
+            document.m_root.m_payload.items = items;
+            return true;
         }
     };
     
-    std::shared_ptr<Value> Parse(const std::string& json) {
-        Parser parser(json);
-        return parser.Parse();
+    bool Document::Parse(const char* data, size_t size) {
+        return Build(data, size, false);
+    }
+    
+    bool Document::ParseBorrowed(const char* data, size_t size) {
+        return Build(data, size, true);
+    }
+    
+    bool Document::Build(const char* data, size_t size, bool borrowed) {
+        m_arena.Reset();
+        m_root = Node();
+        m_error.clear();
+        m_itemStack.clear();
+        m_memberStack.clear();
+        
+        auto start = std::chrono::steady_clock::now();
+        bool indexed = m_index.Build(data, size);
+        auto indexDone = std::chrono::steady_clock::now();
+        if (!indexed) {
+            m_error = size > StructuralIndex::MAX_INPUT_SIZE ? "Document too large" : "Unterminated string at offset " + std::to_string(size);
+            return false;
+        }
+        
+        DocumentBuilder builder(*this, borrowed, data, size);
+        bool success = builder.Build(m_root);
+        auto buildDone = std::chrono::steady_clock::now();
+        RecordParserStats(size,
+            (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(indexDone - start).count(),
+            (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(buildDone - indexDone).count());
+        
+        if (!success) {
+            m_root = Node();
+            return false;
+        }
+        return true;
     }
+    
+    namespace {
+        // Кусок параллельного разбора можно начать после этого байта: не '\' (escape)
+        // и не середина числа/литерала (первый проход отметил бы там начало токена)
+        bool IsSplitBoundary(char c) {
+            switch (c) {
+                case ' ': case '\t': case '\n': case '\r':
+                case '{': case '}': case '[': case ']': case ':': case ',': case '"':
+                    return true;
+            }
+            return false;
+        }
+        
+        // Меньше этого на кусок не режем
+        constexpr size_t PARALLEL_CHUNK_SIZE = 64 * 1024;
+    }
+    
+    bool Document::ParseParallel(const char* data, size_t size, WorkerPool& pool) {
+        size_t threads = pool.GetThreadCount();
+        size_t first = 0;
+        while (first < size && (data[first] == ' ' || data[first] == '\t' || data[first] == '\n' || data[first] == '\r')) first++;
+        if (threads < 2 || size < PARALLEL_MIN_SIZE || size > StructuralIndex::MAX_INPUT_SIZE || first == size || data[first] != '[') {
+            return Build(data, size, false);
+        }
+        
+        m_arena.Reset();
+        m_root = Node();
+        m_error.clear();
+        auto start = std::chrono::steady_clock::now();
+        
+        // Несколько кусков на поток: части неравной сложности выравниваются раздачей по счётчику
+        size_t chunkCount = std::clamp<size_t>(size / PARALLEL_CHUNK_SIZE, 2, threads * 4);
+        while (m_parts.size() < chunkCount + 1) m_parts.push_back(std::make_unique<Part>());
+        size_t begin = 0;
+        for (size_t i = 0; i < chunkCount; i++) {
+            Part& part = *m_parts[i];
+            size_t end = i + 1 == chunkCount ? size : std::max(begin, size / chunkCount * (i + 1));
+            while (end > 0 && end < size && !IsSplitBoundary(data[end - 1])) end++;
+            part.begin = begin;
+            part.end = end;
+            begin = end;
+        }
+        
+        // Первый проход по кускам в предположении "вне строки"; конец куска даёт чётность его кавычек,
+        // по ней состояние начала каждого следующего куска - куски, начатые внутри строки, индексируются заново
+        pool.ParallelFor(chunkCount, [&](size_t i) {
+            Part& part = *m_parts[i];
+            part.endsInString = part.index.BuildPart(data + part.begin, part.end - part.begin, false);
+        });
+        bool inString = false;
+        for (size_t i = 0; i < chunkCount; i++) {
+            m_parts[i]->startsInString = inString;
+            inString ^= m_parts[i]->endsInString;
+        }
+        if (inString) return Build(data, size, false);
+        
+        // Баланс скобок куска и кандидаты в разрезы для каждой глубины начала:
+        // при начале на глубине s запятая корня - на уровне 1 - s от начала, ']' корня - на уровне -s
+        pool.ParallelFor(chunkCount, [&](size_t i) {
+            Part& part = *m_parts[i];
+            if (part.startsInString) part.index.BuildPart(data + part.begin, part.end - part.begin, true);
+            std::fill(std::begin(part.commaAt), std::end(part.commaAt), SIZE_MAX);
+            std::fill(std::begin(part.closeAt), std::end(part.closeAt), SIZE_MAX);
+            int level = 0;
+            const uint32_t* positions = part.index.Positions();
+            for (size_t j = 0; j < part.index.Count(); j++) {
+                char c = data[part.begin + positions[j]];
+                if (c == '{' || c == '[') {
+                    level++;
+                } else if (c == '}' || c == ']') {
+                    level--;
+                    if (level <= 0 && -level <= Part::LEVELS && part.closeAt[-level] == SIZE_MAX) part.closeAt[-level] = j;
+                } else if (c == ',' && level <= 1 && 1 - level < Part::LEVELS && part.commaAt[1 - level] == SIZE_MAX) {
+                    part.commaAt[1 - level] = j;
+                }
+            }
+            part.depthChange = level;
+        });
+        
+        size_t tokenCount = 0;
+        int depth = 0;
+        for (size_t i = 0; i < chunkCount; i++) {
+            Part& part = *m_parts[i];
+            if (depth < 0 || depth >= Part::LEVELS) return Build(data, size, false);
+            part.firstToken = tokenCount;
+            part.startDepth = depth;
+            tokenCount += part.index.Count();
+            depth += part.depthChange;
+        }
+        m_index.Resize(tokenCount);
+        pool.ParallelFor(chunkCount, [&](size_t i) {
+            Part& part = *m_parts[i];
+            m_index.CopyFrom(part.firstToken, part.index, (uint32_t)part.begin);
+        });
+        
+        // Части: от '[' корня через первые запятые корня в кусках до его ']'
+        // Лишняя закрывающая скобка (уровень ниже корня) или токены после ']' - ошибка
+        std::vector<size_t> bounds;
+        bounds.push_back(0);
+        size_t rootEnd = SIZE_MAX;
+        for (size_t i = 0; i < chunkCount && rootEnd == SIZE_MAX; i++) {
+            Part& part = *m_parts[i];
+            int level = part.startDepth;
+            if (part.commaAt[level] != SIZE_MAX && part.commaAt[level] < part.closeAt[level]) {
+                bounds.push_back(part.firstToken + part.commaAt[level]);
+            }
+            if (part.closeAt[level + 1] != SIZE_MAX) return Build(data, size, false);
+            if (part.closeAt[level] != SIZE_MAX) rootEnd = part.firstToken + part.closeAt[level];
+        }
+        if (rootEnd == SIZE_MAX || rootEnd + 1 != tokenCount) return Build(data, size, false);
+        bounds.push_back(rootEnd);
+        size_t partCount = bounds.size() - 1;
+        // Пустая часть допустима только у пустого корня: иначе это ",," или ",]"
+        for (size_t k = 0; k < partCount && partCount > 1; k++) {
+            if (bounds[k] + 1 == bounds[k + 1]) return Build(data, size, false);
+        }
+        auto indexDone = std::chrono::steady_clock::now();
+        
+        std::atomic<bool> failed{false};
+        pool.ParallelFor(partCount, [&](size_t k) {
+            Part& part = *m_parts[k];
+            part.arena.Reset();
+            part.error.clear();
+            DocumentBuilder builder(*this, part, data, size);
+            if (!builder.BuildItems(bounds[k] + 1, bounds[k + 1])) failed = true;
+        });
+        if (failed || !DocumentBuilder::JoinItems(*this, partCount)) return Build(data, size, false);
+        auto buildDone = std::chrono::steady_clock::now();
+        
+        RecordParserStats(size,
+            (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(indexDone - start).count(),
+            (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(buildDone - indexDone).count(),
+            true);
+        return true;
+    }
+    
+    ParserStats GetParserStats() {
+        ParserStats stats;
+        stats.implementation = StructuralIndex::GetImplementation();
+        stats.documents = g_parsedDocuments;
+        stats.bytes = g_parsedBytes;
+        stats.indexNs = g_indexNs;
+        stats.buildNs = g_buildNs;
+        stats.parallelDocuments = g_parallelDocuments;
+        return stats;
+    }
+    
+    std::shared_ptr<Value> Parse(const char* data, size_t size, WorkerPool* pool) {
+        // Один документ на поток: арена прогревается и дальше не выделяет память
+        thread_local Document document;
+        if (pool) {
+            document.ParseParallel(data, size, *pool);
+        } else {
+            document.Parse(data, size);
+        }
+        return document.Root().toValue();
+    }
+    
 }
 
 // Реализация JsonParser
-JsonParser::JsonParser() : m_running(true) {
-    m_workerThread = std::thread(&JsonParser::WorkerThread, this);
+namespace {
+    uint64_t MicrosecondsBetween(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+    }
+    
+    void UpdateMax(std::atomic<uint64_t>& target, uint64_t value) {
+        uint64_t current = target.load(std::memory_order_relaxed);
+        while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+}
+
+JsonParser::JsonParser(size_t workers, size_t parallelThreads)
+    : m_pool(std::make_unique<WorkerPool>(parallelThreads > 0 ? parallelThreads : WorkerPool::DefaultThreadCount(8)))
+    , m_running(true)
+{
+    if (workers == 0) workers = DEFAULT_WORKERS;
+    m_workers.reserve(workers);
+    for (size_t i = 0; i < workers; i++) {
+        m_workers.emplace_back(&JsonParser::WorkerThread, this);
+    }
 }
 
 JsonParser::~JsonParser() {
     Stop();
-    if (m_workerThread.joinable()) {
-        m_workerThread.join();
+    for (std::thread& worker : m_workers) {
+        if (worker.joinable()) worker.join();
+    }
+    // Ответы, положенные после остановки
+    size_t count = m_mailboxCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++) {
+        delete m_mailboxes[i]->latest.exchange(nullptr, std::memory_order_acq_rel);
     }
 }
 
-void JsonParser::ParseAsync(const std::string& jsonData, ParseCallback callback) {
+void JsonParser::Enqueue(ParseTask task) {
     std::lock_guard<std::mutex> lock(m_queueMutex);
+    m_taskQueue.push_back(std::move(task));
+    m_condition.notify_one();
+}
+
+void JsonParser::ParseAsync(const std::string& jsonData, ParseCallback callback) {
+    ParseAsync(PooledBuffer(jsonData), std::move(callback));
+}
+
+void JsonParser::ParseAsync(PooledBuffer jsonData, ParseCallback callback) {
     ParseTask task;
-    task.data = jsonData;
+    task.data = std::move(jsonData);
     task.isFile = false;
-    task.callback = callback;
-    m_taskQueue.push(task);
-    m_condition.notify_one();
+    task.callback = std::move(callback);
+    Enqueue(std::move(task));
 }
 
-void JsonParser::ParseFileAsync(const std::string& filePath, ParseCallback callback) {
+JsonParser::Mailbox* JsonParser::GetMailbox(const std::string& channel) {
+    size_t count = m_mailboxCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++) {
+        if (m_mailboxes[i]->channel == channel) return m_mailboxes[i].get();
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mailboxMutex);
+    // Мог добавить другой поток, пока ждали блокировку
+    count = m_mailboxCount.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; i++) {
+        if (m_mailboxes[i]->channel == channel) return m_mailboxes[i].get();
+    }
+    if (count >= MAX_CHANNELS) return nullptr;
+    
+    m_mailboxes[count] = std::make_unique<Mailbox>();
+    m_mailboxes[count]->channel = channel;
+    m_mailboxCount.store(count + 1, std::memory_order_release);
+    return m_mailboxes[count].get();
+}
+
+// Задача занимает слот ящика; неразобранная предыдущая отбрасывается
+// Ящик ставится в очередь готовых только тем, кто положил ответ в пустой слот (и если его не разбирают сейчас)
+void JsonParser::Post(Mailbox* mailbox, std::unique_ptr<ParseTask> task) {
+    if (!m_running) return;
+    
+    task->postedAt = std::chrono::steady_clock::now();
+    mailbox->posted.fetch_add(1, std::memory_order_relaxed);
+    ParseTask* previous = mailbox->latest.exchange(task.release(), std::memory_order_acq_rel);
+    if (previous) {
+        delete previous; // Буфер ответа возвращается в пул
+        mailbox->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
     std::lock_guard<std::mutex> lock(m_queueMutex);
+    if (!m_running) {
+        // Stop прошёл между проверкой и блокировкой
+        if (!mailbox->busy) delete mailbox->latest.exchange(nullptr, std::memory_order_acq_rel);
+        return;
+    }
+    if (!mailbox->busy && !mailbox->queued) {
+        mailbox->queued = true;
+        m_readyMailboxes.push_back(mailbox);
+        m_condition.notify_one();
+    }
+}
+
+void JsonParser::ParseDocumentAsync(const std::string& channel, PooledBuffer jsonData, DocumentCallback callback) {
+    Mailbox* mailbox = GetMailbox(channel);
+    if (!mailbox) {
+        Json::Document empty;
+        callback(empty, false, "Too many parser channels: " + channel);
+        return;
+    }
+    
+    auto task = std::make_unique<ParseTask>();
+    task->data = std::move(jsonData);
+    task->documentCallback = std::move(callback);
+    Post(mailbox, std::move(task));
+}
+
+void JsonParser::DispatchLatestAsync(const std::string& channel, PooledBuffer payload, PayloadCallback callback) {
+    Mailbox* mailbox = GetMailbox(channel);
+    if (!mailbox) {
+        // Каналов больше, чем ящиков: без отбрасывания, общей очередью
+        ParseTask task;
+        task.data = std::move(payload);
+        task.payloadCallback = std::move(callback);
+        Enqueue(std::move(task));
+        return;
+    }
+    
+    auto task = std::make_unique<ParseTask>();
+    task->data = std::move(payload);
+    task->payloadCallback = std::move(callback);
+    Post(mailbox, std::move(task));
+}
+
+void JsonParser::ParseFileAsync(const std::string& filePath, ParseCallback callback) {
     ParseTask task;
     task.filePath = filePath;
     task.isFile = true;
-    task.callback = callback;
-    m_taskQueue.push(task);
-    m_condition.notify_one();
+    task.callback = std::move(callback);
+    Enqueue(std::move(task));
+}
+
+void JsonParser::ParseLinesAsync(const std::string& filePath, Json::LineCallback lineCallback, LinesDoneCallback doneCallback) {
+    ParseTask task;
+    task.filePath = filePath;
+    task.isFile = true;
+    task.lineCallback = std::move(lineCallback);
+    task.linesDoneCallback = std::move(doneCallback);
+    Enqueue(std::move(task));
 }
 
 void JsonParser::Stop() {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
     m_running = false;
+    // Ящики, которые никто не разбирает, отбрасываются (занятые освобождает их поток)
+    for (Mailbox* mailbox : m_readyMailboxes) {
+        mailbox->queued = false;
+        delete mailbox->latest.exchange(nullptr, std::memory_order_acq_rel);
+    }
+    m_readyMailboxes.clear();
     m_condition.notify_all();
 }
 
 size_t JsonParser::GetQueueSize() const {
+    size_t pending = 0;
+    size_t count = m_mailboxCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++) {
+        if (m_mailboxes[i]->latest.load(std::memory_order_relaxed)) pending++;
+    }
     std::lock_guard<std::mutex> lock(m_queueMutex);
-    return m_taskQueue.size();
+    return m_taskQueue.size() + pending;
+}
+
+std::vector<JsonParser::ChannelStats> JsonParser::GetChannelStats() const {
+    std::vector<ChannelStats> result;
+    size_t count = m_mailboxCount.load(std::memory_order_acquire);
+    result.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        const Mailbox& mailbox = *m_mailboxes[i];
+        ChannelStats stats;
+        stats.channel = mailbox.channel;
+        stats.posted = mailbox.posted.load(std::memory_order_relaxed);
+        stats.processed = mailbox.processed.load(std::memory_order_relaxed);
+        stats.dropped = mailbox.dropped.load(std::memory_order_relaxed);
+        stats.waitUs = mailbox.waitUs.load(std::memory_order_relaxed);
+        stats.parseUs = mailbox.parseUs.load(std::memory_order_relaxed);
+        stats.maxLatencyUs = mailbox.maxLatencyUs.load(std::memory_order_relaxed);
+        stats.pending = mailbox.latest.load(std::memory_order_relaxed) != nullptr;
+        result.push_back(std::move(stats));
+    }
+    return result;
 }
 
 void JsonParser::WorkerThread() {
-    // Привязываем поток к отдельному ядру (если доступно)
-    // В Windows можно использовать SetThreadAffinityMask
-    #ifdef _WIN32
-    SetThreadAffinityMask(GetCurrentThread(), 0x1); // Привязка к первому ядру
-    #endif
+    // Ядра потока задаёт правило роли Parse (по умолчанию без привязки)
+    ThreadPlacement::ScopedRole placement(ThreadPlacement::Role::Parse);
     
-    while (m_running) {
+    while (true) {
         ParseTask task;
+        Mailbox* mailbox = nullptr;
         
         {
             std::unique_lock<std::mutex> lock(m_queueMutex);
             m_condition.wait(lock, [this] { 
-                return !m_taskQueue.empty() || !m_running; 
+                return !m_readyMailboxes.empty() || !m_taskQueue.empty() || !m_running; 
             });
             
-            if (!m_running && m_taskQueue.empty()) break;
-            
-            if (!m_taskQueue.empty()) {
-                task = m_taskQueue.front();
-                m_taskQueue.pop();
+            // Ответы каналов раньше разовых задач: они устаревают
+            if (!m_readyMailboxes.empty()) {
+                mailbox = m_readyMailboxes.front();
+                m_readyMailboxes.pop_front();
+                mailbox->queued = false;
+                mailbox->busy = true;
+            } else if (!m_taskQueue.empty()) {
+                task = std::move(m_taskQueue.front());
+                m_taskQueue.pop_front();
+            } else {
+                break; // Остановлен, общая очередь пуста
             }
         }
         
-        if (task.callback) {
-            try {
-                std::string jsonData = task.isFile ? ReadFile(task.filePath) : task.data;
-                
-                if (task.isFile && jsonData.empty()) {
-                    task.callback(nullptr, false, "Failed to read file: " + task.filePath);
-                    continue;
-                }
-                
-                auto result = Json::Parse(jsonData);
-                task.callback(result, true, "");
-            } catch (const std::exception& e) {
-                task.callback(nullptr, false, std::string("Parse error: ") + e.what());
-            } catch (...) {
-                task.callback(nullptr, false, "Unknown parse error");
+        if (!mailbox) {
+            Process(task, nullptr);
+            continue;
+        }
+        
+        std::unique_ptr<ParseTask> latest(mailbox->latest.exchange(nullptr, std::memory_order_acq_rel));
+        if (latest) {
+            auto start = std::chrono::steady_clock::now();
+            mailbox->waitUs.fetch_add(MicrosecondsBetween(latest->postedAt, start), std::memory_order_relaxed);
+            Process(*latest, mailbox);
+            auto end = std::chrono::steady_clock::now();
+            mailbox->parseUs.fetch_add(MicrosecondsBetween(start, end), std::memory_order_relaxed);
+            UpdateMax(mailbox->maxLatencyUs, MicrosecondsBetween(latest->postedAt, end));
+            mailbox->processed.fetch_add(1, std::memory_order_relaxed);
+            latest.reset();
+        }
+        
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        mailbox->busy = false;
+        // Новый ответ пришёл во время разбора: его автор ящик не ставил (был занят)
+        if (mailbox->latest.load(std::memory_order_acquire) && !mailbox->queued) {
+            if (m_running) {
+                mailbox->queued = true;
+                m_readyMailboxes.push_back(mailbox);
+                m_condition.notify_one();
+            } else {
+                delete mailbox->latest.exchange(nullptr, std::memory_order_acq_rel);
             }
         }
     }
 }
 
-std::string JsonParser::ReadFile(const std::string& filePath) {
-    std::ifstream file(filePath, std::ios::binary);
-    if (!file.is_open()) {
-        return "";
+void JsonParser::Process(ParseTask& task, Mailbox* mailbox) {
+    if (task.lineCallback) {
+        Json::LinesResult result = Json::ParseLines(task.filePath, task.lineCallback);
+        if (task.linesDoneCallback) task.linesDoneCallback(result);
+    } else if (task.payloadCallback) {
+        task.payloadCallback(std::move(task.data));
+    } else if (task.documentCallback && mailbox) {
+        // Документ канала живёт между задачами: арена и стеки уже прогреты прошлыми опросами
+        if (!mailbox->document) mailbox->document = std::make_unique<Json::Document>();
+        Json::Document& document = *mailbox->document;
+        
+        auto start = std::chrono::steady_clock::now();
+        bool success = document.ParseParallel(task.data.Str(), *m_pool);
+        ThreadPlacement::RecordParse(task.data.Size(), MicrosecondsBetween(start, std::chrono::steady_clock::now()));
+        task.data.Release(); // Строки скопированы в арену, буфер возвращается в пул
+        task.documentCallback(document, success, document.GetError());
+    } else if (task.callback) {
+        try {
+            if (task.isFile) {
+                // Разбор прямо из страниц файла: без чтения в буфер и копии в строку
+                MappedFile file;
+                if (!file.Open(task.filePath) || file.Size() > SIZE_MAX || !file.Map(0, (size_t)file.Size())) {
+                    task.callback(nullptr, false, "Failed to read file: " + task.filePath);
+                    return;
+                }
+                auto start = std::chrono::steady_clock::now();
+                auto result = Json::Parse(file.Data(), file.MappedSize(), m_pool.get());
+                ThreadPlacement::RecordParse(file.MappedSize(), MicrosecondsBetween(start, std::chrono::steady_clock::now()));
+                file.Close();
+                task.callback(result, true, "");
+                return;
+            }
+            
+            auto start = std::chrono::steady_clock::now();
+            auto result = Json::Parse(task.data.Str(), m_pool.get());
+            ThreadPlacement::RecordParse(task.data.Size(), MicrosecondsBetween(start, std::chrono::steady_clock::now()));
+            task.data.Release(); // Буфер возвращается в пул до вызова callback
+            task.callback(result, true, "");
+        } catch (const std::exception& e) {
+            task.callback(nullptr, false, std::string("Parse error: ") + e.what());
+        } catch (...) {
+            task.callback(nullptr, false, "Unknown parse error");
+        }
     }
-    
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return buffer.str();
 }
 
@@ -8,12 +8,21 @@
 #include <mutex>
 #include <atomic>
 #include <functional>
-#include <queue>
+#include <deque>
+#include <chrono>
 #include <condition_variable>
+#include <string_view>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+#include "BufferPool.h"
+#include "JsonIndex.h"
+#include "WorkerPool.h"
 
 // Простой JSON парсер с поддержкой основных типов
 namespace Json {
-    enum class ValueType {
+    enum class ValueType : uint8_t {
         Null,
         Boolean,
         Number,
@@ -27,8 +36,8 @@ namespace Json {
         ValueType type;
         
         // Данные в зависимости от типа
-        bool boolValue;
-        double numberValue;
+        bool boolValue = false;
+        double numberValue = 0.0;
         std::string stringValue;
         std::vector<std::shared_ptr<Value>> arrayValue;
         std::map<std::string, std::shared_ptr<Value>> objectValue;
@@ -54,52 +63,422 @@ namespace Json {
         bool isArray() const { return type == ValueType::Array; }
         bool isObject() const { return type == ValueType::Object; }
         
-        // Строковое представление
+        // Строковое представление (Json::Writer с отступами)
         std::string toString(int indent = 0) const;
     };
 
-    // Парсинг JSON строки
-    std::shared_ptr<Value> Parse(const std::string& json);
+    // Парсинг JSON строки (через Document, дерево Value строится копированием)
+    // С пулом большой корневой массив разбирается параллельно (Document::ParseParallel)
+    std::shared_ptr<Value> Parse(const char* data, size_t size, WorkerPool* pool = nullptr);
+    inline std::shared_ptr<Value> Parse(const std::string& json, WorkerPool* pool = nullptr) { return Parse(json.data(), json.size(), pool); }
+
+    // Число JSON из [begin, end): без выделения памяти, исключений и зависимости от локали
+    // Целые до 15 цифр собираются напрямую, остальное - std::from_chars
+    // false - текст не число по грамматике JSON (out не меняется)
+    bool ParseNumber(const char* begin, const char* end, double& out);
+
+    // Первая неверная escape-последовательность текста строки (без кавычек): позиция её '\' или size, если неверных нет
+    // Верные - \" \\ \/ \b \f \n \r \t и \u с четырьмя шестнадцатеричными цифрами
+    size_t FindInvalidEscape(const char* raw, size_t size);
+
+    // Декодирование текста строки (без кавычек) в UTF-8: escape-последовательности, включая \uXXXX
+    // и суррогатные пары; одиночный суррогат - U+FFFD
+    // Текст проверен FindInvalidEscape (разбор отвергает строки с неверными escape)
+    // validUtf8 == false (Utf8::Scan нашёл неверные байты) - они тоже заменяются на U+FFFD
+    // out должен вмещать DecodedCapacity(size, validUtf8) байт
+    size_t DecodeEscapes(const char* raw, size_t size, char* out, bool validUtf8 = true);
+    constexpr size_t DecodedCapacity(size_t size, bool validUtf8) { return validUtf8 ? size : size * 3; }
+
+    // Монотонная арена: память раздаётся из блоков и освобождается только целиком (Reset)
+    // После Reset блоки остаются, поэтому повторный разбор документа того же размера не обращается к malloc
+    class Arena {
+    public:
+        static constexpr size_t MIN_BLOCK_SIZE = 16 * 1024;
+
+        // Счётчики арены (для отладки)
+        struct Stats {
+            uint64_t blocks = 0;      // Блоков сейчас
+            uint64_t capacity = 0;    // Их суммарный размер
+            uint64_t used = 0;        // Занято с последнего Reset
+            uint64_t peakUsed = 0;    // Максимум занятого между Reset
+            uint64_t allocations = 0; // Обращений к malloc за всё время
+        };
+
+        Arena() = default;
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        void* Allocate(size_t size, size_t align);
+
+        template<typename T>
+        T* AllocateArray(size_t count) {
+            return count > 0 ? static_cast<T*>(Allocate(sizeof(T) * count, alignof(T))) : nullptr;
+        }
+
+        // Освободить всё сразу; несколько блоков сливаются в один общего размера
+        void Reset();
+
+        Stats GetStats() const;
+
+    private:
+        struct Block {
+            std::unique_ptr<char[]> data;
+            size_t size = 0;
+        };
+
+        void AddBlock(size_t minSize);
+
+        std::vector<Block> m_blocks;
+        size_t m_current = 0; // Блок, из которого идёт выделение
+        size_t m_offset = 0;  // Занято в текущем блоке
+        size_t m_used = 0;
+        size_t m_peakUsed = 0;
+        uint64_t m_allocations = 0;
+    };
+
+    struct Member;
+
+    // Ключ объекта с заранее посчитанным хешем (FNV-1a, 32 бита)
+    // static constexpr Json::Key key("type") - хеш считается при компиляции, поиск сравнивает сначала хеши
+    struct Key {
+        std::string_view name;
+        uint32_t hash;
+
+        static constexpr uint32_t Hash(std::string_view text) {
+            uint32_t hash = 2166136261u;
+            for (char c : text) {
+                hash ^= (unsigned char)c;
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+
+        constexpr Key(std::string_view text) : name(text), hash(Hash(text)) {}
+        constexpr Key(const char* text) : Key(std::string_view(text)) {}
+    };
+
+    // Узел документа - 16 байт: 8 байт данных (число, указатель или короткая строка) + длина + тег
+    // Дети массивов и объектов лежат в арене документа подряд, обход массива - линейный проход по памяти
+    // Промахи accessor'ов возвращают общий null узел без выделения памяти
+    class Node {
+    public:
+        static constexpr size_t INLINE_CAPACITY = 8; // Строки до 8 байт хранятся прямо в узле
+
+        Node() : m_size(0), m_type(ValueType::Null), m_bool(false), m_inline(false), m_escaped(false) { m_payload.number = 0.0; }
+
+        // Общий null узел (результат всех промахов)
+        static const Node& Null();
+
+        ValueType type() const { return m_type; }
+        bool isNull() const { return m_type == ValueType::Null; }
+        bool isBool() const { return m_type == ValueType::Boolean; }
+        bool isNumber() const { return m_type == ValueType::Number; }
+        bool isString() const { return m_type == ValueType::String; }
+        bool isArray() const { return m_type == ValueType::Array; }
+        bool isObject() const { return m_type == ValueType::Object; }
+
+        bool asBool() const;
+        double asNumber() const;
+        std::string asString() const;           // С декодированием escape-последовательностей
+        std::string_view asStringView() const;  // Для hasEscapes() - сырой текст из исходного буфера (декодирует View)
+        bool hasEscapes() const { return m_escaped; }
+
+        size_t size() const { return (m_type == ValueType::Array || m_type == ValueType::Object) ? m_size : 0; }
+        std::span<const Node> items() const;     // Пусто, если не массив
+        std::span<const Member> members() const; // Пусто, если не объект (в порядке документа)
+
+        const Node& operator[](size_t index) const;
+        const Node& operator[](int index) const { return index >= 0 ? (*this)[(size_t)index] : Null(); } // [0] без неоднозначности с const char*
+        const Node& operator[](const Key& key) const;
+        const Node& operator[](std::string_view key) const { return (*this)[Key(key)]; }
+        const Node& operator[](const char* key) const { return (*this)[Key(key)]; }
+        const Member* find(const Key& key) const;
+
+        std::string toString(int indent = 0) const; // Json::Writer с отступами
+        std::shared_ptr<Value> toValue() const; // Копия в старом формате (DisplayJsonValue и т.п.)
+
+    private:
+        friend class DocumentBuilder;
+        friend class View;
+
+        union Payload {
+            double number;
+            const char* string;
+            const Node* items;
+            const Member* members;
+            char inlineString[INLINE_CAPACITY];
+        };
+
+        Payload m_payload;
+        uint32_t m_size;   // Длина строки или число детей
+        ValueType m_type;
+        bool m_bool;
+        bool m_inline;     // Строка лежит в m_payload.inlineString
+        bool m_escaped;    // Строка ссылается на исходный буфер и ещё не декодирована: escape или неверный UTF-8 (ParseBorrowed)
+    };
+    static_assert(sizeof(Node) == 16, "Json::Node must stay 16 bytes");
+
+    struct Member {
+        const char* keyData = nullptr;
+        uint32_t keySize = 0;
+        uint32_t keyHash = 0;
+        Node value;
+
+        std::string_view key() const { return std::string_view(keyData ? keyData : "", keySize); }
+    };
+
+    // Невладеющий доступ к узлу документа: чтение полей без копирования строк
+    // Строки без escape-последовательностей - string_view прямо в исходный буфер,
+    // остальные декодируются в арену документа при первом обращении
+    // Промахи (нет ключа, индекс за границей, не тот тип) - общий null узел, без выделения памяти
+    class View {
+    public:
+        View() : m_node(&Node::Null()), m_arena(nullptr) {}
+        View(const Node& node, Arena* arena) : m_node(&node), m_arena(arena) {}
+
+        ValueType type() const { return m_node->type(); }
+        bool isNull() const { return m_node->isNull(); }
+        bool isBool() const { return m_node->isBool(); }
+        bool isNumber() const { return m_node->isNumber(); }
+        bool isString() const { return m_node->isString(); }
+        bool isArray() const { return m_node->isArray(); }
+        bool isObject() const { return m_node->isObject(); }
+
+        bool asBool() const { return m_node->asBool(); }
+        double asNumber() const { return m_node->asNumber(); }
+        float asFloat() const { return (float)m_node->asNumber(); }
+        int asInt() const { return (int)m_node->asNumber(); }
+        std::string_view asStringView() const;
+        std::string asString() const { return std::string(asStringView()); }
+
+        size_t size() const { return m_node->size(); }
+        View operator[](size_t index) const { return View((*m_node)[index], m_arena); }
+        View operator[](int index) const { return View((*m_node)[index], m_arena); }
+        View operator[](const Key& key) const { return View((*m_node)[key], m_arena); }
+        View operator[](std::string_view key) const { return (*this)[Key(key)]; }
+        View operator[](const char* key) const { return (*this)[Key(key)]; }
+        bool contains(const Key& key) const { return m_node->find(key) != nullptr; }
+
+        // Поля объекта по порядку
+        std::string_view keyAt(size_t index) const;
+        View valueAt(size_t index) const;
+
+        const Node& GetNode() const { return *m_node; }
+
+    private:
+        const Node* m_node;
+        Arena* m_arena; // Куда декодировать строки (nullptr - без кеширования)
+    };
+
+    // Документ: разбор в арену, повторное использование между опросами одного эндпоинта
+    class Document {
+    public:
+        static constexpr int MAX_DEPTH = 512;
+        // Меньшие документы ParseParallel разбирает в одном потоке: запуск частей дороже выигрыша
+        static constexpr size_t PARALLEL_MIN_SIZE = 512 * 1024;
+
+        Document() = default;
+        Document(const Document&) = delete;
+        Document& operator=(const Document&) = delete;
+
+        // Разбор сбрасывает предыдущее содержимое (ссылки на старые узлы становятся недействительными)
+        bool Parse(const char* data, size_t size);
+        bool Parse(const std::string& json) { return Parse(json.data(), json.size()); }
+
+        // Разбор без копирования строк: узлы ссылаются на data, буфер должен жить, пока читается документ
+        bool ParseBorrowed(const char* data, size_t size);
+        bool ParseBorrowed(const std::string& json) { return ParseBorrowed(json.data(), json.size()); }
+
+        // Разбор корневого массива по частям на потоках пула (как Parse, строки копируются)
+        // Вход режется на куски по потокам, куски индексируются параллельно, затем режутся
+        // по запятым между элементами корня; элементы каждой части строятся в её арене,
+        // корневой массив сшивается по порядку. Другой корень или маленький вход - обычный Parse
+        // При ошибке разбор повторяется последовательно (то же сообщение, что у Parse)
+        bool ParseParallel(const char* data, size_t size, WorkerPool& pool);
+        bool ParseParallel(const std::string& json, WorkerPool& pool) { return ParseParallel(json.data(), json.size(), pool); }
+
+        const Node& Root() const { return m_root; }
+        View RootView() const { return View(m_root, &m_arena); }
+        const std::string& GetError() const { return m_error; }
+        const Arena& GetArena() const { return m_arena; }
+        const StructuralIndex& GetIndex() const { return m_index; }
+
+    private:
+        friend class DocumentBuilder;
+
+        // Кусок входа и часть корневого массива параллельного разбора (память переиспользуется)
+        struct Part {
+            StructuralIndex index; // Позиции куска (от его начала)
+            Arena arena;           // Узлы элементов части
+            std::vector<Node> itemStack;
+            std::vector<Member> memberStack;
+            std::string error;
+            size_t begin = 0;        // Начало куска во входе
+            size_t end = 0;
+            bool endsInString = false; // Конец куска внутри строки, если он начат вне строки
+            bool startsInString = false;
+            int depthChange = 0;     // Открытых скобок минус закрытых
+            int startDepth = 0;
+            size_t firstToken = 0;   // Первая позиция куска в общем индексе
+            // Глубина начала куска известна только после всех кусков, поэтому запоминается
+            // для каждой возможной: первая запятая корня и первая закрывающая скобка корня (позиции в куске)
+            static constexpr int LEVELS = 64;
+            size_t commaAt[LEVELS];
+            size_t closeAt[LEVELS + 1];
+        };
+
+        bool Build(const char* data, size_t size, bool borrowed);
+
+        StructuralIndex m_index; // Позиции токенов (первый проход)
+        mutable Arena m_arena; // mutable: View декодирует строки лениво через const документ
+        Node m_root;
+        std::string m_error;
+        // Стеки детей незакрытых массивов/объектов (ёмкость сохраняется между разборами)
+        std::vector<Node> m_itemStack;
+        std::vector<Member> m_memberStack;
+        std::vector<std::unique_ptr<Part>> m_parts;
+    };
+
+    // Скорость двух проходов разбора по всем документам (дебаг режим)
+    struct ParserStats {
+        const char* implementation = ""; // Реализация первого прохода (AVX2/SSE2/scalar)
+        uint64_t documents = 0;
+        uint64_t bytes = 0;
+        uint64_t indexNs = 0; // Первый проход (StructuralIndex)
+        uint64_t buildNs = 0; // Второй проход (узлы в арене)
+        uint64_t parallelDocuments = 0; // Из них разобрано по частям (ParseParallel)
+
+        double IndexMBps() const { return indexNs > 0 ? (double)bytes * 1000.0 / (double)indexNs : 0.0; }
+        double BuildMBps() const { return buildNs > 0 ? (double)bytes * 1000.0 / (double)buildNs : 0.0; }
+    };
+    ParserStats GetParserStats();
+}
+
+// NDJSON (JsonLines.h)
+namespace Json {
+    struct LinesResult;
+    
+    // Документ строки действителен только во время вызова (строки ссылаются на окно файла)
+    // line - номер строки в файле с 1; false из обработчика останавливает чтение
+    using LineCallback = std::function<bool(const Document& document, uint64_t line, bool success)>;
 }
 
-// Асинхронный JSON парсер
+// Асинхронный JSON парсер: пул потоков разбора
+// Разовые задачи (ParseAsync, ParseFileAsync, ParseLinesAsync) идут общей очередью по порядку
+// Ответы каналов (эндпоинтов) идут через почтовые ящики "последний побеждает": в ящике не больше
+// одного неразобранного ответа, новый заменяет старый (старый отбрасывается, буфер возвращается в пул).
+// Ящик передаётся атомарной заменой указателя, задача только перемещается; один канал разбирается
+// одним потоком за раз (документ канала переиспользуется), разные каналы - параллельно
 class JsonParser {
 public:
     using ParseCallback = std::function<void(std::shared_ptr<Json::Value>, bool success, const std::string& error)>;
+    // Документ действителен только во время вызова (затем переиспользуется следующим разбором канала)
+    using DocumentCallback = std::function<void(const Json::Document& document, bool success, const std::string& error)>;
+    // Ответ канала целиком (разбор - в обработчике: декодеры UI читают тело сами)
+    using PayloadCallback = std::function<void(PooledBuffer payload)>;
+    // Итог ParseLinesAsync (после последней строки)
+    using LinesDoneCallback = std::function<void(const Json::LinesResult& result)>;
+    
+    static constexpr size_t MAX_CHANNELS = 16;
+    static constexpr size_t DEFAULT_WORKERS = 2;
     
-    JsonParser();
+    // workers - потоки разбора (0 - DEFAULT_WORKERS)
+    // parallelThreads - потоки разбора больших документов по частям (0 - по числу ядер, до 8)
+    explicit JsonParser(size_t workers = 0, size_t parallelThreads = 0);
     ~JsonParser();
     
     // Добавить задачу на парсинг
     void ParseAsync(const std::string& jsonData, ParseCallback callback);
     
-    // Добавить задачу на парсинг из файла
+    // Добавить задачу на парсинг буфера ответа (без копирования, буфер вернётся в пул после разбора)
+    void ParseAsync(PooledBuffer jsonData, ParseCallback callback);
+    
+    // Разбор в документ канала (ящик канала): арена канала переиспользуется между опросами
+    void ParseDocumentAsync(const std::string& channel, PooledBuffer jsonData, DocumentCallback callback);
+    
+    // Последний ответ канала обработчику на потоке разбора (ящик канала)
+    // Только для снимков состояния: неразобранный ответ заменяется новым
+    void DispatchLatestAsync(const std::string& channel, PooledBuffer payload, PayloadCallback callback);
+    
+    // Добавить задачу на парсинг из файла (файл отображается в память и разбирается на месте)
     void ParseFileAsync(const std::string& filePath, ParseCallback callback);
     
-    // Остановить парсер
+    // NDJSON: документ на каждую строку файла (Json::ParseLines, память ограничена окном файла)
+    void ParseLinesAsync(const std::string& filePath, Json::LineCallback lineCallback, LinesDoneCallback doneCallback);
+    
+    // Остановить парсер (общая очередь дорабатывается, ящики отбрасываются)
     void Stop();
     
     // Проверить, работает ли парсер
     bool IsRunning() const { return m_running; }
     
-    // Получить количество задач в очереди
+    // Получить количество задач в очереди (общая очередь и ящики с ответом)
     size_t GetQueueSize() const;
+    size_t GetWorkerCount() const { return m_workers.size(); }
+    
+    // Счётчики ящика канала (дебаг режим)
+    struct ChannelStats {
+        std::string channel;
+        uint64_t posted = 0;     // Ответов положено в ящик
+        uint64_t processed = 0;  // Разобрано
+        uint64_t dropped = 0;    // Заменено новым до разбора
+        uint64_t waitUs = 0;     // Суммарно: от ящика до начала разбора
+        uint64_t parseUs = 0;    // Суммарно: разбор с обработчиком
+        uint64_t maxLatencyUs = 0; // Худшее время от ящика до конца разбора
+        bool pending = false;    // Ответ ждёт в ящике
+        
+        double AverageWaitMs() const { return processed > 0 ? (double)waitUs / (double)processed / 1000.0 : 0.0; }
+        double AverageParseMs() const { return processed > 0 ? (double)parseUs / (double)processed / 1000.0 : 0.0; }
+        double DropRatio() const { return posted > 0 ? (double)dropped / (double)posted : 0.0; }
+    };
+    std::vector<ChannelStats> GetChannelStats() const;
 
 private:
     struct ParseTask {
-        std::string data;
+        PooledBuffer data;
         std::string filePath;
-        bool isFile;
+        bool isFile = false;
         ParseCallback callback;
+        DocumentCallback documentCallback;
+        PayloadCallback payloadCallback;
+        Json::LineCallback lineCallback;
+        LinesDoneCallback linesDoneCallback;
+        std::chrono::steady_clock::time_point postedAt;
     };
     
+    // Ящик канала: слот - атомарный указатель на последнюю задачу (nullptr - пусто)
+    // queued/busy - под m_queueMutex: ящик в очереди готовых / разбирается (не больше одного потока)
+    struct Mailbox {
+        std::string channel; // Не меняется после публикации в m_mailboxes
+        std::atomic<ParseTask*> latest{nullptr};
+        bool queued = false;
+        bool busy = false;
+        std::unique_ptr<Json::Document> document; // Только поток, занявший ящик
+        
+        std::atomic<uint64_t> posted{0};
+        std::atomic<uint64_t> processed{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> waitUs{0};
+        std::atomic<uint64_t> parseUs{0};
+        std::atomic<uint64_t> maxLatencyUs{0};
+    };
+    
+    Mailbox* GetMailbox(const std::string& channel);
+    void Post(Mailbox* mailbox, std::unique_ptr<ParseTask> task);
+    void Enqueue(ParseTask task);
     void WorkerThread();
-    std::string ReadFile(const std::string& filePath);
+    void Process(ParseTask& task, Mailbox* mailbox);
     
-    std::thread m_workerThread;
-    std::queue<ParseTask> m_taskQueue;
+    std::unique_ptr<WorkerPool> m_pool; // Части больших документов (поток разбора - один из исполнителей)
+    std::vector<std::thread> m_workers;
+    std::deque<ParseTask> m_taskQueue;   // Разовые задачи по порядку
+    std::deque<Mailbox*> m_readyMailboxes; // Ящики с ответом, которые никто не разбирает
     mutable std::mutex m_queueMutex;
     std::atomic<bool> m_running;
     std::condition_variable m_condition;
+    
+    // Ящики только добавляются: поиск без блокировки по опубликованным m_mailboxCount
+    std::unique_ptr<Mailbox> m_mailboxes[MAX_CHANNELS];
+    std::atomic<size_t> m_mailboxCount{0};
+    std::mutex m_mailboxMutex; // Добавление ящика
 };
-
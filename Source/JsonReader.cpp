@@ -0,0 +1,375 @@
+#include "JsonReader.h"
+#include "Utf8.h"
+#include <cstring>
+
+namespace Json {
+    bool Reader::Reset(const char* data, size_t size) {
+        m_arena.Reset();
+        m_error.clear();
+        m_data = data;
+        m_size = size;
+        m_next = 0;
+        m_pos = 0;
+        m_depth = 0;
+        m_key = std::string_view();
+        m_keyHash = 0;
+
+        if (!m_index.Build(data, size)) {
+            m_tokens = nullptr;
+            m_count = 0;
+            m_pos = size;
+            return Fail(size > StructuralIndex::MAX_INPUT_SIZE ? "Document too large" : "Unterminated string");
+        }
+        m_tokens = m_index.Positions();
+        m_count = m_index.Count();
+        return true;
+    }
+
+    bool Reader::Fail(const char* message) {
+        if (m_error.empty()) {
+            m_error = std::string(message) + " at offset " + std::to_string(m_pos);
+        }
+        return false;
+    }
+
+    bool Reader::NextToken(char& c) {
+        if (m_next >= m_count) {
+            m_pos = m_size;
+            return false;
+        }
+        m_pos = m_tokens[m_next++];
+        c = m_data[m_pos];
+        return true;
+    }
+
+    char Reader::PeekToken() const {
+        return m_next < m_count ? m_data[m_tokens[m_next]] : '\0';
+    }
+
+    char Reader::PreviousToken() const {
+        return m_next > 0 ? m_data[m_tokens[m_next - 1]] : '\0';
+    }
+
+    size_t Reader::ScalarEnd() const {
+        size_t end = m_next < m_count ? m_tokens[m_next] : m_size;
+        while (end > m_pos && (m_data[end - 1] == ' ' || m_data[end - 1] == '\t' || m_data[end - 1] == '\n' || m_data[end - 1] == '\r')) end--;
+        return end;
+    }
+
+    bool Reader::Open(bool array) {
+        if (m_depth >= Document::MAX_DEPTH) return Fail("Nesting too deep");
+        uint64_t bit = 1ull << (m_depth % 64);
+        if (array) m_kinds[m_depth / 64] |= bit;
+        else m_kinds[m_depth / 64] &= ~bit;
+        m_depth++;
+        return true;
+    }
+
+    bool Reader::IsArray(int level) const {
+        return (m_kinds[level / 64] >> (level % 64)) & 1;
+    }
+
+    bool Reader::Close(char c) {
+        if (m_depth == 0 || (c == ']') != IsArray(m_depth - 1)) return Fail("Mismatched bracket");
+        m_depth--;
+        return true;
+    }
+
+    // Пропуск токенов до возврата на уровень depth
+    // Между кавычками строки индекс токенов не ставит, поэтому строка - ровно два токена
+    bool Reader::SkipTo(int depth) {
+        while (m_depth > depth) {
+            char c;
+            if (!NextToken(c)) return Fail("Unexpected end");
+            switch (c) {
+                case '"':
+                    if (!NextToken(c)) return Fail("Unterminated string");
+                    break;
+                case '{':
+                case '[':
+                    if (!Open(c == '[')) return false;
+                    break;
+                case '}':
+                case ']':
+                    if (!Close(c)) return false;
+                    break;
+            }
+        }
+        return true;
+    }
+
+    ValueType Reader::Peek() const {
+        if (HasError()) return ValueType::Null;
+        switch (PeekToken()) {
+            case '{': return ValueType::Object;
+            case '[': return ValueType::Array;
+            case '"': return ValueType::String;
+            case 't':
+            case 'f': return ValueType::Boolean;
+            case '-':
+            case '0': case '1': case '2': case '3': case '4':
+            case '5': case '6': case '7': case '8': case '9':
+                return ValueType::Number;
+        }
+        return ValueType::Null;
+    }
+
+    bool Reader::EnterObject() {
+        if (HasError()) return false;
+        char c;
+        if (!NextToken(c)) return Fail("Unexpected end");
+        if (c != '{') return Fail("Expected '{'");
+        return Open(false);
+    }
+
+    bool Reader::EnterArray() {
+        if (HasError()) return false;
+        char c;
+        if (!NextToken(c)) return Fail("Unexpected end");
+        if (c != '[') return Fail("Expected '['");
+        return Open(true);
+    }
+
+    // Перед ',' и закрывающей скобкой должно стоять прочитанное значение, перед первым полем - открывающая скобка
+    bool Reader::NextMember() {
+        if (HasError()) return false;
+        if (m_depth == 0 || IsArray(m_depth - 1)) return Fail("Not in object");
+
+        char previous = PreviousToken();
+        bool afterValue = previous != '{' && previous != ',' && previous != ':';
+        char c;
+        if (!NextToken(c)) return Fail("Unexpected end");
+        if (c == '}' && previous != ',' && previous != ':') {
+            Close(c);
+            return false;
+        }
+        if (c == ',' && afterValue) {
+            if (!NextToken(c)) return Fail("Unexpected end");
+        } else if (previous != '{') {
+            return Fail("Expected ',' or '}'");
+        }
+
+        if (c != '"') return Fail("Expected key");
+        if (!ReadStringToken(m_key)) return false;
+        m_keyHash = Key::Hash(m_key);
+        if (!NextToken(c) || c != ':') return Fail("Expected ':'");
+        return true;
+    }
+
+    bool Reader::NextItem() {
+        if (HasError()) return false;
+        if (m_depth == 0 || !IsArray(m_depth - 1)) return Fail("Not in array");
+
+        char previous = PreviousToken();
+        bool afterValue = previous != '[' && previous != ',' && previous != ':';
+        char c = PeekToken();
+        if (c == '\0') {
+            m_pos = m_size;
+            return Fail("Unexpected end");
+        }
+        if (c == ']' && previous != ',') {
+            NextToken(c);
+            Close(c);
+            return false;
+        }
+        if (c == ',' && afterValue) {
+            m_next++;
+            return true;
+        }
+        if (previous != '[') {
+            m_pos = m_tokens[m_next];
+            return Fail("Expected ',' or ']'");
+        }
+        return true;
+    }
+
+    bool Reader::Leave() {
+        if (HasError()) return false;
+        if (m_depth == 0) return Fail("Not in object or array");
+        return SkipTo(m_depth - 1);
+    }
+
+    // Текст строки после открывающей кавычки (текущий токен); следующий токен - закрывающая кавычка
+    bool Reader::ReadStringToken(std::string_view& out) {
+        size_t start = m_pos + 1;
+        char c;
+        if (!NextToken(c)) return Fail("Unterminated string");
+        size_t rawSize = m_pos - start;
+        Utf8::ScanResult scan = Utf8::Scan(m_data + start, rawSize);
+        if (!scan.backslash && scan.valid) {
+            out = std::string_view(m_data + start, rawSize);
+            return true;
+        }
+        if (scan.backslash) {
+            size_t invalid = FindInvalidEscape(m_data + start, rawSize);
+            if (invalid < rawSize) {
+                m_pos = start + invalid;
+                return Fail("Invalid escape");
+            }
+        }
+        char* decoded = m_arena.AllocateArray<char>(DecodedCapacity(rawSize, scan.valid));
+        out = std::string_view(decoded, DecodeEscapes(m_data + start, rawSize, decoded, scan.valid));
+        return true;
+    }
+
+    // Значение, начинающееся с текущего токена; объект или массив пропускается целиком
+    bool Reader::ReadScalar(char c, ValueType& type, bool& boolean, double& number, std::string_view& text) {
+        switch (c) {
+            case 'n':
+            case 't':
+            case 'f': {
+                std::string_view literal(m_data + m_pos, ScalarEnd() - m_pos);
+                if (literal == "null") {
+                    type = ValueType::Null;
+                } else if (literal == "true" || literal == "false") {
+                    type = ValueType::Boolean;
+                    boolean = c == 't';
+                } else {
+                    return Fail("Invalid literal");
+                }
+                return true;
+            }
+            case '"':
+                type = ValueType::String;
+                return ReadStringToken(text);
+            case '{':
+            case '[':
+                type = c == '[' ? ValueType::Array : ValueType::Object;
+                return Open(c == '[') && SkipTo(m_depth - 1);
+            case '-':
+            case '0': case '1': case '2': case '3': case '4':
+            case '5': case '6': case '7': case '8': case '9':
+                type = ValueType::Number;
+                if (!ParseNumber(m_data + m_pos, m_data + ScalarEnd(), number)) return Fail("Invalid number");
+                return true;
+        }
+        return Fail("Expected value");
+    }
+
+    bool Reader::ReadBool() {
+        if (HasError()) return false;
+        char c;
+        if (!NextToken(c)) return Fail("Unexpected end");
+        ValueType type = ValueType::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string_view text;
+        if (!ReadScalar(c, type, boolean, number, text)) return false;
+        if (type == ValueType::Boolean) return boolean;
+        if (type == ValueType::Number) return number != 0.0;
+        if (type == ValueType::String) return !text.empty();
+        return false;
+    }
+
+    double Reader::ReadNumber() {
+        if (HasError()) return 0.0;
+        char c;
+        if (!NextToken(c)) {
+            Fail("Unexpected end");
+            return 0.0;
+        }
+        ValueType type = ValueType::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string_view text;
+        if (!ReadScalar(c, type, boolean, number, text)) return 0.0;
+        if (type == ValueType::Number) return number;
+        if (type == ValueType::Boolean) return boolean ? 1.0 : 0.0;
+        if (type == ValueType::String) ParseNumber(text.data(), text.data() + text.size(), number);
+        return number;
+    }
+
+    std::string_view Reader::ReadStringView() {
+        if (HasError()) return std::string_view();
+        char c;
+        if (!NextToken(c)) {
+            Fail("Unexpected end");
+            return std::string_view();
+        }
+        ValueType type = ValueType::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string_view text;
+        if (!ReadScalar(c, type, boolean, number, text)) return std::string_view();
+        return type == ValueType::String ? text : std::string_view();
+    }
+
+    bool Reader::Skip() {
+        if (HasError()) return false;
+        char c;
+        if (!NextToken(c)) return Fail("Unexpected end");
+        switch (c) {
+            case '"':
+                return NextToken(c) || Fail("Unterminated string");
+            case '{':
+            case '[':
+                return Open(c == '[') && SkipTo(m_depth - 1);
+            case '}':
+            case ']':
+            case ',':
+            case ':':
+                return Fail("Expected value");
+        }
+        return true;
+    }
+
+    bool Reader::Walk(Handler& handler) {
+        if (HasError()) return false;
+        return WalkValue(handler);
+    }
+
+    bool Reader::WalkValue(Handler& handler) {
+        char c;
+        if (!NextToken(c)) return Fail("Unexpected end");
+
+        if (c == '{') {
+            if (!Open(false)) return false;
+            if (!handler.OnBeginObject()) return Fail("Stopped by handler");
+            size_t count = 0;
+            while (NextMember()) {
+                if (!handler.OnKey(m_key)) return Fail("Stopped by handler");
+                if (!WalkValue(handler)) return false;
+                count++;
+            }
+            if (HasError()) return false;
+            return handler.OnEndObject(count) || Fail("Stopped by handler");
+        }
+
+        if (c == '[') {
+            if (!Open(true)) return false;
+            if (!handler.OnBeginArray()) return Fail("Stopped by handler");
+            size_t count = 0;
+            while (NextItem()) {
+                if (!WalkValue(handler)) return false;
+                count++;
+            }
+            if (HasError()) return false;
+            return handler.OnEndArray(count) || Fail("Stopped by handler");
+        }
+
+        ValueType type = ValueType::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string_view text;
+        if (!ReadScalar(c, type, boolean, number, text)) return false;
+        bool proceed = true;
+        switch (type) {
+            case ValueType::Boolean: proceed = handler.OnBool(boolean); break;
+            case ValueType::Number: proceed = handler.OnNumber(number); break;
+            case ValueType::String: proceed = handler.OnString(text); break;
+            default: proceed = handler.OnNull(); break;
+        }
+        return proceed || Fail("Stopped by handler");
+    }
+
+    bool Reader::Finish() {
+        if (HasError()) return false;
+        if (m_next == 0) return Fail("Unexpected end");
+        if (m_depth > 0) return Fail("Unexpected end");
+        if (m_next < m_count) {
+            m_pos = m_tokens[m_next];
+            return Fail("Trailing characters");
+        }
+        return true;
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+#include "JsonParser.h"
+
+// Потоковое чтение JSON без дерева: курсор (pull) и события (SAX) поверх того же индекса токенов
+// Память не зависит от формы документа: индекс позиций и арена для строк с escape переиспользуются между ответами
+namespace Json {
+    // Обработчик событий Reader::Walk; false из любого метода останавливает обход
+    class Handler {
+    public:
+        virtual ~Handler() = default;
+
+        virtual bool OnNull() { return true; }
+        virtual bool OnBool(bool) { return true; }
+        virtual bool OnNumber(double) { return true; }
+        virtual bool OnString(std::string_view) { return true; }
+        virtual bool OnKey(std::string_view) { return true; }
+        virtual bool OnBeginObject() { return true; }
+        virtual bool OnEndObject(size_t) { return true; } // Число полей
+        virtual bool OnBeginArray() { return true; }
+        virtual bool OnEndArray(size_t) { return true; }  // Число элементов
+    };
+
+    // Курсор по значениям документа
+    //
+    //   if (!reader.Reset(json) || !reader.EnterObject()) return;
+    //   while (reader.NextMember()) {
+    //       if (reader.KeyIs(kSpeed)) speed = reader.ReadFloat();
+    //       else reader.Skip();
+    //   }
+    //
+    // Значение каждого поля/элемента должно быть прочитано (Read*, Enter*, Walk) или пропущено (Skip)
+    // Read* принимают любой тип с теми же преобразованиями, что Node::as* (массив/объект пропускается)
+    // Проверяется то, что прочитано; у пропущенных поддеревьев - только парность скобок и кавычек
+    // После первой ошибки все операции возвращают false/значения по умолчанию, текст - GetError()
+    class Reader {
+    public:
+        Reader() = default;
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        // Новый документ; строки без escape указывают прямо в data - буфер должен жить, пока идёт чтение
+        bool Reset(const char* data, size_t size);
+        bool Reset(const std::string& json) { return Reset(json.data(), json.size()); }
+
+        // Тип следующего значения (Null и при ошибке или конце документа)
+        ValueType Peek() const;
+
+        // Объект: EnterObject, затем NextMember до false (закрывающая скобка уже прочитана)
+        bool EnterObject();
+        bool NextMember();
+        std::string_view GetKey() const { return m_key; }
+        uint32_t GetKeyHash() const { return m_keyHash; } // Key::Hash(GetKey())
+        bool KeyIs(const Key& key) const { return m_keyHash == key.hash && m_key == key.name; }
+
+        // Массив: EnterArray, затем NextItem до false
+        bool EnterArray();
+        bool NextItem();
+
+        // Пропустить остаток текущего объекта или массива (выход из цикла раньше конца)
+        bool Leave();
+
+        bool ReadBool();
+        double ReadNumber();
+        float ReadFloat() { return (float)ReadNumber(); }
+        int ReadInt() { return (int)ReadNumber(); }
+        std::string_view ReadStringView(); // Действительна до следующего Reset
+        std::string ReadString() { return std::string(ReadStringView()); }
+
+        // Пропустить следующее значение вместе с поддеревом
+        bool Skip();
+
+        // Отдать следующее значение событиями
+        bool Walk(Handler& handler);
+
+        // Весь документ прочитан без ошибок и после корня ничего нет
+        bool Finish();
+
+        bool HasError() const { return !m_error.empty(); }
+        const std::string& GetError() const { return m_error; }
+
+    private:
+        bool Fail(const char* message);
+        bool NextToken(char& c);
+        char PeekToken() const;
+        char PreviousToken() const;
+        size_t ScalarEnd() const;
+        bool Open(bool array);
+        bool IsArray(int level) const;
+        bool Close(char c);
+        bool SkipTo(int depth);
+        bool ReadScalar(char c, ValueType& type, bool& boolean, double& number, std::string_view& text);
+        bool ReadStringToken(std::string_view& out);
+        bool WalkValue(Handler& handler);
+
+        StructuralIndex m_index;
+        Arena m_arena; // Декодированные строки с escape-последовательностями
+        const char* m_data = nullptr;
+        size_t m_size = 0;
+        const uint32_t* m_tokens = nullptr;
+        size_t m_count = 0;
+        size_t m_next = 0; // Следующий токен
+        size_t m_pos = 0;  // Позиция текущего токена (для сообщений об ошибках)
+        int m_depth = 0;   // Открытых объектов и массивов
+        uint64_t m_kinds[Document::MAX_DEPTH / 64] = {}; // Бит уровня: 1 - массив, 0 - объект
+        std::string_view m_key;
+        uint32_t m_keyHash = 0;
+        std::string m_error;
+    };
+}
@@ -0,0 +1,175 @@
+#include "JsonStream.h"
+
+namespace Json {
+    namespace {
+        bool IsWhitespace(char c) {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
+
+        // Конец числа или литерала: пробел или любой структурный символ
+        bool EndsScalar(char c) {
+            return IsWhitespace(c) || c == ',' || c == ']' || c == '}' || c == '[' || c == '{' || c == '"' || c == ':';
+        }
+    }
+
+    void StreamParser::Reset() {
+        m_expect = Expect::Root;
+        m_rootDone = false;
+        m_inElement = false;
+        m_inString = false;
+        m_escape = false;
+        m_inScalar = false;
+        m_depth = 0;
+        m_baseDepth = 0;
+        m_elementStart = 0;
+        m_elementInChunk = false;
+        m_element.clear();
+        m_offset = 0;
+        m_elements = 0;
+        m_error.clear();
+    }
+
+    bool StreamParser::Fail(const char* message, size_t offset) {
+        if (m_error.empty()) {
+            m_error = std::string(message) + " at offset " + std::to_string(m_offset + offset);
+        }
+        return false;
+    }
+
+    void StreamParser::BeginElement(size_t index) {
+        m_inElement = true;
+        m_elementInChunk = true;
+        m_elementStart = index;
+        m_element.clear();
+    }
+
+    // Элемент целиком в текущей порции отдаётся без копирования, иначе - из m_element
+    void StreamParser::EndElement(const char* data, size_t end) {
+        std::string_view element;
+        if (m_elementInChunk) {
+            element = std::string_view(data + m_elementStart, end - m_elementStart);
+        } else {
+            if (end > 0) m_element.append(data, end);
+            element = m_element;
+        }
+        m_inElement = false;
+        m_elementInChunk = false;
+        m_elements++;
+        if (m_callback) m_callback(element);
+        m_element.clear();
+
+        if (m_baseDepth == 0) {
+            m_rootDone = true;
+            m_expect = Expect::End;
+        } else {
+            m_expect = Expect::Separator;
+        }
+    }
+
+    bool StreamParser::Feed(const char* data, size_t size) {
+        if (HasError()) return false;
+        m_elementInChunk = false;
+
+        for (size_t i = 0; i < size; i++) {
+            char c = data[i];
+
+            if (m_inString) {
+                if (m_escape) {
+                    m_escape = false;
+                } else if (c == '\\') {
+                    m_escape = true;
+                } else if (c == '"') {
+                    m_inString = false;
+                    if (m_depth == m_baseDepth) EndElement(data, i + 1);
+                }
+                continue;
+            }
+
+            if (m_inScalar) {
+                if (!EndsScalar(c)) continue;
+                m_inScalar = false;
+                EndElement(data, i);
+            }
+
+            if (IsWhitespace(c)) continue;
+
+            // Внутри объекта или массива элемента считаются только скобки и строки
+            if (m_inElement) {
+                switch (c) {
+                    case '"':
+                        m_inString = true;
+                        break;
+                    case '{':
+                    case '[':
+                        m_depth++;
+                        break;
+                    case '}':
+                    case ']':
+                        m_depth--;
+                        if (m_depth == m_baseDepth) EndElement(data, i + 1);
+                        break;
+                }
+                continue;
+            }
+
+            // Между элементами корневого массива
+            switch (m_expect) {
+                case Expect::Root:
+                    if (c == '[') {
+                        m_depth = 1;
+                        m_baseDepth = 1;
+                        m_expect = Expect::FirstItem;
+                        continue;
+                    }
+                    m_baseDepth = 0; // Корень - сам себе элемент
+                    break;
+                case Expect::FirstItem:
+                case Expect::Separator:
+                    if (c == ']') {
+                        m_depth = 0;
+                        m_rootDone = true;
+                        m_expect = Expect::End;
+                        continue;
+                    }
+                    if (m_expect == Expect::FirstItem) break;
+                    if (c != ',') return Fail("Expected ',' or ']'", i);
+                    m_expect = Expect::Item;
+                    continue;
+                case Expect::Item:
+                    break;
+                case Expect::End:
+                    return Fail("Trailing characters", i);
+            }
+
+            if (c == ',' || c == ':' || c == ']' || c == '}') return Fail("Expected value", i);
+            BeginElement(i);
+            if (c == '"') {
+                m_inString = true;
+            } else if (c == '{' || c == '[') {
+                m_depth++;
+            } else {
+                m_inScalar = true;
+            }
+        }
+
+        // Незаконченный элемент ждёт следующей порции
+        if (m_inElement) {
+            size_t start = m_elementInChunk ? m_elementStart : 0;
+            m_element.append(data + start, size - start);
+            m_elementInChunk = false;
+        }
+        m_offset += size;
+        return true;
+    }
+
+    bool StreamParser::Finish() {
+        if (HasError()) return false;
+        // Число или литерал в конце входа: весь его текст уже в m_element
+        if (m_inScalar) {
+            m_inScalar = false;
+            EndElement(nullptr, 0);
+        }
+        if (!m_rootDone) return Fail("Unexpected end", 0);
+        return true;
+    }
+}
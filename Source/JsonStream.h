@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+// Разбор JSON порциями по мере приёма (например, прямо из цикла чтения сокета)
+// Корневой массив отдаётся поэлементно: элемент - как только закрылась его скобка или кавычка,
+// другой корень - целиком после своего конца
+// Токены могут разрываться на границах порций: состояние (строка, escape, глубина) переносится между Feed
+namespace Json {
+    class StreamParser {
+    public:
+        // Текст элемента действителен только во время вызова
+        using ElementCallback = std::function<void(std::string_view element)>;
+
+        StreamParser() = default;
+        StreamParser(const StreamParser&) = delete;
+        StreamParser& operator=(const StreamParser&) = delete;
+
+        void SetElementCallback(ElementCallback callback) { m_callback = std::move(callback); }
+
+        // Начать новый документ (буфер незаконченного элемента сохраняет ёмкость)
+        void Reset();
+
+        // Очередная порция; false - нарушена структура корня (дальнейшие порции игнорируются)
+        // Проверяются только границы элементов: скобки, кавычки и запятые корня,
+        // содержимое элемента проверяет тот, кто его читает (Reader, Document)
+        bool Feed(const char* data, size_t size);
+
+        // Вход закончился: true, если корень закрыт и после него только пробелы
+        bool Finish();
+
+        bool IsComplete() const { return m_rootDone; }
+        bool HasError() const { return !m_error.empty(); }
+        const std::string& GetError() const { return m_error; }
+        uint64_t GetElements() const { return m_elements; }
+
+    private:
+        enum class Expect : uint8_t {
+            Root,      // Начало документа
+            FirstItem, // После '[' корня: элемент или ']'
+            Item,      // После ',': только элемент
+            Separator, // После элемента: ',' или ']'
+            End        // Корень закрыт
+        };
+
+        bool Fail(const char* message, size_t offset);
+        void BeginElement(size_t index);
+        void EndElement(const char* data, size_t end);
+
+        ElementCallback m_callback;
+        Expect m_expect = Expect::Root;
+        bool m_rootDone = false;
+        bool m_inElement = false;
+        bool m_inString = false;
+        bool m_escape = false;
+        bool m_inScalar = false;   // Число или литерал элемента
+        int m_depth = 0;           // Открытых скобок, включая корневую
+        int m_baseDepth = 0;       // Глубина, на которой лежит текущий элемент
+        size_t m_elementStart = 0; // Начало элемента в текущей порции (если начался в ней)
+        bool m_elementInChunk = false;
+        std::string m_element;     // Начало элемента из прошлых порций
+        uint64_t m_offset = 0;     // Байт во всех прошлых порциях (для сообщений об ошибках)
+        uint64_t m_elements = 0;
+        std::string m_error;
+    };
+}
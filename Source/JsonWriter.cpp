@@ -0,0 +1,283 @@
+#include "JsonWriter.h"
+#include "Utf8.h"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace Json {
+    namespace {
+        // Байты строки, которые нельзя писать как есть: управляющие, кавычка и '\'
+        struct EscapeTable {
+            bool escape[256] = {};
+
+            constexpr EscapeTable() {
+                for (int c = 0; c < 0x20; c++) escape[c] = true;
+                escape[(unsigned char)'"'] = true;
+                escape[(unsigned char)'\\'] = true;
+            }
+        };
+
+        constexpr EscapeTable g_escapeTable;
+
+        constexpr int MAX_LEVELS = (Document::MAX_DEPTH / 64 + 1) * 64;
+    }
+
+    Writer::Writer(Sink& sink, Style style, int baseIndent)
+        : m_sink(sink), m_style(style), m_baseIndent(baseIndent) {}
+
+    bool Writer::Flush() {
+        if (m_used > 0 && !m_failed) {
+            m_failed = !m_sink.Write(m_buffer, m_used);
+        }
+        m_written += m_used;
+        m_used = 0;
+        return !m_failed;
+    }
+
+    void Writer::Put(const char* data, size_t size) {
+        if (m_used + size > BUFFER_SIZE) {
+            Flush();
+            // Длинный кусок (строка) - мимо буфера
+            if (size >= BUFFER_SIZE) {
+                if (!m_failed) m_failed = !m_sink.Write(data, size);
+                m_written += size;
+                return;
+            }
+        }
+        std::memcpy(m_buffer + m_used, data, size);
+        m_used += size;
+    }
+
+    // Участки без спецсимволов копируются целиком
+    void Writer::PutString(std::string_view text) {
+        static const char HEX[] = "0123456789abcdef";
+        Put('"');
+        size_t runStart = 0;
+        for (size_t i = 0; i < text.size(); i++) {
+            unsigned char c = (unsigned char)text[i];
+            if (!g_escapeTable.escape[c]) continue;
+            Put(text.data() + runStart, i - runStart);
+            runStart = i + 1;
+            char escaped[6] = { '\\', 0, 0, 0, 0, 0 };
+            size_t length = 2;
+            switch (c) {
+                case '"': escaped[1] = '"'; break;
+                case '\\': escaped[1] = '\\'; break;
+                case '\n': escaped[1] = 'n'; break;
+                case '\r': escaped[1] = 'r'; break;
+                case '\t': escaped[1] = 't'; break;
+                case '\b': escaped[1] = 'b'; break;
+                case '\f': escaped[1] = 'f'; break;
+                default:
+                    escaped[1] = 'u';
+                    escaped[2] = '0';
+                    escaped[3] = '0';
+                    escaped[4] = HEX[c >> 4];
+                    escaped[5] = HEX[c & 0xF];
+                    length = 6;
+                    break;
+            }
+            Put(escaped, length);
+        }
+        Put(text.data() + runStart, text.size() - runStart);
+        Put('"');
+    }
+
+    void Writer::NewLine(int level) {
+        static const char SPACES[] = "                                                                ";
+        Put('\n');
+        size_t spaces = (size_t)(m_baseIndent + level) * 2;
+        while (spaces > 0) {
+            size_t count = spaces < sizeof(SPACES) - 1 ? spaces : sizeof(SPACES) - 1;
+            Put(SPACES, count);
+            spaces -= count;
+        }
+    }
+
+    // Запятая и перевод строки перед элементом контейнера (после ключа - ничего)
+    void Writer::BeforeValue() {
+        if (m_afterKey) {
+            m_afterKey = false;
+            return;
+        }
+        if (m_depth == 0) return;
+        int level = m_depth - 1;
+        uint64_t bit = 1ull << (level % 64);
+        if (m_hasItems[level / 64] & bit) Put(',');
+        m_hasItems[level / 64] |= bit;
+        if (m_style == Style::Pretty) NewLine(m_depth);
+    }
+
+    void Writer::Open(char bracket) {
+        BeforeValue();
+        Put(bracket);
+        if (m_depth >= MAX_LEVELS) {
+            m_failed = true;
+            return;
+        }
+        m_hasItems[m_depth / 64] &= ~(1ull << (m_depth % 64));
+        m_depth++;
+    }
+
+    void Writer::Close(char bracket) {
+        if (m_depth == 0) return;
+        m_depth--;
+        bool hasItems = (m_hasItems[m_depth / 64] >> (m_depth % 64)) & 1;
+        if (hasItems && m_style == Style::Pretty) NewLine(m_depth);
+        Put(bracket);
+    }
+
+    void Writer::BeginObject() { Open('{'); }
+    void Writer::EndObject() { Close('}'); }
+    void Writer::BeginArray() { Open('['); }
+    void Writer::EndArray() { Close(']'); }
+
+    void Writer::Key(std::string_view key) {
+        BeforeValue();
+        PutString(key);
+        if (m_style == Style::Pretty) {
+            Put(": ", 2);
+        } else {
+            Put(':');
+        }
+        m_afterKey = true;
+    }
+
+    void Writer::Null() {
+        BeforeValue();
+        Put("null", 4);
+    }
+
+    void Writer::Bool(bool value) {
+        BeforeValue();
+        if (value) {
+            Put("true", 4);
+        } else {
+            Put("false", 5);
+        }
+    }
+
+    void Writer::Number(double value) {
+        BeforeValue();
+        if (!std::isfinite(value)) {
+            Put("null", 4);
+            return;
+        }
+        char text[32];
+        std::to_chars_result result = std::to_chars(text, text + sizeof(text), value);
+        Put(text, (size_t)(result.ptr - text));
+    }
+
+    void Writer::String(std::string_view value) {
+        BeforeValue();
+        PutString(value);
+    }
+
+    void Writer::Raw(std::string_view json) {
+        BeforeValue();
+        Put(json.data(), json.size());
+    }
+
+    void Writer::Write(const Node& node) {
+        switch (node.type()) {
+            case ValueType::Null:
+                Null();
+                break;
+            case ValueType::Boolean:
+                Bool(node.asBool());
+                break;
+            case ValueType::Number:
+                Number(node.asNumber());
+                break;
+            case ValueType::String:
+                if (node.hasEscapes()) {
+                    // Строка ParseBorrowed ещё в исходном виде: декодируется и экранируется заново, как у Parse
+                    // (сырой текст не копируется - одиночные суррогаты и неверный UTF-8 дают U+FFFD)
+                    std::string_view raw = node.asStringView();
+                    bool valid = Utf8::IsValid(raw.data(), raw.size());
+                    thread_local std::string decoded;
+                    decoded.resize(DecodedCapacity(raw.size(), valid));
+                    decoded.resize(DecodeEscapes(raw.data(), raw.size(), decoded.data(), valid));
+                    String(decoded);
+                } else {
+                    String(node.asStringView());
+                }
+                break;
+            case ValueType::Array:
+                BeginArray();
+                for (const Node& item : node.items()) Write(item);
+                EndArray();
+                break;
+            case ValueType::Object:
+                BeginObject();
+                for (const Member& member : node.members()) {
+                    Key(member.key());
+                    Write(member.value);
+                }
+                EndObject();
+                break;
+        }
+    }
+
+    void Writer::Write(View value) {
+        Write(value.GetNode());
+    }
+
+    void Writer::Write(const Value& value) {
+        switch (value.type) {
+            case ValueType::Null:
+                Null();
+                break;
+            case ValueType::Boolean:
+                Bool(value.boolValue);
+                break;
+            case ValueType::Number:
+                Number(value.numberValue);
+                break;
+            case ValueType::String:
+                String(value.stringValue);
+                break;
+            case ValueType::Array:
+                BeginArray();
+                for (const auto& item : value.arrayValue) {
+                    if (item) {
+                        Write(*item);
+                    } else {
+                        Null();
+                    }
+                }
+                EndArray();
+                break;
+            case ValueType::Object:
+                BeginObject();
+                for (const auto& pair : value.objectValue) {
+                    Key(pair.first);
+                    if (pair.second) {
+                        Write(*pair.second);
+                    } else {
+                        Null();
+                    }
+                }
+                EndObject();
+                break;
+        }
+    }
+
+    std::string ToString(const Node& node, Writer::Style style, int baseIndent) {
+        std::string result;
+        StringSink sink(result);
+        Writer writer(sink, style, baseIndent);
+        writer.Write(node);
+        writer.Flush();
+        return result;
+    }
+
+    std::string ToString(const Value& value, Writer::Style style, int baseIndent) {
+        std::string result;
+        StringSink sink(result);
+        Writer writer(sink, style, baseIndent);
+        writer.Write(value);
+        writer.Flush();
+        return result;
+    }
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+
+#include "JsonParser.h"
+
+// Потоковая запись JSON: текст копится в буфере писателя и порциями уходит в приёмник
+// (строка вызывающего или файл); на узел память не выделяется
+namespace Json {
+    // Приёмник готовых порций текста
+    class Sink {
+    public:
+        virtual ~Sink() = default;
+        // false - запись не удалась (дальнейший вывод писатель отбрасывает)
+        virtual bool Write(const char* data, size_t size) = 0;
+    };
+
+    // Дописывает в строку вызывающего (её ёмкость растёт только на порциях)
+    class StringSink : public Sink {
+    public:
+        explicit StringSink(std::string& out) : m_out(out) {}
+        bool Write(const char* data, size_t size) override {
+            m_out.append(data, size);
+            return true;
+        }
+
+    private:
+        std::string& m_out;
+    };
+
+    // Файл, открытый на запись с начала
+    class FileSink : public Sink {
+    public:
+        explicit FileSink(const std::string& path) : m_file(path, std::ios::binary | std::ios::trunc) {}
+        bool IsOpen() const { return m_file.is_open(); }
+        bool Write(const char* data, size_t size) override {
+            m_file.write(data, (std::streamsize)size);
+            return (bool)m_file;
+        }
+
+    private:
+        std::ofstream m_file;
+    };
+
+    // Писатель: события (BeginObject/Key/Number/...) или готовое дерево (Write)
+    //
+    //   std::string text;
+    //   Json::StringSink sink(text);
+    //   Json::Writer writer(sink, Json::Writer::Style::Pretty);
+    //   writer.Write(document.RootView());
+    //   writer.Flush();
+    //
+    // Числа - кратчайшая запись, читаемая обратно в то же double (NaN и бесконечности - null)
+    // Строки экранируются по JSON: кавычка, '\' и управляющие символы
+    class Writer {
+    public:
+        enum class Style {
+            Compact, // Без пробелов и переводов строк
+            Pretty   // Отступы по два пробела, "ключ": значение
+        };
+
+        static constexpr size_t BUFFER_SIZE = 16 * 1024;
+
+        // baseIndent - уровень отступа, с которого начинается вывод (вложенный текст в Pretty)
+        explicit Writer(Sink& sink, Style style = Style::Compact, int baseIndent = 0);
+        ~Writer() { Flush(); }
+
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        void BeginObject();
+        void EndObject();
+        void BeginArray();
+        void EndArray();
+        void Key(std::string_view key);
+        void Null();
+        void Bool(bool value);
+        void Number(double value);
+        void String(std::string_view value);
+        // Готовый текст значения JSON (записывается как есть, без проверки)
+        void Raw(std::string_view json);
+
+        void Write(const Node& node);
+        void Write(View value);
+        void Write(const Value& value);
+
+        // Отдать накопленное приёмнику; false - приёмник отказал (сейчас или раньше)
+        bool Flush();
+        bool HasError() const { return m_failed; }
+        uint64_t GetBytesWritten() const { return m_written + m_used; }
+
+    private:
+        void Put(const char* data, size_t size);
+        void Put(char c) {
+            if (m_used == BUFFER_SIZE) Flush();
+            m_buffer[m_used++] = c;
+        }
+        void PutString(std::string_view text);
+        void NewLine(int level);
+        void BeforeValue();
+        void Open(char bracket);
+        void Close(char bracket);
+
+        Sink& m_sink;
+        Style m_style;
+        int m_baseIndent;
+        int m_depth = 0;
+        bool m_afterKey = false;
+        // Бит уровня: в контейнере уже есть элемент (перед следующим нужна запятая)
+        uint64_t m_hasItems[Document::MAX_DEPTH / 64 + 1] = {};
+        bool m_failed = false;
+        uint64_t m_written = 0;
+        size_t m_used = 0;
+        char m_buffer[BUFFER_SIZE];
+    };
+
+    // Весь документ строкой (Node::toString, Value::toString)
+    std::string ToString(const Node& node, Writer::Style style, int baseIndent = 0);
+    std::string ToString(const Value& value, Writer::Style style, int baseIndent = 0);
+}
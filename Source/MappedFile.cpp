@@ -0,0 +1,149 @@
+#include "MappedFile.h"
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        #ifdef _WIN32
+        m_file = std::exchange(other.m_file, nullptr);
+        m_mapping = std::exchange(other.m_mapping, nullptr);
+        #else
+        m_file = std::exchange(other.m_file, -1);
+        #endif
+        m_size = std::exchange(other.m_size, 0);
+        m_view = std::exchange(other.m_view, nullptr);
+        m_viewSize = std::exchange(other.m_viewSize, 0);
+        m_data = std::exchange(other.m_data, nullptr);
+        m_mappedSize = std::exchange(other.m_mappedSize, 0);
+        m_mappedOffset = std::exchange(other.m_mappedOffset, 0);
+    }
+    return *this;
+}
+
+size_t MappedFile::Granularity() {
+    #ifdef _WIN32
+    static const size_t granularity = [] {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return (size_t)info.dwAllocationGranularity;
+    }();
+    #else
+    static const size_t granularity = (size_t)sysconf(_SC_PAGESIZE);
+    #endif
+    return granularity;
+}
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+    #ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    m_file = file;
+    m_size = (uint64_t)size.QuadPart;
+    // Пустой файл отобразить нельзя: окно всегда пустое
+    if (m_size > 0) {
+        m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mapping) {
+            Close();
+            return false;
+        }
+    }
+    #else
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0) return false;
+    struct stat info;
+    if (fstat(file, &info) != 0) {
+        close(file);
+        return false;
+    }
+    m_file = file;
+    m_size = (uint64_t)info.st_size;
+    #endif
+    return true;
+}
+
+bool MappedFile::IsOpen() const {
+    #ifdef _WIN32
+    return m_file != nullptr;
+    #else
+    return m_file >= 0;
+    #endif
+}
+
+void MappedFile::Close() {
+    Unmap();
+    #ifdef _WIN32
+    if (m_mapping) CloseHandle(m_mapping);
+    if (m_file) CloseHandle(m_file);
+    m_mapping = nullptr;
+    m_file = nullptr;
+    #else
+    if (m_file >= 0) close(m_file);
+    m_file = -1;
+    #endif
+    m_size = 0;
+}
+
+bool MappedFile::Map(uint64_t offset, size_t size) {
+    Unmap();
+    if (!IsOpen() || offset >= m_size) return false;
+    if (size > m_size - offset) size = (size_t)(m_size - offset);
+    if (size == 0) return false;
+
+    uint64_t start = offset - offset % Granularity();
+    size_t delta = (size_t)(offset - start);
+    size_t viewSize = delta + size;
+    #ifdef _WIN32
+    void* view = MapViewOfFile(m_mapping, FILE_MAP_READ, (DWORD)(start >> 32), (DWORD)(start & 0xFFFFFFFFu), viewSize);
+    if (!view) return false;
+    #else
+    void* view = mmap(nullptr, viewSize, PROT_READ, MAP_PRIVATE, m_file, (off_t)start);
+    if (view == MAP_FAILED) return false;
+    // Чтение идёт подряд: система читает вперёд и раньше освобождает пройденные страницы
+    madvise(view, viewSize, MADV_SEQUENTIAL);
+    #endif
+    m_view = view;
+    m_viewSize = viewSize;
+    m_data = (const char*)view + delta;
+    m_mappedSize = size;
+    m_mappedOffset = offset;
+    return true;
+}
+
+void MappedFile::Unmap() {
+    if (m_view) {
+        #ifdef _WIN32
+        UnmapViewOfFile(m_view);
+        #else
+        munmap(m_view, m_viewSize);
+        #endif
+    }
+    m_view = nullptr;
+    m_viewSize = 0;
+    m_data = nullptr;
+    m_mappedSize = 0;
+    m_mappedOffset = 0;
+}
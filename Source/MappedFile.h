@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Файл, отображённый в память только для чтения (CreateFileMapping / mmap)
+// Отображается окно файла: весь файл (разбор на месте) или его часть (потоковое чтение с ограниченной памятью)
+// Страницы подгружает система по мере чтения, копий в куче нет
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Открыть файл (окно не отображается); false - файл не открыт
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const;
+    uint64_t Size() const { return m_size; }
+
+    // Отобразить [offset, offset + size) файла (size обрезается по концу файла), прошлое окно снимается
+    // false - окно пустое или система отказала
+    bool Map(uint64_t offset, size_t size);
+    void Unmap();
+
+    // Начало окна (данные с offset из Map) и его размер
+    const char* Data() const { return m_data; }
+    size_t MappedSize() const { return m_mappedSize; }
+    uint64_t MappedOffset() const { return m_mappedOffset; }
+
+    // Выравнивание начала отображения в системе (окно начинается не с любого байта)
+    static size_t Granularity();
+
+private:
+    #ifdef _WIN32
+    void* m_file = nullptr;    // HANDLE файла
+    void* m_mapping = nullptr; // HANDLE отображения
+    #else
+    int m_file = -1;
+    #endif
+    uint64_t m_size = 0;
+
+    void* m_view = nullptr;    // Выровненное начало отображения
+    size_t m_viewSize = 0;
+    const char* m_data = nullptr;
+    size_t m_mappedSize = 0;
+    uint64_t m_mappedOffset = 0;
+};
@@ -0,0 +1,326 @@
+#include "Reactor.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <cerrno>
+#endif
+
+// ===== TimerWheel =====
+
+TimerWheel::TimerWheel()
+    : m_slots(SLOT_COUNT)
+    , m_occupied{}
+    , m_origin(Clock::now())
+    , m_currentTick(0)
+    , m_nextId(1)
+    , m_count(0)
+    , m_next(Clock::time_point::max())
+    , m_nextValid(true)
+{
+}
+
+int64_t TimerWheel::TickOf(Clock::time_point when) const {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(when - m_origin).count();
+    return ms > 0 ? ms / TICK_MS : 0;
+}
+
+size_t TimerWheel::SlotFor(Clock::time_point when) const {
+    int64_t tick = std::max(TickOf(when), m_currentTick);
+    return (size_t)(tick % (int64_t)SLOT_COUNT);
+}
+
+void TimerWheel::MarkSlot(size_t slot, bool occupied) {
+    uint64_t bit = 1ull << (slot % 64);
+    if (occupied) m_occupied[slot / 64] |= bit;
+    else m_occupied[slot / 64] &= ~bit;
+}
+
+TimerWheel::TimerId TimerWheel::Schedule(Clock::time_point when, Handler handler) {
+    TimerId id = m_nextId++;
+    size_t slot = SlotFor(when);
+    m_slots[slot].push_back(Entry{ id, when, std::move(handler) });
+    m_slotOf[id] = slot;
+    MarkSlot(slot, true);
+    m_count++;
+    if (m_nextValid && when < m_next) m_next = when;
+    return id;
+}
+
+void TimerWheel::Cancel(TimerId id) {
+    auto found = m_slotOf.find(id);
+    if (found == m_slotOf.end()) return;
+    size_t slotIndex = found->second;
+    m_slotOf.erase(found);
+    auto& slot = m_slots[slotIndex];
+    for (size_t i = 0; i < slot.size(); i++) {
+        if (slot[i].id == id) {
+            if (slot[i].when <= m_next) m_nextValid = false;
+            slot.erase(slot.begin() + i);
+            if (slot.empty()) MarkSlot(slotIndex, false);
+            m_count--;
+            return;
+        }
+    }
+}
+
+void TimerWheel::CollectExpired(Clock::time_point now, std::vector<Handler>& out) {
+    int64_t nowTick = TickOf(now);
+    // Проходим слоты с текущего тика до нынешнего (не больше одного оборота колеса)
+    int64_t ticks = std::min<int64_t>(nowTick - m_currentTick, (int64_t)SLOT_COUNT - 1);
+    for (int64_t i = 0; i <= ticks; i++) {
+        size_t slotIndex = (size_t)((m_currentTick + i) % (int64_t)SLOT_COUNT);
+        auto& slot = m_slots[slotIndex];
+        if (slot.empty()) continue;
+        // Записи следующих оборотов остаются в слоте
+        for (size_t j = 0; j < slot.size();) {
+            if (slot[j].when <= now) {
+                out.push_back(std::move(slot[j].handler));
+                m_slotOf.erase(slot[j].id);
+                slot.erase(slot.begin() + j);
+                m_count--;
+                m_nextValid = false;
+            } else {
+                j++;
+            }
+        }
+        if (slot.empty()) MarkSlot(slotIndex, false);
+    }
+    m_currentTick = std::max(m_currentTick, nowTick);
+}
+
+TimerWheel::Clock::time_point TimerWheel::FindNextExpiry() const {
+    Clock::time_point later = Clock::time_point::max();
+    size_t base = (size_t)(m_currentTick % (int64_t)SLOT_COUNT);
+    // Непустые слоты по кругу от текущего: первый слот с записью этого оборота даёт ближайший срок,
+    // записи следующих оборотов нужны, только если в этом обороте таймеров нет
+    for (size_t distance = 0; distance < SLOT_COUNT;) {
+        size_t slotIndex = (base + distance) % SLOT_COUNT;
+        uint64_t word = m_occupied[slotIndex / 64] >> (slotIndex % 64);
+        if (word == 0) {
+            distance += 64 - slotIndex % 64;
+            continue;
+        }
+        size_t skip = 0;
+        while ((word & 1) == 0) {
+            word >>= 1;
+            skip++;
+        }
+        distance += skip;
+        if (distance >= SLOT_COUNT) break;
+        slotIndex = (base + distance) % SLOT_COUNT;
+
+        Clock::time_point next = Clock::time_point::max();
+        for (const auto& entry : m_slots[slotIndex]) {
+            if (TickOf(entry.when) <= m_currentTick + (int64_t)distance) {
+                if (entry.when < next) next = entry.when;
+            } else if (entry.when < later) {
+                later = entry.when;
+            }
+        }
+        if (next != Clock::time_point::max()) return next;
+        distance++;
+    }
+    return later;
+}
+
+TimerWheel::Clock::time_point TimerWheel::NextExpiry() const {
+    if (m_count == 0) return Clock::time_point::max();
+    if (!m_nextValid) {
+        m_next = FindNextExpiry();
+        m_nextValid = true;
+    }
+    return m_next;
+}
+
+// ===== Reactor =====
+
+Reactor::Reactor()
+    : m_generation(0)
+    , m_wakeSocket(Http::InvalidSocket)
+    , m_wakeAddressLength(0)
+    , m_stopping(false)
+    , m_wakeups(0)
+{
+    Http::InitSockets();
+    std::memset(&m_wakeAddress, 0, sizeof(m_wakeAddress));
+    CreateWakeSocket();
+}
+
+Reactor::~Reactor() {
+    Http::CloseSocket(m_wakeSocket);
+    Http::ShutdownSockets();
+}
+
+bool Reactor::CreateWakeSocket() {
+    m_wakeSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (m_wakeSocket == Http::InvalidSocket) return false;
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+
+    socklen_t length = sizeof(address);
+    if (bind(m_wakeSocket, (const sockaddr*)&address, sizeof(address)) != 0 ||
+        getsockname(m_wakeSocket, (sockaddr*)&address, &length) != 0 ||
+        !Http::SetNonBlocking(m_wakeSocket)) {
+        Http::CloseSocket(m_wakeSocket);
+        m_wakeSocket = Http::InvalidSocket;
+        return false;
+    }
+
+    std::memcpy(&m_wakeAddress, &address, sizeof(address));
+    m_wakeAddressLength = (int)sizeof(address);
+    return true;
+}
+
+void Reactor::DrainWakeSocket() {
+    char buffer[64];
+    while (recv(m_wakeSocket, buffer, sizeof(buffer), 0) > 0) {}
+}
+
+void Reactor::Wake() {
+    if (m_wakeSocket == Http::InvalidSocket) return;
+    char byte = 0;
+    sendto(m_wakeSocket, &byte, 1, 0, (const sockaddr*)&m_wakeAddress, m_wakeAddressLength);
+}
+
+void Reactor::Stop() {
+    m_stopping = true;
+    Wake();
+}
+
+void Reactor::Post(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(m_postMutex);
+        m_posted.push_back(std::move(task));
+    }
+    Wake();
+}
+
+void Reactor::RunPosted() {
+    std::vector<Task> tasks;
+    {
+        std::lock_guard<std::mutex> lock(m_postMutex);
+        tasks.swap(m_posted);
+    }
+    for (auto& task : tasks) {
+        task();
+    }
+}
+
+void Reactor::Watch(Http::SocketHandle socket, bool wantRead, bool wantWrite, IoHandler handler) {
+    WatchEntry& entry = m_watches[socket];
+    entry.wantRead = wantRead;
+    entry.wantWrite = wantWrite;
+    entry.generation = ++m_generation;
+    entry.handler = std::move(handler);
+}
+
+void Reactor::Unwatch(Http::SocketHandle socket) {
+    m_watches.erase(socket);
+}
+
+Reactor::TimerId Reactor::AddTimerAt(Clock::time_point when, TimerWheel::Handler handler) {
+    return m_timers.Schedule(when, std::move(handler));
+}
+
+Reactor::TimerId Reactor::AddTimer(std::chrono::milliseconds delay, TimerWheel::Handler handler) {
+    return m_timers.Schedule(Clock::now() + delay, std::move(handler));
+}
+
+void Reactor::CancelTimer(TimerId id) {
+    m_timers.Cancel(id);
+}
+
+void Reactor::Run() {
+    #ifdef _WIN32
+    using PollFd = WSAPOLLFD;
+    const short readEvents = POLLRDNORM;
+    const short writeEvents = POLLWRNORM;
+    #else
+    using PollFd = pollfd;
+    const short readEvents = POLLIN;
+    const short writeEvents = POLLOUT;
+    #endif
+
+    std::vector<PollFd> pollFds;
+    std::vector<uint64_t> generations;
+    std::vector<TimerWheel::Handler> expired;
+
+    while (!m_stopping) {
+        RunPosted();
+
+        expired.clear();
+        m_timers.CollectExpired(Clock::now(), expired);
+        for (auto& handler : expired) {
+            handler();
+            if (m_stopping) break;
+        }
+        if (m_stopping) break;
+
+        // Ждём ровно до ближайшего таймера (без периодических пробуждений)
+        int timeoutMs = -1;
+        Clock::time_point next = m_timers.NextExpiry();
+        if (next != Clock::time_point::max()) {
+            auto waitUs = std::chrono::duration_cast<std::chrono::microseconds>(next - Clock::now()).count();
+            timeoutMs = waitUs > 0 ? (int)((waitUs + 999) / 1000) : 0;
+        }
+
+        pollFds.clear();
+        generations.clear();
+
+        PollFd wakeFd = {};
+        wakeFd.fd = m_wakeSocket;
+        wakeFd.events = readEvents;
+        pollFds.push_back(wakeFd);
+        generations.push_back(0);
+
+        for (const auto& pair : m_watches) {
+            PollFd pfd = {};
+            pfd.fd = pair.first;
+            pfd.events = (short)((pair.second.wantRead ? readEvents : 0) | (pair.second.wantWrite ? writeEvents : 0));
+            pollFds.push_back(pfd);
+            generations.push_back(pair.second.generation);
+        }
+
+        #ifdef _WIN32
+        int result = WSAPoll(pollFds.data(), (ULONG)pollFds.size(), timeoutMs);
+        #else
+        int result = poll(pollFds.data(), (nfds_t)pollFds.size(), timeoutMs);
+        if (result < 0 && errno == EINTR) continue;
+        #endif
+
+        m_wakeups.fetch_add(1, std::memory_order_relaxed);
+        if (result <= 0) continue;
+
+        if (pollFds[0].revents != 0) {
+            DrainWakeSocket();
+        }
+
+        for (size_t i = 1; i < pollFds.size() && !m_stopping; i++) {
+            short revents = pollFds[i].revents;
+            if (revents == 0) continue;
+
+            // Обработчик мог снять или переподписать сокет - проверяем поколение
+            auto it = m_watches.find(pollFds[i].fd);
+            if (it == m_watches.end() || it->second.generation != generations[i]) continue;
+
+            bool readable = (revents & readEvents) != 0;
+            bool writable = (revents & writeEvents) != 0;
+            bool error = (revents & (POLLERR | POLLHUP | POLLNVAL)) != 0;
+
+            IoHandler handler = it->second.handler;
+            handler(readable, writable, error);
+        }
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "HttpClient.h"
+
+// Колесо таймеров: слоты по TICK_MS, срабатывание по точному времени истечения
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimerId = uint64_t;
+    using Handler = std::function<void()>;
+
+    static constexpr int TICK_MS = 5;
+    static constexpr size_t SLOT_COUNT = 512; // ~2.5 секунды на оборот
+
+    TimerWheel();
+
+    TimerId Schedule(Clock::time_point when, Handler handler);
+    void Cancel(TimerId id);
+
+    // Забрать все истёкшие таймеры (обработчики вызываются снаружи, чтобы они могли ставить новые таймеры)
+    void CollectExpired(Clock::time_point now, std::vector<Handler>& out);
+
+    // Время ближайшего таймера (Clock::time_point::max() если таймеров нет)
+    Clock::time_point NextExpiry() const;
+
+    bool Empty() const { return m_count == 0; }
+
+private:
+    struct Entry {
+        TimerId id;
+        Clock::time_point when;
+        Handler handler;
+    };
+
+    size_t SlotFor(Clock::time_point when) const;
+    int64_t TickOf(Clock::time_point when) const;
+    void MarkSlot(size_t slot, bool occupied);
+    Clock::time_point FindNextExpiry() const;
+
+    std::vector<std::vector<Entry>> m_slots;
+    std::unordered_map<TimerId, size_t> m_slotOf; // id -> слот, чтобы Cancel не обходил колесо
+    uint64_t m_occupied[SLOT_COUNT / 64];          // Непустые слоты
+    Clock::time_point m_origin;
+    int64_t m_currentTick;
+    TimerId m_nextId;
+    size_t m_count;
+    // Ближайший срок; пересчитывается, только когда снят или сработал самый ранний таймер
+    mutable Clock::time_point m_next;
+    mutable bool m_nextValid;
+};
+
+// Однопоточный реактор: ожидание готовности сокетов (WSAPoll/poll) + таймеры
+// Все методы, кроме Post/Stop/Wake, вызываются только из потока реактора
+class Reactor {
+public:
+    using Clock = TimerWheel::Clock;
+    using TimerId = TimerWheel::TimerId;
+    using IoHandler = std::function<void(bool readable, bool writable, bool error)>;
+    using Task = std::function<void()>;
+
+    Reactor();
+    ~Reactor();
+
+    // Подписка на события сокета (повторный вызов меняет интерес)
+    void Watch(Http::SocketHandle socket, bool wantRead, bool wantWrite, IoHandler handler);
+    void Unwatch(Http::SocketHandle socket);
+
+    TimerId AddTimerAt(Clock::time_point when, TimerWheel::Handler handler);
+    TimerId AddTimer(std::chrono::milliseconds delay, TimerWheel::Handler handler);
+    void CancelTimer(TimerId id);
+
+    // Потокобезопасно: выполнить задачу в потоке реактора
+    void Post(Task task);
+
+    // Цикл событий до вызова Stop()
+    void Run();
+
+    // Потокобезопасно: завершить Run() без ожидания таймеров
+    void Stop();
+    void Wake();
+
+    // Счётчик пробуждений цикла (для дебаг статистики)
+    uint64_t GetWakeupCount() const { return m_wakeups.load(std::memory_order_relaxed); }
+
+private:
+    struct WatchEntry {
+        bool wantRead = false;
+        bool wantWrite = false;
+        uint64_t generation = 0;
+        IoHandler handler;
+    };
+
+    bool CreateWakeSocket();
+    void DrainWakeSocket();
+    void RunPosted();
+
+    std::unordered_map<Http::SocketHandle, WatchEntry> m_watches;
+    uint64_t m_generation;
+    TimerWheel m_timers;
+
+    Http::SocketHandle m_wakeSocket; // UDP сокет на 127.0.0.1, отправляет датаграмму сам себе
+    sockaddr_storage m_wakeAddress;
+    int m_wakeAddressLength;
+
+    std::mutex m_postMutex;
+    std::vector<Task> m_posted;
+
+    std::atomic<bool> m_stopping;
+    std::atomic<uint64_t> m_wakeups;
+};
@@ -0,0 +1,1424 @@
+// Сгенерировано tools/generate_schema.py из vendor/WarThunder-localhost-documentation-master/*/*.md - не править вручную
+
+#include "Schema.h"
+#include <algorithm>
+#include <iterator>
+#include <cstdio>
+
+namespace Schema {
+    namespace {
+        template <typename T>
+        T ReadScalar(Json::Reader& reader);
+        template <> float ReadScalar<float>(Json::Reader& reader) { return reader.ReadFloat(); }
+        template <> int ReadScalar<int>(Json::Reader& reader) { return reader.ReadInt(); }
+
+        // Массив скаляров: первые N элементов, count - все элементы ответа
+        template <typename T, size_t N>
+        void ReadArray(Json::Reader& reader, T (&values)[N], size_t& count) {
+            count = 0;
+            if (reader.Peek() != Json::ValueType::Array) {
+                reader.Skip();
+                return;
+            }
+            reader.EnterArray();
+            while (reader.NextItem()) {
+                T value = ReadScalar<T>(reader);
+                if (count < N) values[count] = value;
+                count++;
+            }
+        }
+
+        template <typename T>
+        void ReadObjects(Json::Reader& reader, std::vector<T>& out) {
+            out.clear();
+            if (reader.Peek() != Json::ValueType::Array) {
+                reader.Skip();
+                return;
+            }
+            reader.EnterArray();
+            while (reader.NextItem()) {
+                out.emplace_back();
+                if (!Read(reader, out.back())) out.pop_back();
+            }
+        }
+
+        template <typename T>
+        void LookupObjects(Json::View items, std::vector<T>& out) {
+            out.clear();
+            for (size_t i = 0; i < items.size(); i++) {
+                if (!items[i].isObject()) continue;
+                out.emplace_back();
+                Lookup(items[i], out.back());
+            }
+        }
+
+        // "RPM 12" -> "RPM ", 12, ""; номер - последнее число после пробела, дальше конец ключа или запятая
+        bool SplitNumbered(std::string_view key, std::string_view& prefix, size_t& number, std::string_view& suffix) {
+            size_t end = key.find(',');
+            if (end == std::string_view::npos) end = key.size();
+            size_t start = end;
+            while (start > 0 && key[start - 1] >= '0' && key[start - 1] <= '9') start--;
+            if (start == end || start == 0 || key[start - 1] != ' ' || end - start > 3) return false;
+            number = 0;
+            for (size_t i = start; i < end; i++) number = number * 10 + (size_t)(key[i] - '0');
+            prefix = key.substr(0, start);
+            suffix = key.substr(end);
+            return true;
+        }
+
+        // Json::Key::Hash(prefix + "_N_" + suffix) без сборки строки
+        uint32_t TemplateHash(std::string_view prefix, std::string_view suffix) {
+            uint32_t hash = 2166136261u;
+            for (std::string_view part : { prefix, std::string_view("_N_"), suffix }) {
+                for (char c : part) {
+                    hash ^= (unsigned char)c;
+                    hash *= 16777619u;
+                }
+            }
+            return hash;
+        }
+
+        std::string_view NumberedKey(char* buffer, size_t capacity, std::string_view prefix, size_t number, std::string_view suffix) {
+            int size = snprintf(buffer, capacity, "%.*s%zu%.*s", (int)prefix.size(), prefix.data(), number, (int)suffix.size(), suffix.data());
+            return std::string_view(buffer, size > 0 ? std::min((size_t)size, capacity - 1) : 0);
+        }
+    }
+
+    void GameChatMessage::Clear() {
+        id = 0;
+        msg = std::string_view();
+        sender = std::string_view();
+        enemy = false;
+        mode = std::string_view();
+    }
+
+    void HudMessage::Clear() {
+        id = 0;
+        msg = std::string_view();
+        sender = std::string_view();
+        enemy = false;
+        mode = std::string_view();
+    }
+
+    void Hudmsg::Clear() {
+        events.clear();
+        damage.clear();
+    }
+
+    void Indicators::Clear() {
+        valid = false;
+        type = std::string_view();
+        speed = 0.0f;
+        pedals = 0.0f;
+        pedals1 = 0.0f;
+        pedals2 = 0.0f;
+        pedals3 = 0.0f;
+        stick_elevator = 0.0f;
+        stick_elevator1 = 0.0f;
+        stick_ailerons = 0.0f;
+        vario = 0.0f;
+        altitude_hour = 0.0f;
+        altitude_min = 0.0f;
+        altitude_10k = 0.0f;
+        aviahorizon_roll = 0.0f;
+        aviahorizon_pitch = 0.0f;
+        bank = 0.0f;
+        turn = 0.0f;
+        compass = 0.0f;
+        compass1 = 0.0f;
+        compass2 = 0.0f;
+        clock_hour = 0.0f;
+        clock_min = 0.0f;
+        clock_sec = 0.0f;
+        rpm_min = 0.0f;
+        rpm1_min = 0.0f;
+        rpm_hour = 0.0f;
+        rpm1_hour = 0.0f;
+        oil_pressure = 0.0f;
+        oil_pressure1 = 0.0f;
+        head_temperature = 0.0f;
+        head_temperature1 = 0.0f;
+        fuel = 0.0f;
+        fuel1 = 0.0f;
+        fuel_pressure = 0.0f;
+        fuel_pressure1 = 0.0f;
+        airbrake_lever = 0.0f;
+        airbrake_indicator = 0.0f;
+        gears = 0.0f;
+        gears1 = 0.0f;
+        gears_lamp = 0.0f;
+        flaps = 0.0f;
+        flaps1 = 0.0f;
+        throttle = 0.0f;
+        throttle1 = 0.0f;
+        weapon2 = 0.0f;
+        weapon3 = 0.0f;
+        mach = 0.0f;
+        g_meter = 0.0f;
+        g_meter_min = 0.0f;
+        g_meter_max = 0.0f;
+        blister1 = 0.0f;
+        blister2 = 0.0f;
+        blister3 = 0.0f;
+        blister4 = 0.0f;
+        blister5 = 0.0f;
+        blister6 = 0.0f;
+        blister7 = 0.0f;
+        wing_sweep_lever = 0.0f;
+    }
+
+    void MapObject::Clear() {
+        type = std::string_view();
+        color = std::string_view();
+        std::fill(std::begin(color_array), std::end(color_array), 0);
+        color_array_count = 0;
+        blink = 0;
+        icon = std::string_view();
+        icon_bg = std::string_view();
+        x = 0.0f;
+        y = 0.0f;
+        sx = 0.0f;
+        sy = 0.0f;
+        ex = 0.0f;
+        ey = 0.0f;
+        dx = 0.0f;
+        dy = 0.0f;
+    }
+
+    void MapInfo::Clear() {
+        std::fill(std::begin(grid_steps), std::end(grid_steps), 0.0f);
+        grid_steps_count = 0;
+        std::fill(std::begin(grid_zero), std::end(grid_zero), 0.0f);
+        grid_zero_count = 0;
+        map_generation = 0;
+        std::fill(std::begin(map_max), std::end(map_max), 0.0f);
+        map_max_count = 0;
+        std::fill(std::begin(map_min), std::end(map_min), 0.0f);
+        map_min_count = 0;
+        valid = false;
+        hud_type = 0;
+    }
+
+    void MissionObjective::Clear() {
+        primary = false;
+        status = std::string_view();
+        text = std::string_view();
+    }
+
+    void Mission::Clear() {
+        objectives.clear();
+        status = std::string_view();
+    }
+
+    void State::Clear() {
+        valid = false;
+        aileron_pct = 0;
+        elevator_pct = 0;
+        rudder_pct = 0;
+        h_m = 0;
+        tas_km_h = 0;
+        ias_km_h = 0;
+        m = 0.0f;
+        aoa_deg = 0.0f;
+        aos_deg = 0.0f;
+        ny = 0.0f;
+        vy_m_s = 0.0f;
+        wx_deg_s = 0;
+        mfuel_kg = 0;
+        mfuel0_kg = 0;
+        std::fill(std::begin(throttle_pct), std::end(throttle_pct), 0);
+        std::fill(std::begin(radiator_pct), std::end(radiator_pct), 0);
+        std::fill(std::begin(magneto), std::end(magneto), 0);
+        std::fill(std::begin(power_hp), std::end(power_hp), 0.0f);
+        std::fill(std::begin(rpm), std::end(rpm), 0);
+        std::fill(std::begin(manifold_pressure_atm), std::end(manifold_pressure_atm), 0.0f);
+        std::fill(std::begin(water_temp_c), std::end(water_temp_c), 0);
+        std::fill(std::begin(oil_temp_c), std::end(oil_temp_c), 0);
+        std::fill(std::begin(pitch_deg), std::end(pitch_deg), 0.0f);
+        std::fill(std::begin(thrust_kgs), std::end(thrust_kgs), 0);
+        std::fill(std::begin(efficiency_pct), std::end(efficiency_pct), 0);
+        flaps_pct = 0;
+        std::fill(std::begin(mixture_pct), std::end(mixture_pct), 0);
+        engines = 0;
+    }
+
+    bool Read(Json::Reader& reader, GameChatMessage& out) {
+        out.Clear();
+        if (reader.Peek() != Json::ValueType::Object) {
+            reader.Skip();
+            return false;
+        }
+        reader.EnterObject();
+        while (reader.NextMember()) {
+            std::string_view key = reader.GetKey();
+            switch (reader.GetKeyHash()) {
+                case Json::Key::Hash("id"):
+                    if (key == "id") {
+                        out.id = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("msg"):
+                    if (key == "msg") {
+                        out.msg = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("sender"):
+                    if (key == "sender") {
+                        out.sender = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("enemy"):
+                    if (key == "enemy") {
+                        out.enemy = reader.ReadBool();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("mode"):
+                    if (key == "mode") {
+                        out.mode = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            reader.Skip();
+        }
+        return !reader.HasError();
+    }
+
+    bool Read(Json::Reader& reader, HudMessage& out) {
+        out.Clear();
+        if (reader.Peek() != Json::ValueType::Object) {
+            reader.Skip();
+            return false;
+        }
+        reader.EnterObject();
+        while (reader.NextMember()) {
+            std::string_view key = reader.GetKey();
+            switch (reader.GetKeyHash()) {
+                case Json::Key::Hash("id"):
+                    if (key == "id") {
+                        out.id = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("msg"):
+                    if (key == "msg") {
+                        out.msg = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("sender"):
+                    if (key == "sender") {
+                        out.sender = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("enemy"):
+                    if (key == "enemy") {
+                        out.enemy = reader.ReadBool();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("mode"):
+                    if (key == "mode") {
+                        out.mode = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            reader.Skip();
+        }
+        return !reader.HasError();
+    }
+
+    bool Read(Json::Reader& reader, Hudmsg& out) {
+        out.Clear();
+        if (reader.Peek() != Json::ValueType::Object) {
+            reader.Skip();
+            return false;
+        }
+        reader.EnterObject();
+        while (reader.NextMember()) {
+            std::string_view key = reader.GetKey();
+            switch (reader.GetKeyHash()) {
+                case Json::Key::Hash("events"):
+                    if (key == "events") {
+                        ReadObjects(reader, out.events);
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("damage"):
+                    if (key == "damage") {
+                        ReadObjects(reader, out.damage);
+                        continue;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            reader.Skip();
+        }
+        return !reader.HasError();
+    }
+
+    bool Read(Json::Reader& reader, Indicators& out) {
+        out.Clear();
+        if (reader.Peek() != Json::ValueType::Object) {
+            reader.Skip();
+            return false;
+        }
+        reader.EnterObject();
+        while (reader.NextMember()) {
+            std::string_view key = reader.GetKey();
+            switch (reader.GetKeyHash()) {
+                case Json::Key::Hash("valid"):
+                    if (key == "valid") {
+                        out.valid = reader.ReadBool();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("type"):
+                    if (key == "type") {
+                        out.type = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("speed"):
+                    if (key == "speed") {
+                        out.speed = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("pedals"):
+                    if (key == "pedals") {
+                        out.pedals = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("pedals1"):
+                    if (key == "pedals1") {
+                        out.pedals1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("pedals2"):
+                    if (key == "pedals2") {
+                        out.pedals2 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("pedals3"):
+                    if (key == "pedals3") {
+                        out.pedals3 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("stick_elevator"):
+                    if (key == "stick_elevator") {
+                        out.stick_elevator = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("stick_elevator1"):
+                    if (key == "stick_elevator1") {
+                        out.stick_elevator1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("stick_ailerons"):
+                    if (key == "stick_ailerons") {
+                        out.stick_ailerons = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("vario"):
+                    if (key == "vario") {
+                        out.vario = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("altitude_hour"):
+                    if (key == "altitude_hour") {
+                        out.altitude_hour = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("altitude_min"):
+                    if (key == "altitude_min") {
+                        out.altitude_min = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("altitude_10k"):
+                    if (key == "altitude_10k") {
+                        out.altitude_10k = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("aviahorizon_roll"):
+                    if (key == "aviahorizon_roll") {
+                        out.aviahorizon_roll = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("aviahorizon_pitch"):
+                    if (key == "aviahorizon_pitch") {
+                        out.aviahorizon_pitch = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("bank"):
+                    if (key == "bank") {
+                        out.bank = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("turn"):
+                    if (key == "turn") {
+                        out.turn = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("compass"):
+                    if (key == "compass") {
+                        out.compass = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("compass1"):
+                    if (key == "compass1") {
+                        out.compass1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("compass2"):
+                    if (key == "compass2") {
+                        out.compass2 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("clock_hour"):
+                    if (key == "clock_hour") {
+                        out.clock_hour = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("clock_min"):
+                    if (key == "clock_min") {
+                        out.clock_min = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("clock_sec"):
+                    if (key == "clock_sec") {
+                        out.clock_sec = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("rpm_min"):
+                    if (key == "rpm_min") {
+                        out.rpm_min = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("rpm1_min"):
+                    if (key == "rpm1_min") {
+                        out.rpm1_min = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("rpm_hour"):
+                    if (key == "rpm_hour") {
+                        out.rpm_hour = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("rpm1_hour"):
+                    if (key == "rpm1_hour") {
+                        out.rpm1_hour = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("oil_pressure"):
+                    if (key == "oil_pressure") {
+                        out.oil_pressure = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("oil_pressure1"):
+                    if (key == "oil_pressure1") {
+                        out.oil_pressure1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("head_temperature"):
+                    if (key == "head_temperature") {
+                        out.head_temperature = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("head_temperature1"):
+                    if (key == "head_temperature1") {
+                        out.head_temperature1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("fuel"):
+                    if (key == "fuel") {
+                        out.fuel = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("fuel1"):
+                    if (key == "fuel1") {
+                        out.fuel1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("fuel_pressure"):
+                    if (key == "fuel_pressure") {
+                        out.fuel_pressure = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("fuel_pressure1"):
+                    if (key == "fuel_pressure1") {
+                        out.fuel_pressure1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("airbrake_lever"):
+                    if (key == "airbrake_lever") {
+                        out.airbrake_lever = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("airbrake_indicator"):
+                    if (key == "airbrake_indicator") {
+                        out.airbrake_indicator = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("gears"):
+                    if (key == "gears") {
+                        out.gears = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("gears1"):
+                    if (key == "gears1") {
+                        out.gears1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("gears_lamp"):
+                    if (key == "gears_lamp") {
+                        out.gears_lamp = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("flaps"):
+                    if (key == "flaps") {
+                        out.flaps = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("flaps1"):
+                    if (key == "flaps1") {
+                        out.flaps1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("throttle"):
+                    if (key == "throttle") {
+                        out.throttle = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("throttle1"):
+                    if (key == "throttle1") {
+                        out.throttle1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("weapon2"):
+                    if (key == "weapon2") {
+                        out.weapon2 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("weapon3"):
+                    if (key == "weapon3") {
+                        out.weapon3 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("mach"):
+                    if (key == "mach") {
+                        out.mach = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("g_meter"):
+                    if (key == "g_meter") {
+                        out.g_meter = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("g_meter_min"):
+                    if (key == "g_meter_min") {
+                        out.g_meter_min = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("g_meter_max"):
+                    if (key == "g_meter_max") {
+                        out.g_meter_max = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("blister1"):
+                    if (key == "blister1") {
+                        out.blister1 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("blister2"):
+                    if (key == "blister2") {
+                        out.blister2 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("blister3"):
+                    if (key == "blister3") {
+                        out.blister3 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("blister4"):
+                    if (key == "blister4") {
+                        out.blister4 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("blister5"):
+                    if (key == "blister5") {
+                        out.blister5 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("blister6"):
+                    if (key == "blister6") {
+                        out.blister6 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("blister7"):
+                    if (key == "blister7") {
+                        out.blister7 = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("wing_sweep_lever"):
+                    if (key == "wing_sweep_lever") {
+                        out.wing_sweep_lever = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            reader.Skip();
+        }
+        return !reader.HasError();
+    }
+
+    bool Read(Json::Reader& reader, MapObject& out) {
+        out.Clear();
+        if (reader.Peek() != Json::ValueType::Object) {
+            reader.Skip();
+            return false;
+        }
+        reader.EnterObject();
+        while (reader.NextMember()) {
+            std::string_view key = reader.GetKey();
+            switch (reader.GetKeyHash()) {
+                case Json::Key::Hash("type"):
+                    if (key == "type") {
+                        out.type = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("color"):
+                    if (key == "color") {
+                        out.color = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("color[]"):
+                    if (key == "color[]") {
+                        ReadArray(reader, out.color_array, out.color_array_count);
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("blink"):
+                    if (key == "blink") {
+                        out.blink = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("icon"):
+                    if (key == "icon") {
+                        out.icon = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("icon_bg"):
+                    if (key == "icon_bg") {
+                        out.icon_bg = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("x"):
+                    if (key == "x") {
+                        out.x = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("y"):
+                    if (key == "y") {
+                        out.y = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("sx"):
+                    if (key == "sx") {
+                        out.sx = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("sy"):
+                    if (key == "sy") {
+                        out.sy = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("ex"):
+                    if (key == "ex") {
+                        out.ex = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("ey"):
+                    if (key == "ey") {
+                        out.ey = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("dx"):
+                    if (key == "dx") {
+                        out.dx = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("dy"):
+                    if (key == "dy") {
+                        out.dy = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            reader.Skip();
+        }
+        return !reader.HasError();
+    }
+
+    bool Read(Json::Reader& reader, MapInfo& out) {
+        out.Clear();
+        if (reader.Peek() != Json::ValueType::Object) {
+            reader.Skip();
+            return false;
+        }
+        reader.EnterObject();
+        while (reader.NextMember()) {
+            std::string_view key = reader.GetKey();
+            switch (reader.GetKeyHash()) {
+                case Json::Key::Hash("grid_steps"):
+                    if (key == "grid_steps") {
+                        ReadArray(reader, out.grid_steps, out.grid_steps_count);
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("grid_zero"):
+                    if (key == "grid_zero") {
+                        ReadArray(reader, out.grid_zero, out.grid_zero_count);
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("map_generation"):
+                    if (key == "map_generation") {
+                        out.map_generation = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("map_max"):
+                    if (key == "map_max") {
+                        ReadArray(reader, out.map_max, out.map_max_count);
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("map_min"):
+                    if (key == "map_min") {
+                        ReadArray(reader, out.map_min, out.map_min_count);
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("valid"):
+                    if (key == "valid") {
+                        out.valid = reader.ReadBool();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("hud_type"):
+                    if (key == "hud_type") {
+                        out.hud_type = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            reader.Skip();
+        }
+        return !reader.HasError();
+    }
+
+    bool Read(Json::Reader& reader, MissionObjective& out) {
+        out.Clear();
+        if (reader.Peek() != Json::ValueType::Object) {
+            reader.Skip();
+            return false;
+        }
+        reader.EnterObject();
+        while (reader.NextMember()) {
+            std::string_view key = reader.GetKey();
+            switch (reader.GetKeyHash()) {
+                case Json::Key::Hash("primary"):
+                    if (key == "primary") {
+                        out.primary = reader.ReadBool();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("status"):
+                    if (key == "status") {
+                        out.status = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("text"):
+                    if (key == "text") {
+                        out.text = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            reader.Skip();
+        }
+        return !reader.HasError();
+    }
+
+    bool Read(Json::Reader& reader, Mission& out) {
+        out.Clear();
+        if (reader.Peek() != Json::ValueType::Object) {
+            reader.Skip();
+            return false;
+        }
+        reader.EnterObject();
+        while (reader.NextMember()) {
+            std::string_view key = reader.GetKey();
+            switch (reader.GetKeyHash()) {
+                case Json::Key::Hash("objectives"):
+                    if (key == "objectives") {
+                        ReadObjects(reader, out.objectives);
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("status"):
+                    if (key == "status") {
+                        out.status = reader.ReadStringView();
+                        continue;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            reader.Skip();
+        }
+        return !reader.HasError();
+    }
+
+    namespace {
+        // Поле с номером двигателя: хеш ключа с номером, заменённым на _N_, сравнивается с описанными
+        bool ReadNumbered(Json::Reader& reader, std::string_view key, State& out) {
+            std::string_view prefix;
+            std::string_view suffix;
+            size_t number = 0;
+            if (!SplitNumbered(key, prefix, number, suffix) || number == 0 || number > MAX_ENGINES) return false;
+            size_t index = number - 1;
+            switch (TemplateHash(prefix, suffix)) {
+                case Json::Key::Hash("throttle _N_, %"):
+                    if (prefix == "throttle " && suffix == ", %") {
+                        out.throttle_pct[index] = reader.ReadInt();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("radiator _N_, %"):
+                    if (prefix == "radiator " && suffix == ", %") {
+                        out.radiator_pct[index] = reader.ReadInt();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("magneto _N_"):
+                    if (prefix == "magneto " && suffix == "") {
+                        out.magneto[index] = reader.ReadInt();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("power _N_, hp"):
+                    if (prefix == "power " && suffix == ", hp") {
+                        out.power_hp[index] = reader.ReadFloat();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("RPM _N_"):
+                    if (prefix == "RPM " && suffix == "") {
+                        out.rpm[index] = reader.ReadInt();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("manifold pressure _N_, atm"):
+                    if (prefix == "manifold pressure " && suffix == ", atm") {
+                        out.manifold_pressure_atm[index] = reader.ReadFloat();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("water temp _N_, C"):
+                    if (prefix == "water temp " && suffix == ", C") {
+                        out.water_temp_c[index] = reader.ReadInt();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("oil temp _N_, C"):
+                    if (prefix == "oil temp " && suffix == ", C") {
+                        out.oil_temp_c[index] = reader.ReadInt();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("pitch _N_, deg"):
+                    if (prefix == "pitch " && suffix == ", deg") {
+                        out.pitch_deg[index] = reader.ReadFloat();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("thrust _N_, kgs"):
+                    if (prefix == "thrust " && suffix == ", kgs") {
+                        out.thrust_kgs[index] = reader.ReadInt();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("efficiency _N_, %"):
+                    if (prefix == "efficiency " && suffix == ", %") {
+                        out.efficiency_pct[index] = reader.ReadInt();
+                        break;
+                    }
+                    return false;
+                case Json::Key::Hash("mixture _N_, %"):
+                    if (prefix == "mixture " && suffix == ", %") {
+                        out.mixture_pct[index] = reader.ReadInt();
+                        break;
+                    }
+                    return false;
+                default:
+                    return false;
+            }
+            out.engines = std::max(out.engines, number);
+            return true;
+        }
+    }
+
+    bool Read(Json::Reader& reader, State& out) {
+        out.Clear();
+        if (reader.Peek() != Json::ValueType::Object) {
+            reader.Skip();
+            return false;
+        }
+        reader.EnterObject();
+        while (reader.NextMember()) {
+            std::string_view key = reader.GetKey();
+            switch (reader.GetKeyHash()) {
+                case Json::Key::Hash("valid"):
+                    if (key == "valid") {
+                        out.valid = reader.ReadBool();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("aileron, %"):
+                    if (key == "aileron, %") {
+                        out.aileron_pct = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("elevator, %"):
+                    if (key == "elevator, %") {
+                        out.elevator_pct = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("rudder, %"):
+                    if (key == "rudder, %") {
+                        out.rudder_pct = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("H, m"):
+                    if (key == "H, m") {
+                        out.h_m = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("TAS, km/h"):
+                    if (key == "TAS, km/h") {
+                        out.tas_km_h = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("IAS, km/h"):
+                    if (key == "IAS, km/h") {
+                        out.ias_km_h = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("M"):
+                    if (key == "M") {
+                        out.m = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("AoA, deg"):
+                    if (key == "AoA, deg") {
+                        out.aoa_deg = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("AoS, deg"):
+                    if (key == "AoS, deg") {
+                        out.aos_deg = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("Ny"):
+                    if (key == "Ny") {
+                        out.ny = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("Vy, m/s"):
+                    if (key == "Vy, m/s") {
+                        out.vy_m_s = reader.ReadFloat();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("Wx, deg/s"):
+                    if (key == "Wx, deg/s") {
+                        out.wx_deg_s = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("Mfuel, kg"):
+                    if (key == "Mfuel, kg") {
+                        out.mfuel_kg = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("Mfuel0, kg"):
+                    if (key == "Mfuel0, kg") {
+                        out.mfuel0_kg = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                case Json::Key::Hash("flaps, %"):
+                    if (key == "flaps, %") {
+                        out.flaps_pct = reader.ReadInt();
+                        continue;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            if (ReadNumbered(reader, key, out)) continue;
+            reader.Skip();
+        }
+        return !reader.HasError();
+    }
+
+    bool ReadList(Json::Reader& reader, std::vector<GameChatMessage>& out) {
+        ReadObjects(reader, out);
+        return !reader.HasError();
+    }
+
+    bool ReadList(Json::Reader& reader, std::vector<MapObject>& out) {
+        ReadObjects(reader, out);
+        return !reader.HasError();
+    }
+
+    void Lookup(Json::View view, GameChatMessage& out) {
+        out.Clear();
+        out.id = view["id"].asInt();
+        out.msg = view["msg"].asStringView();
+        out.sender = view["sender"].asStringView();
+        out.enemy = view["enemy"].asBool();
+        out.mode = view["mode"].asStringView();
+    }
+
+    void Lookup(Json::View view, HudMessage& out) {
+        out.Clear();
+        out.id = view["id"].asInt();
+        out.msg = view["msg"].asStringView();
+        out.sender = view["sender"].asStringView();
+        out.enemy = view["enemy"].asBool();
+        out.mode = view["mode"].asStringView();
+    }
+
+    void Lookup(Json::View view, Hudmsg& out) {
+        out.Clear();
+        LookupObjects(view["events"], out.events);
+        LookupObjects(view["damage"], out.damage);
+    }
+
+    void Lookup(Json::View view, Indicators& out) {
+        out.Clear();
+        out.valid = view["valid"].asBool();
+        out.type = view["type"].asStringView();
+        out.speed = view["speed"].asFloat();
+        out.pedals = view["pedals"].asFloat();
+        out.pedals1 = view["pedals1"].asFloat();
+        out.pedals2 = view["pedals2"].asFloat();
+        out.pedals3 = view["pedals3"].asFloat();
+        out.stick_elevator = view["stick_elevator"].asFloat();
+        out.stick_elevator1 = view["stick_elevator1"].asFloat();
+        out.stick_ailerons = view["stick_ailerons"].asFloat();
+        out.vario = view["vario"].asFloat();
+        out.altitude_hour = view["altitude_hour"].asFloat();
+        out.altitude_min = view["altitude_min"].asFloat();
+        out.altitude_10k = view["altitude_10k"].asFloat();
+        out.aviahorizon_roll = view["aviahorizon_roll"].asFloat();
+        out.aviahorizon_pitch = view["aviahorizon_pitch"].asFloat();
+        out.bank = view["bank"].asFloat();
+        out.turn = view["turn"].asFloat();
+        out.compass = view["compass"].asFloat();
+        out.compass1 = view["compass1"].asFloat();
+        out.compass2 = view["compass2"].asFloat();
+        out.clock_hour = view["clock_hour"].asFloat();
+        out.clock_min = view["clock_min"].asFloat();
+        out.clock_sec = view["clock_sec"].asFloat();
+        out.rpm_min = view["rpm_min"].asFloat();
+        out.rpm1_min = view["rpm1_min"].asFloat();
+        out.rpm_hour = view["rpm_hour"].asFloat();
+        out.rpm1_hour = view["rpm1_hour"].asFloat();
+        out.oil_pressure = view["oil_pressure"].asFloat();
+        out.oil_pressure1 = view["oil_pressure1"].asFloat();
+        out.head_temperature = view["head_temperature"].asFloat();
+        out.head_temperature1 = view["head_temperature1"].asFloat();
+        out.fuel = view["fuel"].asFloat();
+        out.fuel1 = view["fuel1"].asFloat();
+        out.fuel_pressure = view["fuel_pressure"].asFloat();
+        out.fuel_pressure1 = view["fuel_pressure1"].asFloat();
+        out.airbrake_lever = view["airbrake_lever"].asFloat();
+        out.airbrake_indicator = view["airbrake_indicator"].asFloat();
+        out.gears = view["gears"].asFloat();
+        out.gears1 = view["gears1"].asFloat();
+        out.gears_lamp = view["gears_lamp"].asFloat();
+        out.flaps = view["flaps"].asFloat();
+        out.flaps1 = view["flaps1"].asFloat();
+        out.throttle = view["throttle"].asFloat();
+        out.throttle1 = view["throttle1"].asFloat();
+        out.weapon2 = view["weapon2"].asFloat();
+        out.weapon3 = view["weapon3"].asFloat();
+        out.mach = view["mach"].asFloat();
+        out.g_meter = view["g_meter"].asFloat();
+        out.g_meter_min = view["g_meter_min"].asFloat();
+        out.g_meter_max = view["g_meter_max"].asFloat();
+        out.blister1 = view["blister1"].asFloat();
+        out.blister2 = view["blister2"].asFloat();
+        out.blister3 = view["blister3"].asFloat();
+        out.blister4 = view["blister4"].asFloat();
+        out.blister5 = view["blister5"].asFloat();
+        out.blister6 = view["blister6"].asFloat();
+        out.blister7 = view["blister7"].asFloat();
+        out.wing_sweep_lever = view["wing_sweep_lever"].asFloat();
+    }
+
+    void Lookup(Json::View view, MapObject& out) {
+        out.Clear();
+        out.type = view["type"].asStringView();
+        out.color = view["color"].asStringView();
+        {
+            Json::View items = view["color[]"];
+            out.color_array_count = items.size();
+            for (size_t i = 0; i < items.size() && i < 3; i++) out.color_array[i] = items[i].asInt();
+        }
+        out.blink = view["blink"].asInt();
+        out.icon = view["icon"].asStringView();
+        out.icon_bg = view["icon_bg"].asStringView();
+        out.x = view["x"].asFloat();
+        out.y = view["y"].asFloat();
+        out.sx = view["sx"].asFloat();
+        out.sy = view["sy"].asFloat();
+        out.ex = view["ex"].asFloat();
+        out.ey = view["ey"].asFloat();
+        out.dx = view["dx"].asFloat();
+        out.dy = view["dy"].asFloat();
+    }
+
+    void Lookup(Json::View view, MapInfo& out) {
+        out.Clear();
+        {
+            Json::View items = view["grid_steps"];
+            out.grid_steps_count = items.size();
+            for (size_t i = 0; i < items.size() && i < 2; i++) out.grid_steps[i] = items[i].asFloat();
+        }
+        {
+            Json::View items = view["grid_zero"];
+            out.grid_zero_count = items.size();
+            for (size_t i = 0; i < items.size() && i < 2; i++) out.grid_zero[i] = items[i].asFloat();
+        }
+        out.map_generation = view["map_generation"].asInt();
+        {
+            Json::View items = view["map_max"];
+            out.map_max_count = items.size();
+            for (size_t i = 0; i < items.size() && i < 2; i++) out.map_max[i] = items[i].asFloat();
+        }
+        {
+            Json::View items = view["map_min"];
+            out.map_min_count = items.size();
+            for (size_t i = 0; i < items.size() && i < 2; i++) out.map_min[i] = items[i].asFloat();
+        }
+        out.valid = view["valid"].asBool();
+        out.hud_type = view["hud_type"].asInt();
+    }
+
+    void Lookup(Json::View view, MissionObjective& out) {
+        out.Clear();
+        out.primary = view["primary"].asBool();
+        out.status = view["status"].asStringView();
+        out.text = view["text"].asStringView();
+    }
+
+    void Lookup(Json::View view, Mission& out) {
+        out.Clear();
+        LookupObjects(view["objectives"], out.objectives);
+        out.status = view["status"].asStringView();
+    }
+
+    void Lookup(Json::View view, State& out) {
+        out.Clear();
+        out.valid = view["valid"].asBool();
+        out.aileron_pct = view["aileron, %"].asInt();
+        out.elevator_pct = view["elevator, %"].asInt();
+        out.rudder_pct = view["rudder, %"].asInt();
+        out.h_m = view["H, m"].asInt();
+        out.tas_km_h = view["TAS, km/h"].asInt();
+        out.ias_km_h = view["IAS, km/h"].asInt();
+        out.m = view["M"].asFloat();
+        out.aoa_deg = view["AoA, deg"].asFloat();
+        out.aos_deg = view["AoS, deg"].asFloat();
+        out.ny = view["Ny"].asFloat();
+        out.vy_m_s = view["Vy, m/s"].asFloat();
+        out.wx_deg_s = view["Wx, deg/s"].asInt();
+        out.mfuel_kg = view["Mfuel, kg"].asInt();
+        out.mfuel0_kg = view["Mfuel0, kg"].asInt();
+        out.flaps_pct = view["flaps, %"].asInt();
+        char key[64];
+        for (size_t number = 1; number <= MAX_ENGINES; number++) {
+            Json::View throttle_pct = view[NumberedKey(key, sizeof(key), "throttle ", number, ", %")];
+            if (!throttle_pct.isNull()) {
+                out.throttle_pct[number - 1] = throttle_pct.asInt();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View radiator_pct = view[NumberedKey(key, sizeof(key), "radiator ", number, ", %")];
+            if (!radiator_pct.isNull()) {
+                out.radiator_pct[number - 1] = radiator_pct.asInt();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View magneto = view[NumberedKey(key, sizeof(key), "magneto ", number, "")];
+            if (!magneto.isNull()) {
+                out.magneto[number - 1] = magneto.asInt();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View power_hp = view[NumberedKey(key, sizeof(key), "power ", number, ", hp")];
+            if (!power_hp.isNull()) {
+                out.power_hp[number - 1] = power_hp.asFloat();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View rpm = view[NumberedKey(key, sizeof(key), "RPM ", number, "")];
+            if (!rpm.isNull()) {
+                out.rpm[number - 1] = rpm.asInt();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View manifold_pressure_atm = view[NumberedKey(key, sizeof(key), "manifold pressure ", number, ", atm")];
+            if (!manifold_pressure_atm.isNull()) {
+                out.manifold_pressure_atm[number - 1] = manifold_pressure_atm.asFloat();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View water_temp_c = view[NumberedKey(key, sizeof(key), "water temp ", number, ", C")];
+            if (!water_temp_c.isNull()) {
+                out.water_temp_c[number - 1] = water_temp_c.asInt();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View oil_temp_c = view[NumberedKey(key, sizeof(key), "oil temp ", number, ", C")];
+            if (!oil_temp_c.isNull()) {
+                out.oil_temp_c[number - 1] = oil_temp_c.asInt();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View pitch_deg = view[NumberedKey(key, sizeof(key), "pitch ", number, ", deg")];
+            if (!pitch_deg.isNull()) {
+                out.pitch_deg[number - 1] = pitch_deg.asFloat();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View thrust_kgs = view[NumberedKey(key, sizeof(key), "thrust ", number, ", kgs")];
+            if (!thrust_kgs.isNull()) {
+                out.thrust_kgs[number - 1] = thrust_kgs.asInt();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View efficiency_pct = view[NumberedKey(key, sizeof(key), "efficiency ", number, ", %")];
+            if (!efficiency_pct.isNull()) {
+                out.efficiency_pct[number - 1] = efficiency_pct.asInt();
+                out.engines = std::max(out.engines, number);
+            }
+            Json::View mixture_pct = view[NumberedKey(key, sizeof(key), "mixture ", number, ", %")];
+            if (!mixture_pct.isNull()) {
+                out.mixture_pct[number - 1] = mixture_pct.asInt();
+                out.engines = std::max(out.engines, number);
+            }
+        }
+    }
+
+    void LookupList(Json::View view, std::vector<GameChatMessage>& out) {
+        LookupObjects(view, out);
+    }
+
+    void LookupList(Json::View view, std::vector<MapObject>& out) {
+        LookupObjects(view, out);
+    }
+}
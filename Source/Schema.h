@@ -0,0 +1,258 @@
+#pragma once
+
+// Сгенерировано tools/generate_schema.py из vendor/WarThunder-localhost-documentation-master/*/*.md - не править вручную
+
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include "JsonReader.h"
+
+// Типизированные ответы localhost:8111: все поля из документации эндпоинтов
+// Read - один проход курсора Json::Reader, ключ выбирается switch по хешу Json::Key; без дерева и без выделений:
+// строки - string_view в буфер ответа или арену Reader (действительны до следующего Reset),
+// векторы очищаются с сохранением ёмкости. Отсутствующие поля - значения по умолчанию
+namespace Schema {
+    constexpr size_t MAX_ENGINES = 8; // Поля с номером двигателя ("RPM 1"): номера 1..MAX_ENGINES
+
+    // /gamechat, элемент корневого массива: Retrieves data from game chat
+    struct GameChatMessage {
+        static constexpr size_t FIELDS = 5;
+
+        int id = 0; // message id
+        std::string_view msg; // message content
+        std::string_view sender; // player name
+        bool enemy = false; // true if is a enemy player false otherwise
+        std::string_view mode;
+
+        void Clear(); // Значения по умолчанию (ёмкость векторов сохраняется)
+    };
+
+    // Элемент Hudmsg.damage
+    struct HudMessage {
+        static constexpr size_t FIELDS = 5;
+
+        int id = 0;
+        std::string_view msg;
+        std::string_view sender;
+        bool enemy = false;
+        std::string_view mode;
+
+        void Clear(); // Значения по умолчанию (ёмкость векторов сохраняется)
+    };
+
+    // /hudmsg: very similar to gamechat.. instead of a list of dicts, its a dict with keys events and damage, events is always empty iirc, and damage is a list of dicts
+    struct Hudmsg {
+        static constexpr size_t FIELDS = 2;
+
+        std::vector<HudMessage> events;
+        std::vector<HudMessage> damage;
+
+        void Clear(); // Значения по умолчанию (ёмкость векторов сохраняется)
+    };
+
+    // /indicators: This URL retrieves data from aircraft instruments
+    struct Indicators {
+        static constexpr size_t FIELDS = 59;
+
+        bool valid = false;
+        std::string_view type; // contains aircraft name
+        float speed = 0.0f;
+        float pedals = 0.0f;
+        float pedals1 = 0.0f;
+        float pedals2 = 0.0f;
+        float pedals3 = 0.0f;
+        float stick_elevator = 0.0f;
+        float stick_elevator1 = 0.0f;
+        float stick_ailerons = 0.0f;
+        float vario = 0.0f;
+        float altitude_hour = 0.0f;
+        float altitude_min = 0.0f;
+        float altitude_10k = 0.0f;
+        float aviahorizon_roll = 0.0f;
+        float aviahorizon_pitch = 0.0f;
+        float bank = 0.0f;
+        float turn = 0.0f;
+        float compass = 0.0f;
+        float compass1 = 0.0f;
+        float compass2 = 0.0f;
+        float clock_hour = 0.0f;
+        float clock_min = 0.0f;
+        float clock_sec = 0.0f;
+        float rpm_min = 0.0f;
+        float rpm1_min = 0.0f;
+        float rpm_hour = 0.0f;
+        float rpm1_hour = 0.0f;
+        float oil_pressure = 0.0f;
+        float oil_pressure1 = 0.0f;
+        float head_temperature = 0.0f;
+        float head_temperature1 = 0.0f;
+        float fuel = 0.0f;
+        float fuel1 = 0.0f;
+        float fuel_pressure = 0.0f;
+        float fuel_pressure1 = 0.0f;
+        float airbrake_lever = 0.0f;
+        float airbrake_indicator = 0.0f;
+        float gears = 0.0f;
+        float gears1 = 0.0f;
+        float gears_lamp = 0.0f;
+        float flaps = 0.0f;
+        float flaps1 = 0.0f;
+        float throttle = 0.0f;
+        float throttle1 = 0.0f;
+        float weapon2 = 0.0f;
+        float weapon3 = 0.0f;
+        float mach = 0.0f;
+        float g_meter = 0.0f;
+        float g_meter_min = 0.0f;
+        float g_meter_max = 0.0f;
+        float blister1 = 0.0f;
+        float blister2 = 0.0f;
+        float blister3 = 0.0f;
+        float blister4 = 0.0f;
+        float blister5 = 0.0f;
+        float blister6 = 0.0f;
+        float blister7 = 0.0f;
+        float wing_sweep_lever = 0.0f; // wing speed angle
+
+        void Clear(); // Значения по умолчанию (ёмкость векторов сохраняется)
+    };
+
+    // /map_obj.json, элемент корневого массива: This URL retrieves data from all map objects
+    struct MapObject {
+        static constexpr size_t FIELDS = 14;
+
+        std::string_view type; // the type of map object can be one of the following values -> _ground_model_, _aircraft_
+        std::string_view color; // the hex color code associated to the object
+        int color_array[3] = {}; // "color[]": the RGB code for each color associated to the object
+        size_t color_array_count = 0; // Элементов в ответе (сохраняется не больше 3)
+        int blink = 0;
+        std::string_view icon; // the name of the icon associated to object. If this value is Player then the current object is the current player.
+        std::string_view icon_bg; // the name of background icon associated to the object
+        float x = 0.0f; // the _x_ position of player in map
+        float y = 0.0f; // the _y_ position of player in map
+        float sx = 0.0f;
+        float sy = 0.0f;
+        float ex = 0.0f;
+        float ey = 0.0f;
+        float dx = 0.0f; // x-component of direction vector of aircraft: {dx} = cos(vec V)
+        float dy = 0.0f; // y-component of direction vector of aircraft: {dy} = sin(vec V)
+
+        void Clear(); // Значения по умолчанию (ёмкость векторов сохраняется)
+    };
+
+    // /map_info.json: Contains information about current map
+    struct MapInfo {
+        static constexpr size_t FIELDS = 7;
+
+        float grid_steps[2] = {};
+        size_t grid_steps_count = 0; // Элементов в ответе (сохраняется не больше 2)
+        float grid_zero[2] = {};
+        size_t grid_zero_count = 0; // Элементов в ответе (сохраняется не больше 2)
+        int map_generation = 0;
+        float map_max[2] = {};
+        size_t map_max_count = 0; // Элементов в ответе (сохраняется не больше 2)
+        float map_min[2] = {};
+        size_t map_min_count = 0; // Элементов в ответе (сохраняется не больше 2)
+        bool valid = false; // map is loaded
+        int hud_type = 0; // HUD type (aircraft/tanks)
+
+        void Clear(); // Значения по умолчанию (ёмкость векторов сохраняется)
+    };
+
+    // Элемент Mission.objectives
+    struct MissionObjective {
+        static constexpr size_t FIELDS = 3;
+
+        bool primary = false; // flag to determine if this is a primary mission
+        std::string_view status; // contains the status of current primary objective
+        std::string_view text; // contains instruction of what the player needs to do for complete the mission
+
+        void Clear(); // Значения по умолчанию (ёмкость векторов сохраняется)
+    };
+
+    // /mission.json: This URL retrieves data from the current mission
+    struct Mission {
+        static constexpr size_t FIELDS = 2;
+
+        std::vector<MissionObjective> objectives;
+        std::string_view status; // contains status of the current mission can be "running" or "fail"
+
+        void Clear(); // Значения по умолчанию (ёмкость векторов сохраняется)
+    };
+
+    // /state: This URL retrieves data of current aircraft state
+    struct State {
+        static constexpr size_t FIELDS = 28;
+
+        bool valid = false;
+        int aileron_pct = 0; // "aileron, %"
+        int elevator_pct = 0; // "elevator, %"
+        int rudder_pct = 0; // "rudder, %"
+        int h_m = 0; // "H, m": current aircraft altitude in meters
+        int tas_km_h = 0; // "TAS, km/h": the true airspeed in kilometers per hour
+        int ias_km_h = 0; // "IAS, km/h": the indicated airspeed in kilometers per hour
+        float m = 0.0f; // "M"
+        float aoa_deg = 0.0f; // "AoA, deg": aircraft angle of attack in degrees
+        float aos_deg = 0.0f; // "AoS, deg"
+        float ny = 0.0f; // "Ny"
+        float vy_m_s = 0.0f; // "Vy, m/s": aircraft vertical speed in meters per second
+        int wx_deg_s = 0; // "Wx, deg/s": aircraft rotation on *x* axis in degrees per second
+        int mfuel_kg = 0; // "Mfuel, kg"
+        int mfuel0_kg = 0; // "Mfuel0, kg"
+        int throttle_pct[MAX_ENGINES] = {}; // "throttle _N_, %"
+        int radiator_pct[MAX_ENGINES] = {}; // "radiator _N_, %"
+        int magneto[MAX_ENGINES] = {}; // "magneto _N_"
+        float power_hp[MAX_ENGINES] = {}; // "power _N_, hp": power of engine nº 1 in horse-power
+        int rpm[MAX_ENGINES] = {}; // "RPM _N_"
+        float manifold_pressure_atm[MAX_ENGINES] = {}; // "manifold pressure _N_, atm"
+        int water_temp_c[MAX_ENGINES] = {}; // "water temp _N_, C": water temperature of engine nº 1 in celsius
+        int oil_temp_c[MAX_ENGINES] = {}; // "oil temp _N_, C"
+        float pitch_deg[MAX_ENGINES] = {}; // "pitch _N_, deg"
+        int thrust_kgs[MAX_ENGINES] = {}; // "thrust _N_, kgs"
+        int efficiency_pct[MAX_ENGINES] = {}; // "efficiency _N_, %"
+        int flaps_pct = 0; // "flaps, %"
+        int mixture_pct[MAX_ENGINES] = {}; // "mixture _N_, %"
+        size_t engines = 0; // Наибольший номер двигателя в ответе
+
+        void Clear(); // Значения по умолчанию (ёмкость векторов сохраняется)
+    };
+
+    // Эндпоинты:
+    //   /gamechat - std::vector<GameChatMessage>
+    //   /hudmsg - Hudmsg
+    //   /indicators - Indicators
+    //   /map_obj.json - std::vector<MapObject>
+    //   /map_info.json - MapInfo
+    //   /mission.json - Mission
+    //   /state - State
+
+    // Следующее значение курсора; false - не объект (пропущен) или ошибка чтения
+    bool Read(Json::Reader& reader, GameChatMessage& out);
+    bool Read(Json::Reader& reader, HudMessage& out);
+    bool Read(Json::Reader& reader, Hudmsg& out);
+    bool Read(Json::Reader& reader, Indicators& out);
+    bool Read(Json::Reader& reader, MapObject& out);
+    bool Read(Json::Reader& reader, MapInfo& out);
+    bool Read(Json::Reader& reader, MissionObjective& out);
+    bool Read(Json::Reader& reader, Mission& out);
+    bool Read(Json::Reader& reader, State& out);
+
+    // Массив объектов (корень /gamechat и /map_obj.json); элементы-не объекты пропускаются
+    bool ReadList(Json::Reader& reader, std::vector<GameChatMessage>& out);
+    bool ReadList(Json::Reader& reader, std::vector<MapObject>& out);
+
+    // Те же поля поиском по ключам в готовом документе (сравнение в Bench SchemaDecode)
+    void Lookup(Json::View view, GameChatMessage& out);
+    void Lookup(Json::View view, HudMessage& out);
+    void Lookup(Json::View view, Hudmsg& out);
+    void Lookup(Json::View view, Indicators& out);
+    void Lookup(Json::View view, MapObject& out);
+    void Lookup(Json::View view, MapInfo& out);
+    void Lookup(Json::View view, MissionObjective& out);
+    void Lookup(Json::View view, Mission& out);
+    void Lookup(Json::View view, State& out);
+    void LookupList(Json::View view, std::vector<GameChatMessage>& out);
+    void LookupList(Json::View view, std::vector<MapObject>& out);
+}
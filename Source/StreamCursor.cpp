@@ -0,0 +1,54 @@
+#include "StreamCursor.h"
+
+int StreamCursor::GetRequestId() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_verifying ? 0 : m_lastId;
+}
+
+void StreamCursor::RequestVerify() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_lastId == 0 || m_verifying) return; // Лента и так читается с начала
+    m_verifying = true;
+    m_verifications++;
+}
+
+int StreamCursor::Resolve(size_t count, int minId, int maxId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Пустой ответ ничего не говорит о нумерации - режим проверки сохраняется
+    if (count == 0) return m_lastId;
+
+    int threshold = m_lastId;
+    if (maxId < m_lastId || (m_firstId >= 0 && minId < m_firstId)) {
+        // Старших id больше нет или появились id старше всех виденных - игра перезапущена, вся лента новая
+        m_resets++;
+        threshold = 0;
+        m_firstId = minId;
+    } else if (!m_verifying && m_lastId > 0 && minId > m_lastId + 1) {
+        // Сервер отдал не все элементы после курсора
+        m_gaps++;
+    }
+
+    // Непустой ответ (проверочный или запрошенный по курсору) подтверждает текущую нумерацию
+    if (m_firstId < 0) m_firstId = minId;
+    m_verifying = false;
+    m_lastId = maxId;
+    return threshold;
+}
+
+void StreamCursor::Reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lastId = 0;
+    m_firstId = -1;
+    m_verifying = false;
+}
+
+StreamCursor::Stats StreamCursor::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats;
+    stats.lastId = m_lastId;
+    stats.gaps = m_gaps;
+    stats.resets = m_resets;
+    stats.verifications = m_verifications;
+    return stats;
+}
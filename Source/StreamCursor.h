@@ -0,0 +1,44 @@
+#pragma once
+
+#include <mutex>
+#include <cstdint>
+
+// Курсор инкрементальной ленты с id (gamechat, hudmsg events/damage)
+// Поток реактора берёт id для запроса, декодер разрешает по нему ответ: новые элементы - только с id больше порога
+// Id ленты растут в пределах запуска игры и начинаются заново после её перезапуска
+class StreamCursor {
+public:
+    // Счётчики курсора (для дебаг режима)
+    struct Stats {
+        int lastId = 0;
+        uint64_t gaps = 0;          // Пропуски id между ответами (элементы потеряны)
+        uint64_t resets = 0;        // Нумерация началась заново
+        uint64_t verifications = 0; // Перечитываний ленты с начала
+    };
+
+    // Id для параметра запроса (lastId / lastDmg / lastEvt)
+    int GetRequestId() const;
+
+    // Следующие запросы читают ленту с начала, пока не придёт непустой ответ
+    // (после переподключения или смены карты - иначе сброс нумерации не заметить)
+    void RequestVerify();
+
+    // Разобрать ответ с id в диапазоне [minId, maxId] (count - количество элементов)
+    // Возвращает порог: в поток публикуются только элементы с id > порога
+    // Сброс нумерации - maxId меньше курсора или minId ниже самого старого id текущей нумерации
+    // (сервер только отбрасывает старые элементы, поэтому проверочный ответ новой нумерации виден по minId,
+    // даже если её id уже обогнали курсор)
+    int Resolve(size_t count, int minId, int maxId);
+
+    void Reset();
+    Stats GetStats() const;
+
+private:
+    mutable std::mutex m_mutex;
+    int m_lastId = 0;
+    int m_firstId = -1; // Самый старый id текущей нумерации (-1 - ответов ещё не было)
+    bool m_verifying = false;
+    uint64_t m_gaps = 0;
+    uint64_t m_resets = 0;
+    uint64_t m_verifications = 0;
+};
@@ -0,0 +1,413 @@
+#include "ThreadPlacement.h"
+#include <mutex>
+#include <chrono>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <map>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#include <pthread.h>
+#endif
+
+namespace ThreadPlacement {
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        // Старое размещение: ApiFetcher и JsonParser на CPU 0, интерфейс на CPU 1
+        const uint64_t g_legacyMasks[(size_t)Role::Count] = { 0x1, 0x1, 0x2 };
+
+        struct RegisteredThread {
+            uint64_t id;
+            Role role;
+            #ifdef _WIN32
+            HANDLE handle;
+            #else
+            pthread_t handle;
+            #endif
+        };
+
+        struct State {
+            std::mutex mutex;
+            std::string rules[(size_t)Role::Count] = { "any", "any", "any" };
+            std::vector<RegisteredThread> threads;
+            uint64_t nextId = 1;
+
+            bool benchmark = false;
+            bool legacyPhase = false;
+            int phaseSeconds = 0;
+            Clock::time_point phaseStart;
+            BenchmarkSide legacy;
+            BenchmarkSide configured;
+        };
+
+        State& GetState() {
+            static State state;
+            return state;
+        }
+
+        #ifndef _WIN32
+        // Список процессоров в формате sysfs ("0-3,8,10-11")
+        std::vector<int> ParseCpuList(const std::string& text) {
+            std::vector<int> result;
+            std::stringstream stream(text);
+            std::string item;
+            while (std::getline(stream, item, ',')) {
+                if (item.empty()) continue;
+                size_t dash = item.find('-');
+                int first = std::atoi(item.c_str());
+                int last = dash != std::string::npos ? std::atoi(item.c_str() + dash + 1) : first;
+                for (int cpu = first; cpu <= last; cpu++) result.push_back(cpu);
+            }
+            return result;
+        }
+
+        std::string ReadSysFile(const std::string& path) {
+            std::ifstream file(path);
+            std::string line;
+            std::getline(file, line);
+            return line;
+        }
+        #endif
+
+        Topology Discover() {
+            Topology topology;
+
+            #ifdef _WIN32
+            DWORD_PTR processMask = 0;
+            DWORD_PTR systemMask = 0;
+            if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) {
+                processMask = 1;
+            }
+            topology.allowedMask = (uint64_t)processMask;
+
+            // Ядра группы 0 (EfficiencyClass: у P-ядер больше, на не гибридных процессорах у всех 0)
+            DWORD length = 0;
+            GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &length);
+            std::vector<char> buffer(length);
+            auto* info = (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)buffer.data();
+            if (length > 0 && GetLogicalProcessorInformationEx(RelationProcessorCore, info, &length)) {
+                int maxClass = 0;
+                for (DWORD offset = 0; offset < length;) {
+                    auto* entry = (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(buffer.data() + offset);
+                    maxClass = std::max(maxClass, (int)entry->Processor.EfficiencyClass);
+                    offset += entry->Size;
+                }
+                int core = 0;
+                for (DWORD offset = 0; offset < length;) {
+                    auto* entry = (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(buffer.data() + offset);
+                    offset += entry->Size;
+                    const GROUP_AFFINITY& group = entry->Processor.GroupMask[0];
+                    uint64_t coreMask = group.Group == 0 ? (uint64_t)group.Mask & topology.allowedMask : 0;
+                    if (coreMask == 0) continue;
+                    int siblings = 0;
+                    for (int cpu = 0; cpu < 64; cpu++) {
+                        if (!(coreMask & (1ull << cpu))) continue;
+                        LogicalCpu logical;
+                        logical.id = cpu;
+                        logical.core = core;
+                        logical.efficiency = (int)entry->Processor.EfficiencyClass < maxClass;
+                        topology.cpus.push_back(logical);
+                        siblings++;
+                    }
+                    if (siblings > 1) topology.smt = true;
+                    core++;
+                }
+            }
+            #else
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+                for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; cpu++) {
+                    if (CPU_ISSET(cpu, &set)) topology.allowedMask |= 1ull << cpu;
+                }
+            }
+
+            // Гибридные Intel: E-ядра перечислены в cpu_atom
+            uint64_t atomMask = 0;
+            for (int cpu : ParseCpuList(ReadSysFile("/sys/devices/cpu_atom/cpus"))) {
+                if (cpu >= 0 && cpu < 64) atomMask |= 1ull << cpu;
+            }
+
+            // Физическое ядро - пара (package, core_id), номера ядер по возрастанию первого CPU
+            std::map<std::pair<int, int>, int> coreIndex;
+            std::map<int, int> siblings;
+            for (int cpu = 0; cpu < 64; cpu++) {
+                if (!(topology.allowedMask & (1ull << cpu))) continue;
+                std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+                std::string coreId = ReadSysFile(base + "core_id");
+                std::string packageId = ReadSysFile(base + "physical_package_id");
+                std::pair<int, int> key(std::atoi(packageId.c_str()), coreId.empty() ? cpu : std::atoi(coreId.c_str()));
+                auto it = coreIndex.find(key);
+                if (it == coreIndex.end()) it = coreIndex.emplace(key, (int)coreIndex.size()).first;
+
+                LogicalCpu logical;
+                logical.id = cpu;
+                logical.core = it->second;
+                logical.efficiency = (atomMask & (1ull << cpu)) != 0;
+                topology.cpus.push_back(logical);
+                if (++siblings[logical.core] > 1) topology.smt = true;
+            }
+            #endif
+
+            if (topology.cpus.empty()) {
+                // Топология не определилась - считаем каждый доступный CPU отдельным ядром
+                for (int cpu = 0; cpu < 64; cpu++) {
+                    if (!(topology.allowedMask & (1ull << cpu))) continue;
+                    LogicalCpu logical;
+                    logical.id = cpu;
+                    logical.core = (int)topology.cpus.size();
+                    topology.cpus.push_back(logical);
+                }
+            }
+
+            // Гибридный - есть и P-, и E-ядра
+            int cores = 0;
+            bool hasEfficiency = false;
+            bool hasPerformance = false;
+            for (const LogicalCpu& cpu : topology.cpus) {
+                cores = std::max(cores, cpu.core + 1);
+                (cpu.efficiency ? hasEfficiency : hasPerformance) = true;
+            }
+            topology.physicalCores = cores;
+            topology.hybrid = hasEfficiency && hasPerformance;
+            return topology;
+        }
+
+        // Маска одного условия правила, allMask - если условие не ограничивает; false - ошибка разбора
+        bool ResolveTerm(Role role, const std::string& term, uint64_t& mask) {
+            const Topology& topology = GetTopology();
+            uint64_t allMask = topology.allowedMask;
+            mask = allMask;
+
+            if (term.empty() || term == "any") return true;
+
+            if (term == "legacy") {
+                mask = g_legacyMasks[(size_t)role] & allMask;
+                if (mask == 0) mask = allMask; // Второго CPU нет - как и раньше, без привязки
+                return true;
+            }
+
+            if (term == "performance" || term == "efficiency") {
+                if (!topology.hybrid) return true;
+                bool wantEfficiency = term == "efficiency";
+                mask = 0;
+                for (const LogicalCpu& cpu : topology.cpus) {
+                    if (cpu.efficiency == wantEfficiency) mask |= 1ull << cpu.id;
+                }
+                return true;
+            }
+
+            if (term == "nocore0") {
+                if (topology.physicalCores < 2) return true;
+                mask = 0;
+                for (const LogicalCpu& cpu : topology.cpus) {
+                    if (cpu.core != 0) mask |= 1ull << cpu.id;
+                }
+                return true;
+            }
+
+            if (term.compare(0, 5, "core:") == 0) {
+                int core = std::atoi(term.c_str() + 5);
+                mask = 0;
+                for (const LogicalCpu& cpu : topology.cpus) {
+                    if (cpu.core == core) mask |= 1ull << cpu.id;
+                }
+                if (mask == 0) mask = allMask; // Такого ядра нет на этой машине
+                return true;
+            }
+
+            if (term.compare(0, 5, "mask:") == 0) {
+                char* end = nullptr;
+                uint64_t value = std::strtoull(term.c_str() + 5, &end, 16);
+                if (!end || *end != '\0') return false;
+                mask = value & allMask;
+                if (mask == 0) mask = allMask;
+                return true;
+            }
+
+            return false;
+        }
+
+        bool ResolveRule(Role role, const std::string& rule, uint64_t& mask) {
+            const Topology& topology = GetTopology();
+            mask = topology.allowedMask;
+
+            std::stringstream stream(rule);
+            std::string term;
+            while (std::getline(stream, term, ',')) {
+                term.erase(std::remove_if(term.begin(), term.end(), [](char c) { return c == ' ' || c == '\t'; }), term.end());
+                std::transform(term.begin(), term.end(), term.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+                uint64_t termMask = 0;
+                if (!ResolveTerm(role, term, termMask)) return false;
+                mask &= termMask;
+            }
+
+            // Пустое пересечение (например, performance + core:N на E-ядре) - без привязки
+            if (mask == 0) mask = topology.allowedMask;
+            return true;
+        }
+
+        // Вызывается под мьютексом состояния
+        uint64_t EffectiveMask(State& state, Role role) {
+            uint64_t mask = 0;
+            std::string rule = state.benchmark && state.legacyPhase ? "legacy" : state.rules[(size_t)role];
+            if (!ResolveRule(role, rule, mask)) mask = GetTopology().allowedMask;
+            return mask == GetTopology().allowedMask ? 0 : mask;
+        }
+
+        void ApplyMask(const RegisteredThread& thread, uint64_t mask) {
+            // Маска 0 - снимаем привязку (все доступные процессу CPU)
+            if (mask == 0) mask = GetTopology().allowedMask;
+            if (mask == 0) return;
+
+            #ifdef _WIN32
+            SetThreadAffinityMask(thread.handle, (DWORD_PTR)mask);
+            #else
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (int cpu = 0; cpu < 64; cpu++) {
+                if (mask & (1ull << cpu)) CPU_SET(cpu, &set);
+            }
+            pthread_setaffinity_np(thread.handle, sizeof(set), &set);
+            #endif
+        }
+
+        void ApplyAll(State& state) {
+            for (const RegisteredThread& thread : state.threads) {
+                ApplyMask(thread, EffectiveMask(state, thread.role));
+            }
+        }
+    }
+
+    const Topology& GetTopology() {
+        static const Topology topology = Discover();
+        return topology;
+    }
+
+    bool SetRule(Role role, const std::string& rule) {
+        uint64_t mask = 0;
+        if (!ResolveRule(role, rule, mask)) return false;
+
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.rules[(size_t)role] = rule.empty() ? "any" : rule;
+        ApplyAll(state);
+        return true;
+    }
+
+    std::string GetRule(Role role) {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return state.rules[(size_t)role];
+    }
+
+    uint64_t ResolveMask(Role role) {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return EffectiveMask(state, role);
+    }
+
+    ScopedRole::ScopedRole(Role role) {
+        RegisteredThread thread;
+        thread.role = role;
+        #ifdef _WIN32
+        // Псевдо-дескриптор GetCurrentThread() не годится для вызова из других потоков
+        thread.handle = OpenThread(THREAD_SET_INFORMATION | THREAD_QUERY_INFORMATION, FALSE, GetCurrentThreadId());
+        #else
+        thread.handle = pthread_self();
+        #endif
+
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        thread.id = state.nextId++;
+        m_id = thread.id;
+        #ifdef _WIN32
+        if (!thread.handle) return;
+        #endif
+        ApplyMask(thread, EffectiveMask(state, role));
+        state.threads.push_back(thread);
+    }
+
+    ScopedRole::~ScopedRole() {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        for (size_t i = 0; i < state.threads.size(); i++) {
+            if (state.threads[i].id != m_id) continue;
+            #ifdef _WIN32
+            CloseHandle(state.threads[i].handle);
+            #endif
+            state.threads.erase(state.threads.begin() + i);
+            break;
+        }
+    }
+
+    void StartBenchmark(int phaseSeconds) {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.benchmark = phaseSeconds > 0;
+        state.phaseSeconds = phaseSeconds;
+        state.legacyPhase = true;
+        state.phaseStart = Clock::now();
+        state.legacy = BenchmarkSide();
+        state.configured = BenchmarkSide();
+        ApplyAll(state);
+    }
+
+    void StopBenchmark() {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (!state.benchmark) return;
+        state.benchmark = false;
+        state.legacyPhase = false;
+        ApplyAll(state);
+    }
+
+    void RecordParse(size_t bytes, uint64_t us) {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (!state.benchmark) return;
+        BenchmarkSide& side = state.legacyPhase ? state.legacy : state.configured;
+        side.parses++;
+        side.parseBytes += bytes;
+        side.parseUs += us;
+    }
+
+    void RecordFrame(uint64_t us) {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (!state.benchmark) return;
+        BenchmarkSide& side = state.legacyPhase ? state.legacy : state.configured;
+        side.frames++;
+        side.frameUs += us;
+        side.maxFrameUs = std::max(side.maxFrameUs, us);
+
+        // Фаза закончилась - переключаем размещение всех зарегистрированных потоков
+        auto now = Clock::now();
+        if (now - state.phaseStart >= std::chrono::seconds(state.phaseSeconds)) {
+            state.legacyPhase = !state.legacyPhase;
+            state.phaseStart = now;
+            ApplyAll(state);
+        }
+    }
+
+    Stats GetStats() {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        Stats stats;
+        for (size_t i = 0; i < (size_t)Role::Count; i++) {
+            stats.masks[i] = EffectiveMask(state, (Role)i);
+            stats.rules[i] = state.rules[i];
+        }
+        stats.threads = state.threads.size();
+        stats.benchmark = state.benchmark;
+        stats.legacyPhase = state.legacyPhase;
+        stats.legacy = state.legacy;
+        stats.configured = state.configured;
+        return stats;
+    }
+}
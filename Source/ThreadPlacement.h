@@ -0,0 +1,98 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Размещение потоков по ядрам: топология CPU + правила для ролей потоков
+// По умолчанию потоки не привязываются - ОС сама разносит их по ядрам
+namespace ThreadPlacement {
+    // Роли потоков приложения
+    enum class Role {
+        Io,     // Реактор ApiFetcher (сокеты, таймеры)
+        Parse,  // Разбор ответов (поток callback'ов ApiFetcher, JsonParser)
+        Render, // Главный поток (окно, ImGui, DirectX)
+        Count
+    };
+
+    struct LogicalCpu {
+        int id = 0;              // Номер логического процессора (бит в маске)
+        int core = 0;            // Физическое ядро (у SMT-соседей одинаковое)
+        bool efficiency = false; // E-ядро гибридного процессора
+    };
+
+    // Процессоры, доступные процессу (первые 64)
+    struct Topology {
+        std::vector<LogicalCpu> cpus;
+        int physicalCores = 0;
+        bool smt = false;
+        bool hybrid = false;
+        uint64_t allowedMask = 0;
+    };
+
+    // Определяется один раз при первом обращении
+    const Topology& GetTopology();
+
+    // Правило роли - список условий через запятую (пересечение):
+    //   any          - без привязки (по умолчанию)
+    //   performance  - только P-ядра (на не гибридных процессорах - все)
+    //   efficiency   - только E-ядра (на не гибридных процессорах - все)
+    //   nocore0      - все ядра, кроме физического ядра 0 (прерывания, сама игра)
+    //   core:N       - физическое ядро N вместе с его SMT-соседями
+    //   mask:0xHEX   - явная маска
+    //   legacy       - старое размещение (I/O и разбор на CPU 0, интерфейс на CPU 1)
+    // Возвращает false, если правило не разобрано (роль остаётся без изменений)
+    bool SetRule(Role role, const std::string& rule);
+    std::string GetRule(Role role);
+
+    // Маска роли по текущему правилу (0 - без привязки)
+    uint64_t ResolveMask(Role role);
+
+    // Поток объявляет свою роль на время жизни объекта
+    // Смена правил и фазы бенчмарка применяются к зарегистрированным потокам сразу
+    class ScopedRole {
+    public:
+        explicit ScopedRole(Role role);
+        ~ScopedRole();
+
+        ScopedRole(const ScopedRole&) = delete;
+        ScopedRole& operator=(const ScopedRole&) = delete;
+
+    private:
+        uint64_t m_id;
+    };
+
+    // Бенчмарк: размещение переключается между legacy и настроенным каждые phaseSeconds,
+    // время разбора и кадра копится отдельно для каждого варианта
+    void StartBenchmark(int phaseSeconds);
+    void StopBenchmark();
+    void RecordParse(size_t bytes, uint64_t us);
+    void RecordFrame(uint64_t us); // Вызывается главным потоком каждый кадр (и переключает фазы)
+
+    // Счётчики одного варианта размещения
+    struct BenchmarkSide {
+        uint64_t parses = 0;
+        uint64_t parseBytes = 0;
+        uint64_t parseUs = 0;
+        uint64_t frames = 0;
+        uint64_t frameUs = 0;
+        uint64_t maxFrameUs = 0;
+
+        double ParseMBps() const { return parseUs > 0 ? (double)parseBytes / (double)parseUs : 0.0; }
+        double AverageParseMs() const { return parses > 0 ? (double)parseUs / (double)parses / 1000.0 : 0.0; }
+        double AverageFrameMs() const { return frames > 0 ? (double)frameUs / (double)frames / 1000.0 : 0.0; }
+    };
+
+    // Снимок для дебаг режима
+    struct Stats {
+        uint64_t masks[(size_t)Role::Count] = {}; // Действующие маски (0 - без привязки)
+        std::string rules[(size_t)Role::Count];
+        size_t threads = 0;                       // Зарегистрированных потоков
+        bool benchmark = false;
+        bool legacyPhase = false;                 // Сейчас действует legacy размещение
+        BenchmarkSide legacy;
+        BenchmarkSide configured;
+    };
+    Stats GetStats();
+}
@@ -97,7 +97,38 @@ Translator::Translator() {
         {"distance_to_player_fmt", "Distance au joueur : %.1f m"},
         {"cursor_grid_fmt", "Case : %s"},
         {"cursor_game_coord_fmt", "Coordonnée sous le curseur (jeu) : %.1f, %.1f"},
-        {"cursor_pixel_coord_fmt", "Coordonnée sous le curseur (pixels) : %.0f, %.0f"}
+        {"cursor_pixel_coord_fmt", "Coordonnée sous le curseur (pixels) : %.0f, %.0f"},
+        {"net_stats_header_fmt", "Réseau : %s:%d"},
+        {"net_reactor_fmt", "Réacteur : %llu réveils"},
+        {"net_connectivity_fmt", "Liaison : %s, sondes %llu (échecs %llu), délai %d ms"},
+        {"net_state_disconnected", "déconnecté"},
+        {"net_state_probing", "sondage"},
+        {"net_state_connected", "connecté"},
+        {"net_state_degraded", "dégradé"},
+        {"net_batch_fmt", "Lots : %llu, taille %llu (moy. %.1f, max %llu), %.1f ms (moy. %.1f ms)"},
+        {"net_batch_off_fmt", "Lots (pipelining désactivé) : %llu, taille %llu (moy. %.1f, max %llu), %.1f ms (moy. %.1f ms)"},
+        {"net_cursors_fmt", "Curseurs : chat %d, évén. %d, dégâts %d, trous %llu, réinit. %llu, relectures %llu"},
+        {"net_buffers_fmt", "Tampons : %llu utilisés (pic %llu), %llu libres %.1f Ko, max %.1f Ko, réutil. %llu/%llu"},
+        {"net_budget_fmt", "Budget : %.0f req./s"},
+        {"net_profile_fmt", "Profil : %s, changements %llu, intervalles étirés %llu"},
+        {"net_profile_hangar", "hangar"},
+        {"net_profile_battle_air", "combat aérien"},
+        {"net_profile_battle_ground", "combat terrestre"},
+        {"net_profile_minimized", "fenêtre réduite"},
+        {"net_profile_not_running", "jeu non lancé"},
+        {"net_cpu_fmt", "CPU : %d logiques, %d cœurs physiques%s%s"},
+        {"net_cpu_smt", ", SMT"},
+        {"net_cpu_hybrid", ", cœurs P/E"},
+        {"net_placement_fmt", "Placement (%llu threads) : E/S %s [%llx], analyse %s [%llx], interface %s [%llx]"},
+        {"net_bench_fmt", "%s%s : analyse %.1f Mo/s (%llu, moy. %.3f ms), image moy. %.2f ms, max %.2f ms"},
+        {"net_bench_legacy", "Ancien placement"},
+        {"net_bench_configured", "Placement configuré"},
+        {"net_json_parser_fmt", "JSON %s : index %.0f Mo/s, construction %.0f Mo/s (%llu documents, dont %llu par parties, %.1f Mo)"},
+        {"net_map_stream_fmt", "map_obj : %llu réponses décodées pendant la réception, %llu après"},
+        {"net_parser_queue_fmt", "Analyse JSON : %d threads, file %d, réponses remplacées %llu"},
+        {"net_parser_channel_fmt", "Analyse %s : %llu traitées, %llu remplacées, attente %.2f ms, analyse %.2f ms, max %.1f ms"},
+        {"net_endpoint_fmt", "%s (P%d, %d ms) : %llu rép., inchangées %.0f%%, traitement %.2f ms, économisé %.1f ms, retards %llu, abandons %llu"},
+        {"net_conn_fmt", "Conn. #%d : %llu req., %llu réutil., %llu conn., %llu échecs, moy. %.1f ms, max %.1f ms"}
     };
 
     translations["ru"] = {
@@ -169,7 +200,38 @@ Translator::Translator() {
         {"distance_to_player_fmt", "Расстояние до игрока: %.1f м"},
         {"cursor_grid_fmt", "Квадрат: %s"},
         {"cursor_game_coord_fmt", "Координата под курсором игровая: %.1f, %.1f"},
-        {"cursor_pixel_coord_fmt", "Координата под курсором в пикселях: %.0f, %.0f"}
+        {"cursor_pixel_coord_fmt", "Координата под курсором в пикселях: %.0f, %.0f"},
+        {"net_stats_header_fmt", "Сеть: %s:%d"},
+        {"net_reactor_fmt", "Реактор: %llu пробуждений"},
+        {"net_connectivity_fmt", "Связь: %s, проб %llu (неудачных %llu), задержка %d мс"},
+        {"net_state_disconnected", "нет связи"},
+        {"net_state_probing", "проверка"},
+        {"net_state_connected", "подключено"},
+        {"net_state_degraded", "с ошибками"},
+        {"net_batch_fmt", "Пакеты: %llu, размер %llu (ср. %.1f, макс. %llu), %.1f мс (ср. %.1f мс)"},
+        {"net_batch_off_fmt", "Пакеты (pipelining выключен): %llu, размер %llu (ср. %.1f, макс. %llu), %.1f мс (ср. %.1f мс)"},
+        {"net_cursors_fmt", "Курсоры: чат %d, события %d, урон %d, пропуски %llu, сбросы %llu, перечитывания %llu"},
+        {"net_buffers_fmt", "Буферы: %llu занято (пик %llu), %llu свободно %.1f КБ, макс. %.1f КБ, повт. %llu/%llu"},
+        {"net_budget_fmt", "Бюджет: %.0f запр./с"},
+        {"net_profile_fmt", "Профиль: %s, смен %llu, растянутых интервалов %llu"},
+        {"net_profile_hangar", "ангар"},
+        {"net_profile_battle_air", "бой (авиация)"},
+        {"net_profile_battle_ground", "бой (наземка)"},
+        {"net_profile_minimized", "окно свёрнуто"},
+        {"net_profile_not_running", "игра не запущена"},
+        {"net_cpu_fmt", "CPU: %d логических, %d физических ядер%s%s"},
+        {"net_cpu_smt", ", SMT"},
+        {"net_cpu_hybrid", ", P/E ядра"},
+        {"net_placement_fmt", "Размещение (%llu потоков): I/O %s [%llx], разбор %s [%llx], интерфейс %s [%llx]"},
+        {"net_bench_fmt", "%s%s: разбор %.1f МБ/с (%llu, ср. %.3f мс), кадр ср. %.2f мс, макс. %.2f мс"},
+        {"net_bench_legacy", "Старое размещение"},
+        {"net_bench_configured", "Настроенное размещение"},
+        {"net_json_parser_fmt", "JSON %s: индекс %.0f МБ/с, построение %.0f МБ/с (%llu документов, из них по частям %llu, %.1f МБ)"},
+        {"net_map_stream_fmt", "map_obj: %llu ответов разобрано во время приёма, %llu после"},
+        {"net_parser_queue_fmt", "Разбор JSON: %d потоков, очередь %d, заменено ответов %llu"},
+        {"net_parser_channel_fmt", "Разбор %s: %llu обработано, %llu заменено, ожидание %.2f мс, разбор %.2f мс, макс. %.1f мс"},
+        {"net_endpoint_fmt", "%s (P%d, %d мс): %llu отв., без изменений %.0f%%, обработка %.2f мс, сэкономлено %.1f мс, опозданий %llu, сброшено %llu"},
+        {"net_conn_fmt", "Соед. #%d: %llu запр., %llu повт., %llu подкл., %llu ошиб., ср. %.1f мс, макс. %.1f мс"}
     };
 
     //langCode = "ru";
@@ -1,5 +1,10 @@
 #include "UI.h"
 #include "ApiFetcher.h"
+#include "JsonParser.h"
+#include "JsonLines.h"
+#include "JsonReader.h"
+#include "JsonStream.h"
+#include "Schema.h"
 #include "imgui.h"
 #include "imgui_impl_win32.h"
 #include "imgui_impl_dx11.h"
@@ -7,7 +12,9 @@
 #include <windows.h>
 #include <sstream>
 #include <algorithm>
+#include <charconv>
 #include <cstdio>
+#include <cstring>
 #include <vector>
 #include <d3d11.h>
 #include <wincodec.h>
@@ -705,312 +712,142 @@ void RenderColoredText(const std::string& text) {
 
 // Парсинг игрового чата
 void ParseGameChat(const std::string& jsonData) {
-    // Простой парсинг JSON массива сообщений
     // Формат: [{"id": 70, "msg": "...", "sender": "...", "enemy": false, "mode": "All"}, ...]
+    // Сгенерированный декодер (Schema.h): строки читаются прямо из буфера ответа, ёмкость списка сохраняется
+    static Json::Reader reader;
+    static std::vector<Schema::GameChatMessage> messages;
+    if (!reader.Reset(jsonData) || !Schema::ReadList(reader, messages) || !reader.Finish()) return;
+    if (messages.empty()) return;
+    
+    // Курсор отсекает уже опубликованные сообщения (без поиска по сохранённым) и замечает перезапуск нумерации
+    int minId = messages[0].id;
+    int maxId = minId;
+    for (size_t i = 1; i < messages.size(); i++) {
+        minId = std::min(minId, messages[i].id);
+        maxId = std::max(maxId, messages[i].id);
+    }
     
-    std::lock_guard<std::mutex> lock(g_chatMutex);
-    
-    // Функция для поиска конца объекта (с учетом вложенных объектов и строк)
-    auto findObjectEnd = [](const std::string& str, size_t start) -> size_t {
-        int depth = 0;
-        bool inString = false;
-        for (size_t i = start; i < str.size(); i++) {
-            if (str[i] == '"' && (i == 0 || str[i-1] != '\\'))
-                inString = !inString;
-            if (!inString) {
-                if (str[i] == '{') depth++;
-                if (str[i] == '}') {
-                    depth--;
-                    if (depth == 0) return i + 1;
-                }
-            }
-        }
-        return std::string::npos;
-    };
+    extern ApiFetcher* g_apiFetcher;
+    int threshold = g_lastChatId;
+    if (g_apiFetcher) {
+        threshold = g_apiFetcher->GetChatCursor().Resolve(messages.size(), minId, maxId);
+    }
     
-    size_t pos = 0;
-    while ((pos = jsonData.find("{", pos)) != std::string::npos) {
-        size_t objEnd = findObjectEnd(jsonData, pos);
-        if (objEnd == std::string::npos) break;
-        
-        std::string objStr = jsonData.substr(pos, objEnd - pos);
-        pos = objEnd;
+    // Лента только дописывается, строки копируются только у новых сообщений
+    std::lock_guard<std::mutex> lock(g_chatMutex);
+    g_lastChatId = std::max(threshold, maxId);
+    for (const Schema::GameChatMessage& item : messages) {
+        if (item.id <= threshold || item.msg.empty()) continue;
         
         ChatMessage msg;
-        
-        // Используем правильный парсинг JSON (паттерн из старого проекта)
-        // Функция для парсинга int из JSON
-        auto parseJsonInt = [](const std::string& str, const std::string& key) -> int {
-            size_t pos = str.find("\"" + key + "\"");
-            if (pos != std::string::npos) {
-                pos = str.find(":", pos);
-                if (pos != std::string::npos) {
-                    pos++;
-                    while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                        pos++;
-                    return std::stoi(str.substr(pos));
-                }
-            }
-            return 0;
-        };
-        
-        // Функция для парсинга boolean из JSON
-        auto parseJsonBool = [](const std::string& str, const std::string& key) -> bool {
-            size_t pos = str.find("\"" + key + "\"");
-            if (pos != std::string::npos) {
-                pos = str.find(":", pos);
-                if (pos != std::string::npos) {
-                    pos++;
-                    while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                        pos++;
-                    // Проверяем "true" или "false"
-                    if (pos + 4 <= str.size() && str.substr(pos, 4) == "true")
-                        return true;
-                    if (pos + 5 <= str.size() && str.substr(pos, 5) == "false")
-                        return false;
-                }
-            }
-            return false;
-        };
-        
-        // Функция для парсинга string из JSON (с правильной обработкой escape-последовательностей)
-        auto parseJsonString = [](const std::string& str, const std::string& key) -> std::string {
-            size_t pos = str.find("\"" + key + "\"");
-            if (pos != std::string::npos) {
-                pos = str.find(":", pos);
-                if (pos != std::string::npos) {
-                    pos++;
-                    while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t' || str[pos] == '\"'))
-                        pos++;
-                    size_t end = pos;
-                    while (end < str.size()) {
-                        if (str[end] == '\\' && end + 1 < str.size()) {
-                            end += 2; // Пропускаем escape-последовательность
-                            continue;
-                        }
-                        if (str[end] == '"')
-                            break;
-                        end++;
-                    }
-                    std::string result = str.substr(pos, end - pos);
-                    // Раскодируем escape-последовательности
-                    std::string decoded;
-                    for (size_t i = 0; i < result.size(); i++) {
-                        if (result[i] == '\\' && i + 1 < result.size()) {
-                            if (result[i+1] == 'n') { decoded += '\n'; i++; }
-                            else if (result[i+1] == 't') { decoded += '\t'; i++; }
-                            else if (result[i+1] == 'r') { decoded += '\r'; i++; }
-                            else if (result[i+1] == '\\') { decoded += '\\'; i++; }
-                            else if (result[i+1] == '"') { decoded += '"'; i++; }
-                            else decoded += result[i];
-                        } else {
-                            decoded += result[i];
-                        }
-                    }
-                    return decoded;
-                }
-            }
-            return "";
-        };
-        
-        msg.id = parseJsonInt(objStr, "id");
-        msg.msg = parseJsonString(objStr, "msg");
-        msg.sender = parseJsonString(objStr, "sender");
-        msg.enemy = parseJsonBool(objStr, "enemy"); // Правильный парсинг boolean
-        msg.mode = parseJsonString(objStr, "mode");
-        
-        if (msg.id > g_lastChatId) {
-            g_lastChatId = msg.id;
-            extern ApiFetcher* g_apiFetcher;
-            if (g_apiFetcher) {
-                g_apiFetcher->SetLastChatId(msg.id);
-            }
+        msg.id = item.id;
+        msg.msg = std::string(item.msg);
+        msg.sender = std::string(item.sender);
+        msg.enemy = item.enemy;
+        msg.mode = std::string(item.mode);
+        g_chatMessages.push_back(std::move(msg));
+        // Ограничиваем размер (последние 200 сообщений)
+        if (g_chatMessages.size() > 200) {
+            g_chatMessages.erase(g_chatMessages.begin());
         }
-        
-        // Добавляем сообщение (проверяем, нет ли уже такого ID)
-        bool exists = false;
-        for (const auto& existing : g_chatMessages) {
-            if (existing.id == msg.id) {
-                exists = true;
-                break;
-            }
-        }
-        if (!exists && !msg.msg.empty()) {
-            g_chatMessages.push_back(msg);
-            // Ограничиваем размер (последние 200 сообщений)
-            if (g_chatMessages.size() > 200) {
-                g_chatMessages.erase(g_chatMessages.begin());
-            }
+    }
+}
+
+// Курсор массива events из hudmsg: события не отображаются, но по курсору они не скачиваются заново при каждом опросе
+static void ResolveHudEvents(const std::vector<Schema::HudMessage>& events) {
+    extern ApiFetcher* g_apiFetcher;
+    if (!g_apiFetcher) return;
+    
+    int minId = 0;
+    int maxId = 0;
+    for (size_t i = 0; i < events.size(); i++) {
+        minId = i == 0 ? events[i].id : std::min(minId, events[i].id);
+        maxId = i == 0 ? events[i].id : std::max(maxId, events[i].id);
+    }
+    
+    g_apiFetcher->GetEventCursor().Resolve(events.size(), minId, maxId);
+}
+
+// Убрать пробелы и табуляции по краям
+static std::string_view TrimSpaces(std::string_view text) {
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\t')) text.remove_suffix(1);
+    return text;
+}
+
+// Текст события отключения игрока по причине из kd?REASON
+static std::string FormatDisconnectReason(std::string_view reason, const std::string& playerName) {
+    if (reason == "NET_PLAYER_DISCONNECT_FROM_GAME") {
+        if (playerName.empty()) {
+            return TR().Get("player_disconnected_no_name");
         }
+        char buf[256];
+        snprintf(buf, sizeof(buf), TR().Get("player_disconnected_fmt").c_str(), playerName.c_str());
+        return buf;
     }
+    
+    // Заменяем подчеркивания на пробелы и делаем первую букву заглавной
+    std::string formattedReason(reason);
+    for (size_t i = 0; i < formattedReason.size(); i++) {
+        if (formattedReason[i] == '_')
+            formattedReason[i] = ' ';
+        else if (i == 0)
+            formattedReason[i] = std::toupper(formattedReason[i]);
+    }
+    return playerName.empty() ? formattedReason : playerName + ": " + formattedReason;
 }
 
 // Парсинг событий (hudmsg) - используем паттерн из старого проекта
 void ParseHudMsg(const std::string& jsonData) {
     // Формат: {"events": [], "damage": [{"id": 161, "msg": "...", "sender": "...", "enemy": false, "mode": ""}, ...]}
+    // Сгенерированный декодер (Schema.h); сообщения damage - вектор с произвольным доступом для поиска имени
+    static Json::Reader reader;
+    static Schema::Hudmsg hudmsg;
+    if (!reader.Reset(jsonData) || !Schema::Read(reader, hudmsg) || !reader.Finish()) return;
+    
+    ResolveHudEvents(hudmsg.events);
     
     std::lock_guard<std::mutex> lock(g_eventMutex);
     
-    // Ищем массив damage
-    size_t damageStart = jsonData.find("\"damage\":[");
-    if (damageStart == std::string::npos) return;
-    
-    damageStart += 10; // Пропускаем "damage":[
-    size_t damageEnd = jsonData.find("]", damageStart);
-    if (damageEnd == std::string::npos) return;
-    
-    std::string damageArray = jsonData.substr(damageStart, damageEnd - damageStart);
-    
-    // Функция для поиска конца объекта (с учетом вложенных объектов и строк)
-    auto findObjectEnd = [](const std::string& str, size_t start) -> size_t {
-        int depth = 0;
-        bool inString = false;
-        for (size_t i = start; i < str.size(); i++) {
-            if (str[i] == '"' && (i == 0 || str[i-1] != '\\'))
-                inString = !inString;
-            if (!inString) {
-                if (str[i] == '{') depth++;
-                if (str[i] == '}') {
-                    depth--;
-                    if (depth == 0) return i + 1;
-                }
-            }
-        }
-        return std::string::npos;
-    };
+    const std::vector<Schema::HudMessage>& damage = hudmsg.damage;
+    if (damage.empty()) return;
     
-    // Функция для парсинга int из JSON
-    auto parseJsonInt = [](const std::string& str, const std::string& key) -> int {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                    pos++;
-                return std::stoi(str.substr(pos));
-            }
-        }
-        return 0;
-    };
-    
-    // Функция для парсинга string из JSON (с правильной обработкой escape-последовательностей)
-    auto parseJsonString = [](const std::string& str, const std::string& key) -> std::string {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t' || str[pos] == '\"'))
-                    pos++;
-                size_t end = pos;
-                while (end < str.size()) {
-                    if (str[end] == '\\' && end + 1 < str.size()) {
-                        end += 2; // Пропускаем escape-последовательность
-                        continue;
-                    }
-                    if (str[end] == '"')
-                        break;
-                    end++;
-                }
-                std::string result = str.substr(pos, end - pos);
-                // Раскодируем escape-последовательности
-                std::string decoded;
-                for (size_t i = 0; i < result.size(); i++) {
-                    if (result[i] == '\\' && i + 1 < result.size()) {
-                        if (result[i+1] == 'n') { decoded += '\n'; i++; }
-                        else if (result[i+1] == 't') { decoded += '\t'; i++; }
-                        else if (result[i+1] == 'r') { decoded += '\r'; i++; }
-                        else if (result[i+1] == '\\') { decoded += '\\'; i++; }
-                        else if (result[i+1] == '"') { decoded += '"'; i++; }
-                        else decoded += result[i];
-                    } else {
-                        decoded += result[i];
-                    }
-                }
-                return decoded;
-            }
-        }
-        return "";
-    };
+    // Курсор отсекает уже опубликованные события (без поиска по сохранённым) и замечает перезапуск нумерации
+    int minId = damage[0].id;
+    int maxId = minId;
+    for (size_t i = 1; i < damage.size(); i++) {
+        minId = std::min(minId, damage[i].id);
+        maxId = std::max(maxId, damage[i].id);
+    }
     
-    // Сохраняем все объекты для поиска предыдущих сообщений
-    std::vector<std::pair<size_t, size_t>> objectPositions; // (start, end)
-    size_t tempPos = 0;
-    while ((tempPos = damageArray.find("{", tempPos)) != std::string::npos) {
-        size_t objEnd = findObjectEnd(damageArray, tempPos);
-        if (objEnd == std::string::npos) break;
-        objectPositions.push_back({tempPos, objEnd});
-        tempPos = objEnd;
+    extern ApiFetcher* g_apiFetcher;
+    int threshold = g_lastEventId;
+    if (g_apiFetcher) {
+        threshold = g_apiFetcher->GetDamageCursor().Resolve(damage.size(), minId, maxId);
     }
+    g_lastEventId = std::max(threshold, maxId);
     
-    size_t objPos = 0;
-    size_t currentObjIndex = 0;
-    while ((objPos = damageArray.find("{", objPos)) != std::string::npos) {
-        size_t objEnd = findObjectEnd(damageArray, objPos);
-        if (objEnd == std::string::npos) break;
-        
-        std::string objStr = damageArray.substr(objPos, objEnd - objPos);
-        size_t originalObjPos = objPos;
-        objPos = objEnd;
-        
-        // Функция для парсинга boolean из JSON
-        auto parseJsonBool = [](const std::string& str, const std::string& key) -> bool {
-            size_t pos = str.find("\"" + key + "\"");
-            if (pos != std::string::npos) {
-                pos = str.find(":", pos);
-                if (pos != std::string::npos) {
-                    pos++;
-                    while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                        pos++;
-                    // Проверяем "true" или "false"
-                    if (pos + 4 <= str.size() && str.substr(pos, 4) == "true")
-                        return true;
-                    if (pos + 5 <= str.size() && str.substr(pos, 5) == "false")
-                        return false;
-                }
-            }
-            return false;
-        };
-        
-        int id = parseJsonInt(objStr, "id");
-        std::string msg = parseJsonString(objStr, "msg");
-        std::string sender = parseJsonString(objStr, "sender");
-        bool enemy = parseJsonBool(objStr, "enemy"); // Правильный парсинг boolean
-        std::string mode = parseJsonString(objStr, "mode");
-        int time = parseJsonInt(objStr, "time");
+    for (size_t index = 0; index < damage.size(); index++) {
+        const Schema::HudMessage& item = damage[index];
+        int id = item.id;
+        if (id <= threshold) continue; // Уже опубликовано
         
-        // Обновляем последний обработанный ID
-        if (id > g_lastEventId) {
-            g_lastEventId = id;
-            // Обновляем ID в ApiFetcher
-            extern ApiFetcher* g_apiFetcher;
-            if (g_apiFetcher) {
-                g_apiFetcher->SetLastEventId(id);
-            }
-        }
+        std::string msg(item.msg);
+        std::string_view sender = item.sender;
         
         // Обработка kd?reason сообщений (паттерн из старого проекта)
         if (msg.find("kd?") != std::string::npos || msg.find("потерял связь") != std::string::npos) {
             // Проверяем, если сообщение само содержит kd?NET_PLAYER_DISCONNECT_FROM_GAME
             size_t kdPos = msg.find("kd?");
             if (kdPos != std::string::npos) {
-                size_t reasonStart = kdPos + 3;
-                std::string reason = msg.substr(reasonStart);
+                std::string reason = msg.substr(kdPos + 3);
                 
                 // Извлекаем имя игрока: сначала из начала сообщения (до kd?), затем из sender
                 std::string playerName;
                 
                 // Пытаемся извлечь имя из начала сообщения (до kd?)
                 if (kdPos > 0) {
-                    playerName = msg.substr(0, kdPos);
-                    // Убираем пробелы в начале и конце
-                    while (!playerName.empty() && (playerName[0] == ' ' || playerName[0] == '\t')) {
-                        playerName = playerName.substr(1);
-                    }
-                    while (!playerName.empty() && (playerName.back() == ' ' || playerName.back() == '\t')) {
-                        playerName.pop_back();
-                    }
+                    playerName = TrimSpaces(std::string_view(msg).substr(0, kdPos));
                 }
                 
                 // Если не нашли в начале сообщения, пробуем из sender
@@ -1026,43 +863,24 @@ void ParseHudMsg(const std::string& jsonData) {
                     }
                 }
                 
-                // Если имя все еще не найдено, ищем в предыдущих сообщениях
-                if (playerName.empty() && currentObjIndex > 0) {
-                    for (int i = currentObjIndex - 1; i >= 0 && i >= (int)currentObjIndex - 3; i--) {
-                        std::string prevObjStr = damageArray.substr(objectPositions[i].first, 
-                                                                    objectPositions[i].second - objectPositions[i].first);
-                        std::string prevMsg = parseJsonString(prevObjStr, "msg");
-                        std::string prevSender = parseJsonString(prevObjStr, "sender");
+                // Если имя все еще не найдено, ищем в предыдущих сообщениях (строки только читаются)
+                if (playerName.empty() && index > 0) {
+                    for (int i = (int)index - 1; i >= 0 && i >= (int)index - 3; i--) {
+                        std::string_view prevMsg = damage[i].msg;
+                        std::string_view prevSender = damage[i].sender;
                         
                         // Если предыдущее сообщение содержит имя (не kd? и не пустое)
-                        if (!prevMsg.empty() && prevMsg.find("kd?") == std::string::npos) {
+                        if (!prevMsg.empty() && prevMsg.find("kd?") == std::string_view::npos) {
                             // Пробуем извлечь имя из предыдущего сообщения
                             if (!prevSender.empty()) {
                                 playerName = prevSender;
                                 break;
-                            } else if (prevMsg.find("td!") != std::string::npos) {
-                                size_t nameEnd = prevMsg.find("td!");
-                                if (nameEnd != std::string::npos) {
-                                    playerName = prevMsg.substr(0, nameEnd);
-                                    // Убираем пробелы
-                                    while (!playerName.empty() && (playerName[0] == ' ' || playerName[0] == '\t')) {
-                                        playerName = playerName.substr(1);
-                                    }
-                                    while (!playerName.empty() && (playerName.back() == ' ' || playerName.back() == '\t')) {
-                                        playerName.pop_back();
-                                    }
-                                    if (!playerName.empty()) break;
-                                }
-                            } else if (!prevMsg.empty() && prevMsg.length() < 50) {
+                            } else if (prevMsg.find("td!") != std::string_view::npos) {
+                                playerName = TrimSpaces(prevMsg.substr(0, prevMsg.find("td!")));
+                                if (!playerName.empty()) break;
+                            } else if (prevMsg.length() < 50) {
                                 // Если сообщение короткое и не содержит специальных символов, возможно это имя
-                                playerName = prevMsg;
-                                // Убираем пробелы
-                                while (!playerName.empty() && (playerName[0] == ' ' || playerName[0] == '\t')) {
-                                    playerName = playerName.substr(1);
-                                }
-                                while (!playerName.empty() && (playerName.back() == ' ' || playerName.back() == '\t')) {
-                                    playerName.pop_back();
-                                }
+                                playerName = TrimSpaces(prevMsg);
                                 if (!playerName.empty() && playerName.find(" ") == std::string::npos) {
                                     break; // Имя обычно одно слово
                                 } else {
@@ -1073,31 +891,7 @@ void ParseHudMsg(const std::string& jsonData) {
                     }
                 }
                 
-                // Форматируем сообщение
-                if (reason == "NET_PLAYER_DISCONNECT_FROM_GAME") {
-                    if (!playerName.empty()) {
-                        char buf[256];
-                        snprintf(buf, sizeof(buf), TR().Get("player_disconnected_fmt").c_str(), playerName.c_str());
-                        msg = buf;
-                    }
-                    else {
-                        msg = TR().Get("player_disconnected_no_name");
-                    }
-                } else {
-                    // Заменяем подчеркивания на пробелы и делаем первую букву заглавной
-                    std::string formattedReason = reason;
-                    for (size_t i = 0; i < formattedReason.size(); i++) {
-                        if (formattedReason[i] == '_')
-                            formattedReason[i] = ' ';
-                        else if (i == 0)
-                            formattedReason[i] = std::toupper(formattedReason[i]);
-                    }
-                    if (!playerName.empty()) {
-                        msg = playerName + ": " + formattedReason;
-                    } else {
-                        msg = formattedReason;
-                    }
-                }
+                msg = FormatDisconnectReason(reason, playerName);
             }
             else if (msg.find("потерял связь") != std::string::npos) {
                 // Извлекаем имя игрока
@@ -1115,53 +909,17 @@ void ParseHudMsg(const std::string& jsonData) {
                 
                 // Ищем следующее сообщение с kd?reason
                 bool foundReason = false;
-                size_t nextObjPos = objPos;
-                while ((nextObjPos = damageArray.find("{", nextObjPos)) != std::string::npos) {
-                    size_t nextObjEnd = findObjectEnd(damageArray, nextObjPos);
-                    if (nextObjEnd == std::string::npos) break;
-                    
-                    std::string nextObjStr = damageArray.substr(nextObjPos, nextObjEnd - nextObjPos);
-                    std::string nextMsg = parseJsonString(nextObjStr, "msg");
-                    
-                    if (nextMsg.find("kd?") != std::string::npos && (playerName.empty() || nextMsg.find(playerName) != std::string::npos)) {
-                        // Извлекаем причину
-                        size_t reasonStart = nextMsg.find("kd?");
-                        if (reasonStart != std::string::npos) {
-                            reasonStart += 3;
-                            std::string reason = nextMsg.substr(reasonStart);
-                            
-                            // Форматируем сообщение
-                            if (reason == "NET_PLAYER_DISCONNECT_FROM_GAME") {
-                                if (!playerName.empty()) {
-                                    char buf[256];
-                                    snprintf(buf, sizeof(buf), TR().Get("player_disconnected_fmt").c_str(), playerName.c_str());
-                                    msg = buf;
-                                } else {
-                                    msg = TR().Get("player_disconnected_no_name");
-                                }
-                            } else {
-                                // Заменяем подчеркивания на пробелы и делаем первую букву заглавной
-                                std::string formattedReason = reason;
-                                for (size_t i = 0; i < formattedReason.size(); i++) {
-                                    if (formattedReason[i] == '_')
-                                        formattedReason[i] = ' ';
-                                    else if (i == 0)
-                                        formattedReason[i] = std::toupper(formattedReason[i]);
-                                }
-                                if (!playerName.empty()) {
-                                    msg = playerName + ": " + formattedReason;
-                                } else {
-                                    msg = formattedReason;
-                                }
-                            }
-                            
-                            // Пропускаем следующее сообщение
-                            objPos = nextObjEnd;
-                            foundReason = true;
-                            break;
-                        }
+                for (size_t next = index + 1; next < damage.size(); next++) {
+                    std::string_view nextMsg = damage[next].msg;
+                    size_t reasonStart = nextMsg.find("kd?");
+                    if (reasonStart != std::string_view::npos && (playerName.empty() || nextMsg.find(playerName) != std::string_view::npos)) {
+                        msg = FormatDisconnectReason(nextMsg.substr(reasonStart + 3), playerName);
+                        
+                        // Пропускаем следующее сообщение
+                        index = next;
+                        foundReason = true;
+                        break;
                     }
-                    nextObjPos = nextObjEnd;
                 }
                 
                 if (!foundReason && !playerName.empty()) {
@@ -1175,303 +933,104 @@ void ParseHudMsg(const std::string& jsonData) {
             }
         }
         
-        // Добавляем событие (проверяем, нет ли уже такого ID)
-        bool exists = false;
-        for (const auto& existing : g_eventMessages) {
-            if (existing.id == id) {
-                exists = true;
-                break;
-            }
-        }
-        if (!exists && !msg.empty()) {
+        // Добавляем событие (лента только дописывается)
+        if (!msg.empty()) {
             EventMessage eventMsg;
             eventMsg.id = id;
-            eventMsg.msg = msg;
+            eventMsg.msg = std::move(msg);
             eventMsg.sender = sender;
-            eventMsg.enemy = enemy;
-            eventMsg.mode = mode;
+            eventMsg.enemy = item.enemy;
+            eventMsg.mode = std::string(item.mode);
             
-            g_eventMessages.push_back(eventMsg);
+            g_eventMessages.push_back(std::move(eventMsg));
             // Ограничиваем размер (последние 200 событий)
             if (g_eventMessages.size() > 200) {
                 g_eventMessages.erase(g_eventMessages.begin());
             }
         }
-        
-        currentObjIndex++;
     }
 }
 
 // Парсинг данных indicators
+// Самый частый опрос: сгенерированный декодер (Schema.h) читает поля курсором прямо из токенов, без дерева документа
 void ParseIndicators(const std::string& jsonData) {
-    std::lock_guard<std::mutex> lock(g_indicatorsMutex);
-    
-    // Функция для парсинга bool из JSON
-    auto parseJsonBool = [](const std::string& str, const std::string& key) -> bool {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                    pos++;
-                if (pos + 4 <= str.size() && str.substr(pos, 4) == "true")
-                    return true;
-                if (pos + 5 <= str.size() && str.substr(pos, 5) == "false")
-                    return false;
-            }
-        }
-        return false;
-    };
-    
-    // Функция для парсинга string из JSON
-    auto parseJsonString = [](const std::string& str, const std::string& key) -> std::string {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t' || str[pos] == '\"'))
-                    pos++;
-                size_t end = pos;
-                while (end < str.size()) {
-                    if (str[end] == '\\' && end + 1 < str.size()) {
-                        end += 2;
-                        continue;
-                    }
-                    if (str[end] == '"')
-                        break;
-                    end++;
-                }
-                return str.substr(pos, end - pos);
-            }
-        }
-        return "";
-    };
+    static Json::Reader reader;
+    static Schema::Indicators indicators;
+    // Битый ответ не должен частично перезаписать данные
+    if (!reader.Reset(jsonData) || !Schema::Read(reader, indicators) || !reader.Finish()) return;
+    
+    // Отсутствующие поля - значения по умолчанию, как раньше у промахов View
+    IndicatorsData data;
+    data.valid = indicators.valid;
+    data.type = indicators.type;
+    data.speed = indicators.speed;
+    data.altitude_hour = indicators.altitude_hour;
+    data.altitude_min = indicators.altitude_min;
+    data.compass = indicators.compass;
+    data.mach = indicators.mach;
+    data.g_meter = indicators.g_meter;
+    data.fuel = indicators.fuel;
+    data.throttle = indicators.throttle;
+    data.gears = indicators.gears;
+    data.flaps = indicators.flaps;
     
-    // Функция для парсинга float из JSON
-    auto parseJsonFloat = [](const std::string& str, const std::string& key) -> float {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                    pos++;
-                // Находим конец числа (до запятой, закрывающей скобки или пробела)
-                size_t end = pos;
-                while (end < str.size()) {
-                    char c = str[end];
-                    if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r')
-                        break;
-                    end++;
-                }
-                if (end > pos) {
-                    std::string numStr = str.substr(pos, end - pos);
-                    return static_cast<float>(std::atof(numStr.c_str()));
-                }
-            }
-        }
-        return 0.0f;
-    };
+    std::lock_guard<std::mutex> lock(g_indicatorsMutex);
+    g_indicatorsData = std::move(data);
     
-    g_indicatorsData.valid = parseJsonBool(jsonData, "valid");
-    g_indicatorsData.type = parseJsonString(jsonData, "type");
-    g_indicatorsData.speed = parseJsonFloat(jsonData, "speed");
-    g_indicatorsData.altitude_hour = parseJsonFloat(jsonData, "altitude_hour");
-    g_indicatorsData.altitude_min = parseJsonFloat(jsonData, "altitude_min");
-    g_indicatorsData.compass = parseJsonFloat(jsonData, "compass");
-    g_indicatorsData.mach = parseJsonFloat(jsonData, "mach");
-    g_indicatorsData.g_meter = parseJsonFloat(jsonData, "g_meter");
-    g_indicatorsData.fuel = parseJsonFloat(jsonData, "fuel");
-    g_indicatorsData.throttle = parseJsonFloat(jsonData, "throttle");
-    g_indicatorsData.gears = parseJsonFloat(jsonData, "gears");
-    g_indicatorsData.flaps = parseJsonFloat(jsonData, "flaps");
+    // Невалидные indicators (ангар) переводят опрос на редкий профиль
+    extern ApiFetcher* g_apiFetcher;
+    if (g_apiFetcher) {
+        g_apiFetcher->ReportIndicators(g_indicatorsData.valid);
+    }
 }
 
 // Парсинг данных state
+// Один проход по токенам сгенерированным декодером (Schema.h): ключи выбираются switch по хешу,
+// поля с номером двигателя ("RPM 1") - по хешу шаблона
 void ParseState(const std::string& jsonData) {
-    std::lock_guard<std::mutex> lock(g_stateMutex);
+    static Json::Reader reader;
+    static Schema::State state;
+    // Битый ответ не должен частично перезаписать данные
+    if (!reader.Reset(jsonData) || !Schema::Read(reader, state) || !reader.Finish()) return;
+    
+    // Отсутствующие поля - значения по умолчанию, как раньше у промахов View
+    StateData data;
+    data.valid = state.valid;
+    data.altitude = state.h_m;
+    data.tas = state.tas_km_h;
+    data.ias = state.ias_km_h;
+    data.mach = state.m;
+    data.aoa = state.aoa_deg;
+    data.vy = state.vy_m_s;
+    data.fuel = state.mfuel_kg;
+    data.fuel0 = state.mfuel0_kg;
+    data.throttle1 = state.throttle_pct[0];
+    data.rpm1 = state.rpm[0];
+    data.power1 = state.power_hp[0];
     
-    // Функция для парсинга bool из JSON
-    auto parseJsonBool = [](const std::string& str, const std::string& key) -> bool {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                    pos++;
-                if (pos + 4 <= str.size() && str.substr(pos, 4) == "true")
-                    return true;
-                if (pos + 5 <= str.size() && str.substr(pos, 5) == "false")
-                    return false;
-            }
-        }
-        return false;
-    };
-    
-    // Функция для парсинга int из JSON
-    auto parseJsonInt = [](const std::string& str, const std::string& key) -> int {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                    pos++;
-                // Находим конец числа (до запятой, закрывающей скобки или пробела)
-                size_t end = pos;
-                while (end < str.size()) {
-                    char c = str[end];
-                    if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r')
-                        break;
-                    end++;
-                }
-                if (end > pos) {
-                    std::string numStr = str.substr(pos, end - pos);
-                    return std::atoi(numStr.c_str());
-                }
-            }
-        }
-        return 0;
-    };
-    
-    // Функция для парсинга float из JSON
-    auto parseJsonFloat = [](const std::string& str, const std::string& key) -> float {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                    pos++;
-                // Находим конец числа (до запятой, закрывающей скобки или пробела)
-                size_t end = pos;
-                while (end < str.size()) {
-                    char c = str[end];
-                    if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r')
-                        break;
-                    end++;
-                }
-                if (end > pos) {
-                    std::string numStr = str.substr(pos, end - pos);
-                    return static_cast<float>(std::atof(numStr.c_str()));
-                }
-            }
-        }
-        return 0.0f;
-    };
-    
-    g_stateData.valid = parseJsonBool(jsonData, "valid");
-    g_stateData.altitude = parseJsonInt(jsonData, "H, m");
-    g_stateData.tas = parseJsonInt(jsonData, "TAS, km/h");
-    g_stateData.ias = parseJsonInt(jsonData, "IAS, km/h");
-    g_stateData.mach = parseJsonFloat(jsonData, "M");
-    g_stateData.aoa = parseJsonFloat(jsonData, "AoA, deg");
-    g_stateData.vy = parseJsonFloat(jsonData, "Vy, m/s");
-    g_stateData.fuel = parseJsonInt(jsonData, "Mfuel, kg");
-    g_stateData.fuel0 = parseJsonInt(jsonData, "Mfuel0, kg");
-    g_stateData.throttle1 = parseJsonInt(jsonData, "throttle 1, %");
-    g_stateData.rpm1 = parseJsonInt(jsonData, "RPM 1");
-    g_stateData.power1 = parseJsonFloat(jsonData, "power 1, hp");
+    std::lock_guard<std::mutex> lock(g_stateMutex);
+    g_stateData = data;
 }
 
 // Парсинг данных mission
 void ParseMission(const std::string& jsonData) {
-    std::lock_guard<std::mutex> lock(g_missionMutex);
-    
-    // Функция для парсинга bool из JSON
-    auto parseJsonBool = [](const std::string& str, const std::string& key) -> bool {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                    pos++;
-                if (pos + 4 <= str.size() && str.substr(pos, 4) == "true")
-                    return true;
-                if (pos + 5 <= str.size() && str.substr(pos, 5) == "false")
-                    return false;
-            }
-        }
-        return false;
-    };
-    
-    // Функция для парсинга string из JSON
-    auto parseJsonString = [](const std::string& str, const std::string& key) -> std::string {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t' || str[pos] == '\"'))
-                    pos++;
-                size_t end = pos;
-                while (end < str.size()) {
-                    if (str[end] == '\\' && end + 1 < str.size()) {
-                        end += 2;
-                        continue;
-                    }
-                    if (str[end] == '"')
-                        break;
-                    end++;
-                }
-                return str.substr(pos, end - pos);
-            }
-        }
-        return "";
-    };
-    
-    g_missionData.valid = true;
-    g_missionData.status = parseJsonString(jsonData, "status");
-    g_missionData.objectives.clear();
-    
-    // Парсим массив objectives
-    size_t objectivesStart = jsonData.find("\"objectives\":[");
-    if (objectivesStart != std::string::npos) {
-        objectivesStart += 14; // Пропускаем "objectives":[
-        size_t objectivesEnd = jsonData.find("]", objectivesStart);
-        if (objectivesEnd != std::string::npos) {
-            std::string objectivesArray = jsonData.substr(objectivesStart, objectivesEnd - objectivesStart);
-            
-            // Функция для поиска конца объекта
-            auto findObjectEnd = [](const std::string& str, size_t start) -> size_t {
-                int depth = 0;
-                bool inString = false;
-                for (size_t i = start; i < str.size(); i++) {
-                    if (str[i] == '"' && (i == 0 || str[i-1] != '\\'))
-                        inString = !inString;
-                    if (!inString) {
-                        if (str[i] == '{') depth++;
-                        if (str[i] == '}') {
-                            depth--;
-                            if (depth == 0) return i + 1;
-                        }
-                    }
-                }
-                return std::string::npos;
-            };
-            
-            size_t objPos = 0;
-            while ((objPos = objectivesArray.find("{", objPos)) != std::string::npos) {
-                size_t objEnd = findObjectEnd(objectivesArray, objPos);
-                if (objEnd == std::string::npos) break;
-                
-                std::string objStr = objectivesArray.substr(objPos, objEnd - objPos);
-                
-                MissionObjective objective;
-                objective.primary = parseJsonBool(objStr, "primary");
-                objective.status = parseJsonString(objStr, "status");
-                objective.text = parseJsonString(objStr, "text");
-                
-                g_missionData.objectives.push_back(objective);
-                
-                objPos = objEnd;
-            }
-        }
+    static Json::Reader reader;
+    static Schema::Mission mission;
+    if (!reader.Reset(jsonData) || !Schema::Read(reader, mission) || !reader.Finish()) return;
+    
+    MissionData data;
+    data.valid = true;
+    data.status = mission.status;
+    data.objectives.reserve(mission.objectives.size());
+    for (const Schema::MissionObjective& item : mission.objectives) {
+        MissionObjective& objective = data.objectives.emplace_back();
+        objective.primary = item.primary;
+        objective.status = item.status;
+        objective.text = item.text;
     }
+    
+    std::lock_guard<std::mutex> lock(g_missionMutex);
+    g_missionData = std::move(data);
 }
 
 // Функция для перезагрузки карты
@@ -1503,90 +1062,29 @@ static void ReloadMapTexture() {
 
 // Парсинг данных map_info
 void ParseMapInfo(const std::string& jsonData) {
-    std::lock_guard<std::mutex> lock(g_mapInfoMutex);
+    static Json::Reader reader;
+    static Schema::MapInfo info;
+    if (!reader.Reset(jsonData) || !Schema::Read(reader, info) || !reader.Finish()) return;
     
-    // Функция для парсинга массива float из JSON
-    auto parseJsonFloatArray = [](const std::string& str, const std::string& key, float* outArray, int count) -> bool {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos == std::string::npos) return false;
-        
-        pos = str.find("[", pos);
-        if (pos == std::string::npos) return false;
-        
-        pos++; // Пропускаем [
-        size_t end = str.find("]", pos);
-        if (end == std::string::npos) return false;
-        
-        std::string arrayStr = str.substr(pos, end - pos);
-        
-        // Парсим элементы массива
-        size_t itemStart = 0;
-        int index = 0;
-        while (itemStart < arrayStr.length() && index < count) {
-            // Пропускаем пробелы и кавычки
-            while (itemStart < arrayStr.length() && (arrayStr[itemStart] == ' ' || arrayStr[itemStart] == '\t' || arrayStr[itemStart] == '"'))
-                itemStart++;
-            
-            if (itemStart >= arrayStr.length()) break;
-            
-            // Ищем конец числа (запятая, закрывающая скобка или пробел)
-            size_t itemEnd = itemStart;
-            while (itemEnd < arrayStr.length()) {
-                char c = arrayStr[itemEnd];
-                if (c == ',' || c == ']' || c == ' ' || c == '\t' || c == '"')
-                    break;
-                itemEnd++;
-            }
-            
-            if (itemEnd > itemStart) {
-                std::string numStr = arrayStr.substr(itemStart, itemEnd - itemStart);
-                outArray[index] = static_cast<float>(std::atof(numStr.c_str()));
-                index++;
-            }
-            
-            // Пропускаем запятую
-            if (itemEnd < arrayStr.length() && arrayStr[itemEnd] == ',')
-                itemEnd++;
-            
-            itemStart = itemEnd;
-        }
-        
-        return index == count;
-    };
+    // Пары чисел: прочитанные элементы и их число (меньше двух - поле не меняется)
+    const float* sources[4] = { info.grid_steps, info.grid_zero, info.map_min, info.map_max };
+    size_t counts[4] = { info.grid_steps_count, info.grid_zero_count, info.map_min_count, info.map_max_count };
+    bool valid = info.valid;
+    int hudType = info.hud_type;
+    int newMapGeneration = info.map_generation;
     
-    // Функция для парсинга int из JSON
-    auto parseJsonInt = [](const std::string& str, const std::string& key) -> int {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                    pos++;
-                // Ищем конец числа
-                size_t end = pos;
-                while (end < str.size()) {
-                    char c = str[end];
-                    if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r')
-                        break;
-                    end++;
-                }
-                if (end > pos) {
-                    std::string numStr = str.substr(pos, end - pos);
-                    return std::atoi(numStr.c_str());
-                }
-            }
-        }
-        return 0;
-    };
+    std::lock_guard<std::mutex> lock(g_mapInfoMutex);
+    
+    // Массив чисел фиксированной длины (значение не меняется, если массив короче)
+    float* targets[4] = { g_mapInfoData.gridSteps, g_mapInfoData.gridZero, g_mapInfoData.mapMin, g_mapInfoData.mapMax };
+    for (size_t i = 0; i < 4; i++) {
+        if (counts[i] < 2) continue;
+        targets[i][0] = sources[i][0];
+        targets[i][1] = sources[i][1];
+    }
     
     g_mapInfoData.valid = true;
-    parseJsonFloatArray(jsonData, "grid_steps", g_mapInfoData.gridSteps, 2);
-    parseJsonFloatArray(jsonData, "grid_zero", g_mapInfoData.gridZero, 2);
-    parseJsonFloatArray(jsonData, "map_min", g_mapInfoData.mapMin, 2);
-    parseJsonFloatArray(jsonData, "map_max", g_mapInfoData.mapMax, 2);
-    g_mapInfoData.hudType = parseJsonInt(jsonData, "hud_type");
-    int newMapGeneration = parseJsonInt(jsonData, "map_generation");
+    g_mapInfoData.hudType = hudType;
     
     // Проверяем, изменилась ли карта
     if (g_lastMapGeneration != -1 && g_lastMapGeneration != newMapGeneration) {
@@ -1596,131 +1094,199 @@ void ParseMapInfo(const std::string& jsonData) {
     
     g_mapInfoData.mapGeneration = newMapGeneration;
     g_lastMapGeneration = newMapGeneration;
+    
+    // Профиль опроса: есть ли карта (бой) и тип HUD (авиа/танки)
+    extern ApiFetcher* g_apiFetcher;
+    if (g_apiFetcher) {
+        g_apiFetcher->ReportMapInfo(valid, g_mapInfoData.hudType);
+    }
 }
 
-// Парсинг объектов карты (map_obj.json)
-void ParseMapObjects(const std::string& jsonData) {
-    std::lock_guard<std::mutex> lock(g_mapObjectsMutex);
+// Поля одного объекта карты (map_obj.json)
+struct MapObjectFields {
+    std::string type;
+    std::string icon;
+    std::string color;
+    float x = 0.0f, y = 0.0f;
+    float dx = 0.0f, dy = 0.0f;
+    float sx = 0.0f, sy = 0.0f;
+    float ex = 0.0f, ey = 0.0f;
+};
+
+// Объект карты из курсора (следующее значение); false - не объект (значение пропущено)
+// Поля читает сгенерированный декодер (Schema.h), строки копируются из его string_view
+static bool ReadMapObject(Json::Reader& reader, MapObjectFields& fields) {
+    Schema::MapObject object;
+    bool success = Schema::Read(reader, object);
+    fields.type = object.type;
+    fields.icon = object.icon;
+    fields.color = object.color;
+    fields.x = object.x;
+    fields.y = object.y;
+    fields.dx = object.dx;
+    fields.dy = object.dy;
+    fields.sx = object.sx;
+    fields.sy = object.sy;
+    fields.ex = object.ex;
+    fields.ey = object.ey;
+    return success;
+}
+
+// Потоковый разбор map_obj.json в потоке реактора: каждый объект декодируется, как только
+// закрылась его скобка, пока остальное тело ещё идёт по сети
+// Декодируется только изменившееся тело: пока принятое совпадает с началом прошлого переданного тела,
+// байты лишь сравниваются (неизменное тело ApiFetcher отбросит по отпечатку); с первого отличия
+// совпавшее начало берётся из прошлого тела, дальше разбор идёт по мере приёма
+// Готовые списки ждут ParseMapObjects под отпечатком тела: ящик JsonParser может выбросить
+// тело, не дойдя до разбора, поэтому очередь готовых списков сверяется с содержимым, а не с порядком
+class MapObjectsStream : public ApiFetcher::EndpointStream {
+public:
+    static constexpr size_t MAX_READY = 4; // Неразобранные callback'ом списки (не должны копиться)
+    
+    MapObjectsStream() {
+        m_parser.SetElementCallback([this](std::string_view element) { OnElement(element); });
+    }
     
-    // Помечаем все объекты как "не обновлённые"
-    for (auto& obj : g_mapObjects)
-        obj.initialized = false;
+    void OnBodyBegin() override {
+        m_parser.Reset();
+        m_objects.clear();
+        m_failed = false;
+        m_changed = false;
+        m_matched = 0;
+    }
     
-    // Функция для поиска конца объекта (с учетом вложенных объектов и строк)
-    auto findObjectEnd = [](const std::string& str, size_t start) -> size_t {
-        int depth = 0;
-        bool inString = false;
-        for (size_t i = start; i < str.size(); i++) {
-            if (str[i] == '"' && (i == 0 || str[i-1] != '\\'))
-                inString = !inString;
-            if (!inString) {
-                if (str[i] == '{') depth++;
-                if (str[i] == '}') {
-                    depth--;
-                    if (depth == 0) return i + 1;
-                }
+    void OnBodyData(const char* data, size_t size) override {
+        if (!m_changed) {
+            if (size <= m_previous.size() - m_matched && std::memcmp(m_previous.data() + m_matched, data, size) == 0) {
+                m_matched += size;
+                return;
             }
+            m_changed = true;
+            Feed(m_previous.data(), m_matched);
         }
-        return std::string::npos;
-    };
+        Feed(data, size);
+    }
     
-    // Парсим объекты
-    size_t pos = 0;
-    while ((pos = jsonData.find("{", pos)) != std::string::npos) {
-        size_t endPos = findObjectEnd(jsonData, pos);
-        if (endPos == std::string::npos) break;
+    void OnBodyDispatched(const std::string& body, uint64_t fingerprint) override {
+        // Тело - начало прошлого (или то же тело после перезапуска загрузчика): разбираем целиком сейчас
+        if (!m_changed) Feed(body.data(), body.size());
+        m_previous.assign(body);
         
-        std::string objStr = jsonData.substr(pos, endPos - pos);
-        pos = endPos;
+        Result result;
+        result.valid = !m_failed && m_parser.Finish();
+        result.fingerprint = fingerprint;
+        result.objects.swap(m_objects);
         
-        // Извлекаем данные объекта
-        auto getStringField = [&](const std::string& key) -> std::string {
-            size_t keyPos = objStr.find("\"" + key + "\"");
-            if (keyPos != std::string::npos) {
-                keyPos = objStr.find(":", keyPos);
-                if (keyPos != std::string::npos) {
-                    keyPos++;
-                    while (keyPos < objStr.size() && (objStr[keyPos] == ' ' || objStr[keyPos] == '\"'))
-                        keyPos++;
-                    size_t end = keyPos;
-                    while (end < objStr.size() && objStr[end] != '\"' && objStr[end] != ',')
-                        end++;
-                    return objStr.substr(keyPos, end - keyPos);
-                }
-            }
-            return "";
-        };
-        
-        auto getFloatField = [&](const std::string& key) -> float {
-            size_t keyPos = objStr.find("\"" + key + "\"");
-            if (keyPos != std::string::npos) {
-                keyPos = objStr.find(":", keyPos);
-                if (keyPos != std::string::npos) {
-                    keyPos++;
-                    while (keyPos < objStr.size() && (objStr[keyPos] == ' ' || objStr[keyPos] == '\t'))
-                        keyPos++;
-                    // Ищем конец числа
-                    size_t end = keyPos;
-                    while (end < objStr.size()) {
-                        char c = objStr[end];
-                        if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r')
-                            break;
-                        end++;
-                    }
-                    if (end > keyPos) {
-                        std::string numStr = objStr.substr(keyPos, end - keyPos);
-                        return static_cast<float>(std::atof(numStr.c_str()));
-                    }
-                }
-            }
-            return 0.0f;
-        };
-        
-        std::string type = getStringField("type");
-        std::string icon = getStringField("icon");
-        float newX = getFloatField("x");
-        float newY = getFloatField("y");
-        float newDx = getFloatField("dx");
-        float newDy = getFloatField("dy");
-        
-        // Парсим цвет для идентификации
-        std::string newColorHash;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_ready.push_back(std::move(result));
+        if (m_ready.size() > MAX_READY) m_ready.pop_front();
+    }
+    
+    // Список объектов для тела с отпечатком fingerprint (Hash64 тела); false - потокового разбора нет или он не удался
+    // Берётся самый новый подходящий список, более старые отброшены (их тела заменены в ящике)
+    bool Take(uint64_t fingerprint, std::vector<MapObjectFields>& objects) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t i = m_ready.size(); i-- > 0;) {
+            if (m_ready[i].fingerprint != fingerprint) continue;
+            Result result = std::move(m_ready[i]);
+            m_ready.erase(m_ready.begin(), m_ready.begin() + (ptrdiff_t)i + 1);
+            if (!result.valid) return false;
+            objects.swap(result.objects);
+            return true;
+        }
+        return false;
+    }
+    
+private:
+    struct Result {
+        bool valid = false;
+        uint64_t fingerprint = 0;
+        std::vector<MapObjectFields> objects;
+    };
+    
+    void Feed(const char* data, size_t size) {
+        if (!m_failed && !m_parser.Feed(data, size)) m_failed = true;
+    }
+    
+    void OnElement(std::string_view element) {
+        if (m_failed) return;
+        MapObjectFields& fields = m_objects.emplace_back();
+        if (!m_reader.Reset(element.data(), element.size()) || !ReadMapObject(m_reader, fields)) {
+            m_objects.pop_back();
+        }
+        if (m_reader.HasError() || !m_reader.Finish()) m_failed = true;
+    }
+    
+    Json::StreamParser m_parser;
+    Json::Reader m_reader;
+    std::vector<MapObjectFields> m_objects;
+    bool m_failed = false;
+    
+    std::string m_previous; // Последнее переданное в callback тело
+    size_t m_matched = 0;   // Принято байт, совпавших с началом m_previous
+    bool m_changed = false; // Текущее тело отличается от m_previous - идёт разбор
+    
+    std::mutex m_mutex;
+    std::deque<Result> m_ready;
+};
+
+static MapObjectsStream g_mapObjectsStream;
+static std::atomic<uint64_t> g_mapObjectsStreamed{0}; // Ответов, разобранных во время приёма
+static std::atomic<uint64_t> g_mapObjectsReparsed{0}; // Ответов, разобранных после приёма целиком
+
+ApiFetcher::EndpointStream* GetMapObjectsStream() {
+    return &g_mapObjectsStream;
+}
+
+// Парсинг объектов карты (map_obj.json), fingerprint - Hash64 тела, посчитанный при приёме
+void ParseMapObjects(const std::string& jsonData, uint64_t fingerprint) {
+    static std::vector<MapObjectFields> objects; // Ёмкость сохраняется между опросами
+    objects.clear();
+    
+    if (g_mapObjectsStream.Take(fingerprint, objects)) {
+        g_mapObjectsStreamed.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        // Потокового разбора не было (или он не удался) - читаем тело целиком
+        static Json::Reader reader;
+        if (!reader.Reset(jsonData) || !reader.EnterArray()) return;
+        while (reader.NextItem()) {
+            MapObjectFields& fields = objects.emplace_back();
+            if (!ReadMapObject(reader, fields)) objects.pop_back();
+        }
+        // Битый ответ или мусор после массива не трогает объекты карты (то же правило, что у потокового разбора)
+        if (reader.HasError() || !reader.Finish()) return;
+        g_mapObjectsReparsed.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    std::lock_guard<std::mutex> lock(g_mapObjectsMutex);
+    
+    // Помечаем все объекты как "не обновлённые"
+    for (auto& obj : g_mapObjects)
+        obj.initialized = false;
+    
+    for (const MapObjectFields& item : objects) {
+        // type, icon и цвет только сравниваются - строки копируются лишь для новых объектов
+        std::string_view type = item.type;
+        std::string_view icon = item.icon;
+        float newX = item.x;
+        float newY = item.y;
+        float newDx = item.dx;
+        float newDy = item.dy;
+        
+        // Цвет "#RRGGBB": шесть hex-цифр - ещё и хеш для идентификации
+        std::string_view newColorHash;
         float newR = 1.0f, newG = 1.0f, newB = 1.0f;
         {
-            size_t keyPos = objStr.find("\"color\"");
-            if (keyPos != std::string::npos && keyPos + 7 < objStr.size()) {
-                if (objStr[keyPos + 7] == '[') {
-                    // Массив цветов
-                    size_t arrayStart = keyPos + 7;
-                    size_t arrayEnd = objStr.find("]", arrayStart);
-                    if (arrayEnd != std::string::npos) {
-                        newColorHash = objStr.substr(arrayStart, arrayEnd - arrayStart + 1);
-                        // Парсим первый цвет для отображения
-                        size_t firstHash = newColorHash.find("#");
-                        if (firstHash != std::string::npos) {
-                            std::string hexStr = newColorHash.substr(firstHash + 1, 6);
-                            size_t validLen = 0;
-                            unsigned int colorValue = std::stoul(hexStr, &validLen, 16);
-                            if (validLen == 6) {
-                                newR = ((colorValue >> 16) & 0xFF) / 255.0f;
-                                newG = ((colorValue >> 8) & 0xFF) / 255.0f;
-                                newB = (colorValue & 0xFF) / 255.0f;
-                            }
-                        }
-                    }
-                } else {
-                    // Строка цвета
-                    size_t hashPos = objStr.find("#", keyPos);
-                    if (hashPos != std::string::npos) {
-                        newColorHash = objStr.substr(hashPos + 1, 6);
-                        size_t validLen = 0;
-                        unsigned int colorValue = std::stoul(newColorHash, &validLen, 16);
-                        if (validLen == 6) {
-                            newR = ((colorValue >> 16) & 0xFF) / 255.0f;
-                            newG = ((colorValue >> 8) & 0xFF) / 255.0f;
-                            newB = (colorValue & 0xFF) / 255.0f;
-                        }
-                    }
+            std::string_view color = item.color;
+            size_t hashPos = color.find('#');
+            if (hashPos != std::string_view::npos) {
+                newColorHash = color.substr(hashPos + 1, 6);
+                unsigned int colorValue = 0;
+                auto result = std::from_chars(newColorHash.data(), newColorHash.data() + newColorHash.size(), colorValue, 16);
+                if (result.ec == std::errc() && result.ptr - newColorHash.data() == 6) {
+                    newR = ((colorValue >> 16) & 0xFF) / 255.0f;
+                    newG = ((colorValue >> 8) & 0xFF) / 255.0f;
+                    newB = (colorValue & 0xFF) / 255.0f;
                 }
             }
         }
@@ -1790,10 +1356,10 @@ void ParseMapObjects(const std::string& jsonData) {
             bestMatch->dy = newDy;
             
             // Обновляем направление (sx, sy, ex, ey)
-            bestMatch->sx = getFloatField("sx");
-            bestMatch->sy = getFloatField("sy");
-            bestMatch->ex = getFloatField("ex");
-            bestMatch->ey = getFloatField("ey");
+            bestMatch->sx = item.sx;
+            bestMatch->sy = item.sy;
+            bestMatch->ex = item.ex;
+            bestMatch->ey = item.ey;
             
             // Обновляем цвет
             bestMatch->r = newR;
@@ -1815,10 +1381,10 @@ void ParseMapObjects(const std::string& jsonData) {
             obj.y = newY;
             obj.dx = newDx;
             obj.dy = newDy;
-            obj.sx = getFloatField("sx");
-            obj.sy = getFloatField("sy");
-            obj.ex = getFloatField("ex");
-            obj.ey = getFloatField("ey");
+            obj.sx = item.sx;
+            obj.sy = item.sy;
+            obj.ex = item.ex;
+            obj.ey = item.ey;
             obj.isPlayer = (icon == "Player");
             obj.r = newR;
             obj.g = newG;
@@ -1827,7 +1393,7 @@ void ParseMapObjects(const std::string& jsonData) {
             obj.initialized = true;
             obj.lastUpdateTime = currentTime;
             
-            g_mapObjects.push_back(obj);
+            g_mapObjects.push_back(std::move(obj));
         }
     }
     
@@ -1848,6 +1414,213 @@ void ParseMapObjects(const std::string& jsonData) {
     
 }
 
+// Дебаг панель сетевой статистики (правый верхний угол карты)
+static void RenderNetworkDebugPanel(ImDrawList* drawList, ImVec2 areaPos, ImVec2 areaSize) {
+    extern ApiFetcher* g_apiFetcher;
+    extern JsonParser* g_jsonParser;
+    if (!g_apiFetcher) return;
+    
+    std::vector<std::string> lines;
+    char line[256];
+    
+    snprintf(line, sizeof(line), TR().Get("net_stats_header_fmt").c_str(), ApiFetcher::API_HOST, (int)ApiFetcher::API_PORT);
+    lines.push_back(line);
+    
+    snprintf(line, sizeof(line), TR().Get("net_reactor_fmt").c_str(), (unsigned long long)g_apiFetcher->GetReactorWakeups());
+    lines.push_back(line);
+    
+    ApiFetcher::ConnectivityStats connectivity = g_apiFetcher->GetConnectivityStats();
+    const char* stateKey = "net_state_disconnected";
+    switch (connectivity.state) {
+        case Connectivity::State::Probing: stateKey = "net_state_probing"; break;
+        case Connectivity::State::Connected: stateKey = "net_state_connected"; break;
+        case Connectivity::State::Degraded: stateKey = "net_state_degraded"; break;
+        default: break;
+    }
+    snprintf(line, sizeof(line), TR().Get("net_connectivity_fmt").c_str(),
+        TR().Get(stateKey).c_str(),
+        (unsigned long long)connectivity.probes,
+        (unsigned long long)connectivity.failedProbes,
+        connectivity.probeDelayMs);
+    lines.push_back(line);
+    
+    ApiFetcher::BatchStats batchStats = g_apiFetcher->GetBatchStats();
+    snprintf(line, sizeof(line), TR().Get(batchStats.pipelining ? "net_batch_fmt" : "net_batch_off_fmt").c_str(),
+        (unsigned long long)batchStats.batches,
+        (unsigned long long)batchStats.lastSize,
+        batchStats.AverageSize(),
+        (unsigned long long)batchStats.maxSize,
+        batchStats.lastWallUs / 1000.0,
+        batchStats.AverageWallMs());
+    lines.push_back(line);
+    
+    StreamCursor::Stats chatCursor = g_apiFetcher->GetChatCursor().GetStats();
+    StreamCursor::Stats eventCursor = g_apiFetcher->GetEventCursor().GetStats();
+    StreamCursor::Stats damageCursor = g_apiFetcher->GetDamageCursor().GetStats();
+    snprintf(line, sizeof(line), TR().Get("net_cursors_fmt").c_str(),
+        chatCursor.lastId,
+        eventCursor.lastId,
+        damageCursor.lastId,
+        (unsigned long long)(chatCursor.gaps + eventCursor.gaps + damageCursor.gaps),
+        (unsigned long long)(chatCursor.resets + eventCursor.resets + damageCursor.resets),
+        (unsigned long long)(chatCursor.verifications + eventCursor.verifications + damageCursor.verifications));
+    lines.push_back(line);
+    
+    BufferPool::Stats bufferStats = g_apiFetcher->GetBufferStats();
+    snprintf(line, sizeof(line), TR().Get("net_buffers_fmt").c_str(),
+        (unsigned long long)bufferStats.inUse,
+        (unsigned long long)bufferStats.peakInUse,
+        (unsigned long long)bufferStats.freeBuffers,
+        bufferStats.freeBytes / 1024.0,
+        bufferStats.largestBuffer / 1024.0,
+        (unsigned long long)bufferStats.reuses,
+        (unsigned long long)bufferStats.acquires);
+    lines.push_back(line);
+    
+    snprintf(line, sizeof(line), TR().Get("net_budget_fmt").c_str(),
+        g_apiFetcher->GetRequestBudget());
+    lines.push_back(line);
+    
+    ApiFetcher::ProfileStats profileStats = g_apiFetcher->GetProfileStats();
+    const char* profileKey = "net_profile_not_running";
+    switch (profileStats.profile) {
+        case PollProfile::Hangar: profileKey = "net_profile_hangar"; break;
+        case PollProfile::BattleAir: profileKey = "net_profile_battle_air"; break;
+        case PollProfile::BattleGround: profileKey = "net_profile_battle_ground"; break;
+        case PollProfile::Minimized: profileKey = "net_profile_minimized"; break;
+        default: break;
+    }
+    snprintf(line, sizeof(line), TR().Get("net_profile_fmt").c_str(),
+        TR().Get(profileKey).c_str(),
+        (unsigned long long)profileStats.switches,
+        (unsigned long long)profileStats.stretched);
+    lines.push_back(line);
+    
+    const ThreadPlacement::Topology& topology = ThreadPlacement::GetTopology();
+    snprintf(line, sizeof(line), TR().Get("net_cpu_fmt").c_str(),
+        (int)topology.cpus.size(),
+        topology.physicalCores,
+        topology.smt ? TR().Get("net_cpu_smt").c_str() : "",
+        topology.hybrid ? TR().Get("net_cpu_hybrid").c_str() : "");
+    lines.push_back(line);
+    
+    ThreadPlacement::Stats placement = ThreadPlacement::GetStats();
+    snprintf(line, sizeof(line), TR().Get("net_placement_fmt").c_str(),
+        (unsigned long long)placement.threads,
+        placement.rules[(size_t)ThreadPlacement::Role::Io].c_str(),
+        (unsigned long long)placement.masks[(size_t)ThreadPlacement::Role::Io],
+        placement.rules[(size_t)ThreadPlacement::Role::Parse].c_str(),
+        (unsigned long long)placement.masks[(size_t)ThreadPlacement::Role::Parse],
+        placement.rules[(size_t)ThreadPlacement::Role::Render].c_str(),
+        (unsigned long long)placement.masks[(size_t)ThreadPlacement::Role::Render]);
+    lines.push_back(line);
+    
+    // Бенчмарк размещения: старое (всё на CPU 0/1) против настроенного
+    if (placement.benchmark) {
+        const ThreadPlacement::BenchmarkSide* sides[2] = { &placement.legacy, &placement.configured };
+        const char* sideKeys[2] = { "net_bench_legacy", "net_bench_configured" };
+        for (int i = 0; i < 2; i++) {
+            bool active = placement.legacyPhase == (i == 0);
+            snprintf(line, sizeof(line), TR().Get("net_bench_fmt").c_str(),
+                TR().Get(sideKeys[i]).c_str(),
+                active ? " *" : "",
+                sides[i]->ParseMBps(),
+                (unsigned long long)sides[i]->parses,
+                sides[i]->AverageParseMs(),
+                sides[i]->AverageFrameMs(),
+                sides[i]->maxFrameUs / 1000.0);
+            lines.push_back(line);
+        }
+    }
+    
+    // Скорость разбора JSON: первый проход (индекс токенов) и второй (узлы документа)
+    Json::ParserStats parserStats = Json::GetParserStats();
+    snprintf(line, sizeof(line), TR().Get("net_json_parser_fmt").c_str(),
+        parserStats.implementation,
+        parserStats.IndexMBps(),
+        parserStats.BuildMBps(),
+        (unsigned long long)parserStats.documents,
+        (unsigned long long)parserStats.parallelDocuments,
+        parserStats.bytes / (1024.0 * 1024.0));
+    lines.push_back(line);
+    
+    // map_obj: ответы, разобранные во время приёма тела, и разобранные целиком после него
+    snprintf(line, sizeof(line), TR().Get("net_map_stream_fmt").c_str(),
+        (unsigned long long)g_mapObjectsStreamed.load(),
+        (unsigned long long)g_mapObjectsReparsed.load());
+    lines.push_back(line);
+    
+    // Потоки разбора: ящики эндпоинтов держат только последний неразобранный ответ
+    if (g_jsonParser) {
+        std::vector<JsonParser::ChannelStats> channels = g_jsonParser->GetChannelStats();
+        uint64_t dropped = 0;
+        for (const JsonParser::ChannelStats& channel : channels) dropped += channel.dropped;
+        snprintf(line, sizeof(line), TR().Get("net_parser_queue_fmt").c_str(),
+            (int)g_jsonParser->GetWorkerCount(),
+            (int)g_jsonParser->GetQueueSize(),
+            (unsigned long long)dropped);
+        lines.push_back(line);
+        for (const JsonParser::ChannelStats& channel : channels) {
+            snprintf(line, sizeof(line), TR().Get("net_parser_channel_fmt").c_str(),
+                channel.channel.c_str(),
+                (unsigned long long)channel.processed,
+                (unsigned long long)channel.dropped,
+                channel.AverageWaitMs(),
+                channel.AverageParseMs(),
+                channel.maxLatencyUs / 1000.0);
+            lines.push_back(line);
+        }
+    }
+    
+    for (const ApiFetcher::EndpointStats& stats : g_apiFetcher->GetEndpointStats()) {
+        snprintf(line, sizeof(line), TR().Get("net_endpoint_fmt").c_str(),
+            stats.name,
+            stats.priority,
+            stats.intervalMs,
+            (unsigned long long)stats.responses,
+            stats.UnchangedRatio() * 100.0,
+            stats.AverageCallbackMs(),
+            stats.SavedMs(),
+            (unsigned long long)stats.deadlineMisses,
+            (unsigned long long)stats.shed);
+        lines.push_back(line);
+    }
+    
+    std::vector<Http::ConnectionStats> connStats = g_apiFetcher->GetConnectionStats();
+    for (size_t i = 0; i < connStats.size(); i++) {
+        const Http::ConnectionStats& stats = connStats[i];
+        snprintf(line, sizeof(line), TR().Get("net_conn_fmt").c_str(),
+            (int)i + 1,
+            (unsigned long long)stats.requests,
+            (unsigned long long)stats.reuses,
+            (unsigned long long)stats.connects,
+            (unsigned long long)stats.failures,
+            stats.AverageLatencyMs(),
+            stats.maxLatencyUs / 1000.0);
+        lines.push_back(line);
+    }
+    
+    const float padding = 10.0f;
+    float lineHeight = ImGui::GetTextLineHeight();
+    float maxLineWidth = 0.0f;
+    for (const auto& text : lines) {
+        float width = ImGui::CalcTextSize(text.c_str()).x;
+        if (width > maxLineWidth) maxLineWidth = width;
+    }
+    
+    ImVec2 panelMin(areaPos.x + areaSize.x - maxLineWidth - padding * 3.0f, areaPos.y + padding);
+    ImVec2 panelMax(areaPos.x + areaSize.x - padding, panelMin.y + lines.size() * lineHeight + padding * 2.0f);
+    
+    drawList->AddRectFilled(panelMin, panelMax, IM_COL32(0, 0, 0, 200), 3.0f);
+    drawList->AddRect(panelMin, panelMax, IM_COL32(255, 255, 255, 255), 3.0f, 0, 2.0f);
+    
+    float lineY = panelMin.y + padding;
+    for (const auto& text : lines) {
+        drawList->AddText(ImVec2(panelMin.x + padding, lineY), IM_COL32(255, 255, 255, 255), text.c_str());
+        lineY += lineHeight;
+    }
+}
+
 // Инициализация UI
 void InitializeUI()
 {
@@ -3681,6 +3454,9 @@ void RenderUI()
             0,
             2.0f
         );
+        
+        // Сетевая статистика (пул соединений к API)
+        RenderNetworkDebugPanel(drawList, contentScreenPos, contentSize);
     }
     
     // === CONTENT 1 (левая боковая панель) ===
@@ -3724,36 +3500,6 @@ void RenderUI()
     ImGui::Separator();
     ImGui::Spacing();
     
-    // Функция для парсинга float из JSON
-    auto parseJsonFloat = [](const std::string& str, const std::string& key) -> float {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                    pos++;
-                return static_cast<float>(std::atof(str.substr(pos).c_str()));
-            }
-        }
-        return 0.0f;
-    };
-    
-    // Функция для парсинга int из JSON
-    auto parseJsonInt = [](const std::string& str, const std::string& key) -> int {
-        size_t pos = str.find("\"" + key + "\"");
-        if (pos != std::string::npos) {
-            pos = str.find(":", pos);
-            if (pos != std::string::npos) {
-                pos++;
-                while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t'))
-                    pos++;
-                return std::atoi(str.substr(pos).c_str());
-            }
-        }
-        return 0;
-    };
-    
     // Отображаем данные Indicators
     {
         std::lock_guard<std::mutex> lock(g_indicatorsMutex);
@@ -2,6 +2,7 @@
 
 #include "imgui.h"
 #include <string>
+#include <cstdint>
 #include <vector>
 #include <mutex>
 
@@ -144,7 +145,7 @@ void ParseIndicators(const std::string& jsonData);
 void ParseState(const std::string& jsonData);
 void ParseMission(const std::string& jsonData);
 void ParseMapInfo(const std::string& jsonData);
-void ParseMapObjects(const std::string& jsonData);
+void ParseMapObjects(const std::string& jsonData, uint64_t fingerprint);
 
 // Инициализация UI
 void InitializeUI();
@@ -0,0 +1,366 @@
+#include "Utf8.h"
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define UTF8_AVX2
+#elif defined(__SSSE3__) || (defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64))
+#include <tmmintrin.h>
+#define UTF8_SSSE3
+#if !defined(__SSSE3__)
+// MSVC не объявляет SSSE3 в сборке x64 (SSE2): наличие проверяется при запуске
+#include <intrin.h>
+#define UTF8_SSSE3_RUNTIME
+#endif
+#endif
+
+namespace Utf8 {
+    namespace {
+        // Длина верной последовательности с p (left > 0 байт), 0 - неверная;
+        // bad - длина наибольшей неверной части (заменяется одним REPLACEMENT)
+        size_t Sequence(const uint8_t* p, size_t left, size_t& bad) {
+            uint8_t c = p[0];
+            if (c < 0x80) return 1;
+            size_t need;
+            uint8_t low = 0x80;
+            uint8_t high = 0xBF;
+            if (c >= 0xC2 && c <= 0xDF) {
+                need = 1;
+            } else if (c == 0xE0) {
+                need = 2;
+                low = 0xA0; // Overlong
+            } else if ((c >= 0xE1 && c <= 0xEC) || c == 0xEE || c == 0xEF) {
+                need = 2;
+            } else if (c == 0xED) {
+                need = 2;
+                high = 0x9F; // Суррогаты
+            } else if (c == 0xF0) {
+                need = 3;
+                low = 0x90; // Overlong
+            } else if (c >= 0xF1 && c <= 0xF3) {
+                need = 3;
+            } else if (c == 0xF4) {
+                need = 3;
+                high = 0x8F; // Больше U+10FFFF
+            } else {
+                bad = 1;
+                return 0;
+            }
+            for (size_t k = 1; k <= need; k++) {
+                if (k >= left) {
+                    bad = k;
+                    return 0;
+                }
+                uint8_t b = p[k];
+                bool inRange = k == 1 ? (b >= low && b <= high) : (b >= 0x80 && b <= 0xBF);
+                if (!inRange) {
+                    bad = k;
+                    return 0;
+                }
+            }
+            return need + 1;
+        }
+
+        constexpr uint64_t HIGH_BITS = 0x8080808080808080ull;
+        constexpr uint64_t LOW_BITS = 0x0101010101010101ull;
+
+        ScanResult ScanScalar(const char* data, size_t size) {
+            ScanResult result;
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+            size_t i = 0;
+            // ASCII начало по 8 байт: старшие биты и '\' одной проверкой слова (в ASCII слове xor не даёт старших битов)
+            for (; i + 8 <= size; i += 8) {
+                uint64_t word;
+                std::memcpy(&word, bytes + i, 8);
+                if (word & HIGH_BITS) break;
+                uint64_t slash = word ^ (LOW_BITS * '\\');
+                if ((slash - LOW_BITS) & ~slash & HIGH_BITS) result.backslash = true;
+            }
+            for (; i < size && bytes[i] < 0x80; i++) {
+                if (bytes[i] == '\\') result.backslash = true;
+            }
+            if (i == size) return result;
+
+            // Остаток с многобайтовыми последовательностями
+            if (!result.backslash) result.backslash = std::memchr(bytes + i, '\\', size - i) != nullptr;
+            while (i < size) {
+                if (i + 8 <= size) {
+                    uint64_t word;
+                    std::memcpy(&word, bytes + i, 8);
+                    if ((word & HIGH_BITS) == 0) {
+                        i += 8;
+                        continue;
+                    }
+                }
+                size_t bad;
+                size_t length = Sequence(bytes + i, size - i, bad);
+                if (length == 0) {
+                    result.valid = false;
+                    break;
+                }
+                i += length;
+            }
+            return result;
+        }
+
+#if defined(UTF8_AVX2) || defined(UTF8_SSSE3)
+        // Ошибки пары (предыдущий байт, текущий): бит - вид ошибки, ошибка есть, если бит остался во всех трёх таблицах
+        // (первый байт: старшая и младшая тетрады, второй байт: старшая тетрада)
+        enum : uint8_t {
+            TOO_SHORT = 1 << 0,      // Ведущий байт без продолжения
+            TOO_LONG = 1 << 1,       // Продолжение после ASCII
+            OVERLONG_3 = 1 << 2,     // E0 80..9F
+            TOO_LARGE = 1 << 3,      // F4 90..BF, F5..FF
+            SURROGATE = 1 << 4,      // ED A0..BF
+            OVERLONG_2 = 1 << 5,     // C0, C1
+            TOO_LARGE_1000 = 1 << 6, // F5..FF 80..8F
+            OVERLONG_4 = 1 << 6,     // F0 80..8F
+            TWO_CONTS = 1 << 7,      // Два продолжения подряд (допустимы только внутри 3-4 байтовых)
+            CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS
+        };
+
+        constexpr uint8_t FIRST_HIGH[16] = {
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+            TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+            TOO_SHORT | OVERLONG_2,
+            TOO_SHORT,
+            TOO_SHORT | OVERLONG_3 | SURROGATE,
+            TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+        };
+
+        constexpr uint8_t FIRST_LOW[16] = {
+            CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+            CARRY | OVERLONG_2,
+            CARRY,
+            CARRY,
+            CARRY | TOO_LARGE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000
+        };
+
+        constexpr uint8_t SECOND_HIGH[16] = {
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+        };
+
+        // Незаконченная последовательность в последних трёх байтах блока
+        constexpr uint8_t INCOMPLETE_MAX[16] = {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+        };
+#endif
+
+#if defined(UTF8_AVX2)
+        struct Simd {
+            using Vector = __m256i;
+            static constexpr size_t SIZE = 32;
+
+            static Vector Load(const char* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            static Vector Zero() { return _mm256_setzero_si256(); }
+            static Vector Table(const uint8_t (&table)[16]) {
+                return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+            }
+            static Vector Lookup(Vector table, Vector index) { return _mm256_shuffle_epi8(table, index); }
+            static Vector High(Vector v) { return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F)); }
+            static Vector Low(Vector v) { return _mm256_and_si256(v, _mm256_set1_epi8(0x0F)); }
+            // Байт i - байт i - N общего потока (начало - из предыдущего блока)
+            template<int N>
+            static Vector Previous(Vector input, Vector previous) {
+                return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+            }
+            static Vector And(Vector a, Vector b) { return _mm256_and_si256(a, b); }
+            static Vector Or(Vector a, Vector b) { return _mm256_or_si256(a, b); }
+            static Vector Xor(Vector a, Vector b) { return _mm256_xor_si256(a, b); }
+            static Vector SubSaturate(Vector a, Vector b) { return _mm256_subs_epu8(a, b); }
+            static Vector Set(uint8_t value) { return _mm256_set1_epi8((char)value); }
+            static bool IsAscii(Vector v) { return _mm256_movemask_epi8(v) == 0; }
+            static bool Any(Vector v) { return !_mm256_testz_si256(v, v); }
+            static bool HasByte(Vector v, char c) { return _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(c))) != 0; }
+        };
+#elif defined(UTF8_SSSE3)
+        struct Simd {
+            using Vector = __m128i;
+            static constexpr size_t SIZE = 16;
+
+            static Vector Load(const char* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static Vector Zero() { return _mm_setzero_si128(); }
+            static Vector Table(const uint8_t (&table)[16]) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)); }
+            static Vector Lookup(Vector table, Vector index) { return _mm_shuffle_epi8(table, index); }
+            static Vector High(Vector v) { return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F)); }
+            static Vector Low(Vector v) { return _mm_and_si128(v, _mm_set1_epi8(0x0F)); }
+            template<int N>
+            static Vector Previous(Vector input, Vector previous) { return _mm_alignr_epi8(input, previous, 16 - N); }
+            static Vector And(Vector a, Vector b) { return _mm_and_si128(a, b); }
+            static Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+            static Vector Xor(Vector a, Vector b) { return _mm_xor_si128(a, b); }
+            static Vector SubSaturate(Vector a, Vector b) { return _mm_subs_epu8(a, b); }
+            static Vector Set(uint8_t value) { return _mm_set1_epi8((char)value); }
+            static bool IsAscii(Vector v) { return _mm_movemask_epi8(v) == 0; }
+            static bool Any(Vector v) { return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) != 0xFFFF; }
+            static bool HasByte(Vector v, char c) { return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c))) != 0; }
+        };
+#endif
+
+#if defined(UTF8_AVX2) || defined(UTF8_SSSE3)
+        struct Validator {
+            Simd::Vector firstHigh = Simd::Table(FIRST_HIGH);
+            Simd::Vector firstLow = Simd::Table(FIRST_LOW);
+            Simd::Vector secondHigh = Simd::Table(SECOND_HIGH);
+            Simd::Vector incompleteMax;
+            Simd::Vector error = Simd::Zero();
+            Simd::Vector previous = Simd::Zero();
+            Simd::Vector previousIncomplete = Simd::Zero();
+            bool backslash = false;
+
+            Validator() {
+                alignas(32) uint8_t table[Simd::SIZE];
+                std::memset(table, 0xFF, sizeof(table));
+                std::memcpy(table + Simd::SIZE - 16, INCOMPLETE_MAX, 16);
+                incompleteMax = Simd::Load(reinterpret_cast<const char*>(table));
+            }
+
+            void Block(Simd::Vector input) {
+                backslash |= Simd::HasByte(input, '\\');
+                if (Simd::IsAscii(input)) {
+                    // Последовательность из прошлого блока не закончилась
+                    error = Simd::Or(error, previousIncomplete);
+                    previous = input;
+                    previousIncomplete = Simd::Zero();
+                    return;
+                }
+
+                Simd::Vector previous1 = Simd::Previous<1>(input, previous);
+                Simd::Vector special = Simd::And(
+                    Simd::And(Simd::Lookup(firstHigh, Simd::High(previous1)), Simd::Lookup(firstLow, Simd::Low(previous1))),
+                    Simd::Lookup(secondHigh, Simd::High(input)));
+
+                // Третий и четвёртый байты 3-4 байтовых последовательностей должны быть продолжениями (TWO_CONTS)
+                Simd::Vector previous2 = Simd::Previous<2>(input, previous);
+                Simd::Vector previous3 = Simd::Previous<3>(input, previous);
+                Simd::Vector third = Simd::SubSaturate(previous2, Simd::Set(0xE0 - 0x80));
+                Simd::Vector fourth = Simd::SubSaturate(previous3, Simd::Set(0xF0 - 0x80));
+                Simd::Vector must23 = Simd::And(Simd::Or(third, fourth), Simd::Set(0x80));
+                error = Simd::Or(error, Simd::Xor(must23, special));
+
+                previous = input;
+                previousIncomplete = Simd::SubSaturate(input, incompleteMax);
+            }
+
+            bool Finish() const {
+                return !Simd::Any(Simd::Or(error, previousIncomplete));
+            }
+        };
+
+        ScanResult ScanSimd(const char* data, size_t size) {
+            Validator validator;
+            size_t i = 0;
+            for (; i + Simd::SIZE <= size; i += Simd::SIZE) {
+                validator.Block(Simd::Load(data + i));
+            }
+            if (i < size) {
+                // Хвост - в блок, дополненный нулями (ASCII: незаконченная последовательность видна сразу)
+                alignas(32) char tail[Simd::SIZE] = {};
+                std::memcpy(tail, data + i, size - i);
+                validator.Block(Simd::Load(tail));
+            }
+            ScanResult result;
+            result.valid = validator.Finish();
+            result.backslash = validator.backslash;
+            return result;
+        }
+#endif
+
+#if defined(UTF8_SSSE3_RUNTIME)
+        bool HasSsse3() {
+            int info[4];
+            __cpuid(info, 1);
+            return (info[2] & (1 << 9)) != 0;
+        }
+
+        const bool g_hasSsse3 = HasSsse3();
+#endif
+    }
+
+    ScanResult Scan(const char* data, size_t size) {
+        if (size == 0) return ScanResult();
+#if defined(UTF8_SSSE3_RUNTIME)
+        if (!g_hasSsse3) return ScanScalar(data, size);
+#endif
+#if defined(UTF8_AVX2) || defined(UTF8_SSSE3)
+        // Короткие строки (ключи, типы объектов) быстрее проверить словами, чем собирать блок с хвостом
+        if (size < Simd::SIZE) return ScanScalar(data, size);
+        return ScanSimd(data, size);
+#else
+        return ScanScalar(data, size);
+#endif
+    }
+
+    size_t Encode(uint32_t codepoint, char* out) {
+        if ((codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF) codepoint = REPLACEMENT;
+        if (codepoint < 0x80) {
+            out[0] = (char)codepoint;
+            return 1;
+        }
+        if (codepoint < 0x800) {
+            out[0] = (char)(0xC0 | (codepoint >> 6));
+            out[1] = (char)(0x80 | (codepoint & 0x3F));
+            return 2;
+        }
+        if (codepoint < 0x10000) {
+            out[0] = (char)(0xE0 | (codepoint >> 12));
+            out[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+            out[2] = (char)(0x80 | (codepoint & 0x3F));
+            return 3;
+        }
+        out[0] = (char)(0xF0 | (codepoint >> 18));
+        out[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        out[3] = (char)(0x80 | (codepoint & 0x3F));
+        return 4;
+    }
+
+    size_t Repair(const char* data, size_t size, char* out) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        size_t length = 0;
+        size_t i = 0;
+        while (i < size) {
+            size_t bad;
+            size_t sequence = Sequence(bytes + i, size - i, bad);
+            if (sequence == 0) {
+                length += Encode(REPLACEMENT, out + length);
+                i += bad;
+                continue;
+            }
+            std::memcpy(out + length, data + i, sequence);
+            length += sequence;
+            i += sequence;
+        }
+        return length;
+    }
+
+    const char* GetImplementation() {
+#if defined(UTF8_SSSE3_RUNTIME)
+        if (!g_hasSsse3) return "scalar";
+#endif
+#if defined(UTF8_AVX2)
+        return "AVX2";
+#elif defined(UTF8_SSSE3)
+        return "SSSE3";
+#else
+        return "scalar";
+#endif
+    }
+}
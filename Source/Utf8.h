@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Проверка UTF-8 для строк JSON перед выводом (ImGui получает только верный текст)
+// Векторный проход (AVX2 или SSSE3): по три таблицы на блок для первого и второго байта последовательности,
+// блоки из одного ASCII проверяются одним сравнением; без SIMD - скалярно с пропуском ASCII по 8 байт
+namespace Utf8 {
+    // Замена неверных последовательностей и одиночных суррогатов (3 байта в UTF-8)
+    constexpr uint32_t REPLACEMENT = 0xFFFD;
+
+    struct ScanResult {
+        bool valid = true;      // Верный UTF-8 (без overlong, суррогатов и точек больше U+10FFFF)
+        bool backslash = false; // Есть '\' (в строке JSON - escape-последовательность)
+    };
+
+    // Один проход по тексту: проверка UTF-8 и поиск '\'
+    ScanResult Scan(const char* data, size_t size);
+    inline bool IsValid(const char* data, size_t size) { return Scan(data, size).valid; }
+
+    // Точка в UTF-8 (до 4 байт); суррогаты и точки больше U+10FFFF - REPLACEMENT
+    size_t Encode(uint32_t codepoint, char* out);
+
+    // Копия текста, каждая неверная последовательность (наибольшая неверная часть) - REPLACEMENT
+    // out должен вмещать 3 * size байт
+    size_t Repair(const char* data, size_t size, char* out);
+
+    // Реализация проверки в этой сборке ("AVX2", "SSSE3" или "scalar")
+    const char* GetImplementation();
+}
@@ -0,0 +1,86 @@
+#include "WorkerPool.h"
+#include "ThreadPlacement.h"
+#include <algorithm>
+
+WorkerPool::WorkerPool(size_t threads) {
+    for (size_t i = 1; i < threads; i++) {
+        m_threads.emplace_back(&WorkerPool::WorkerThread, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        if (thread.joinable()) thread.join();
+    }
+}
+
+size_t WorkerPool::DefaultThreadCount(size_t maxThreads) {
+    size_t cpus = std::thread::hardware_concurrency();
+    return std::clamp<size_t>(cpus, 1, std::max<size_t>(maxThreads, 1));
+}
+
+void WorkerPool::RunItems(const std::function<void(size_t)>* task, size_t count) {
+    size_t index;
+    while ((index = m_nextItem.fetch_add(1, std::memory_order_relaxed)) < count) {
+        (*task)(index);
+        if (m_doneItems.fetch_add(1, std::memory_order_acq_rel) + 1 == count) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_finished.notify_all();
+        }
+    }
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)>& task) {
+    if (count == 0) return;
+    std::lock_guard<std::mutex> runLock(m_runMutex);
+
+    if (m_threads.empty() || count == 1) {
+        for (size_t i = 0; i < count; i++) task(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_count = count;
+        m_nextItem = 0;
+        m_doneItems = 0;
+        m_generation++;
+    }
+    m_wake.notify_all();
+
+    RunItems(&task, count);
+
+    // Ждём и последнюю часть, и выход потоков пула из RunItems: после возврата задача недействительна
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finished.wait(lock, [this, count] { return m_doneItems.load(std::memory_order_acquire) == count && m_active == 0; });
+    m_task = nullptr;
+}
+
+void WorkerPool::WorkerThread() {
+    ThreadPlacement::ScopedRole placement(ThreadPlacement::Role::Parse);
+
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_wake.wait(lock, [this, seen] { return m_stopping || m_generation != seen; });
+        if (m_stopping) break;
+        seen = m_generation;
+        // Проснулись после завершения задачи - её уже нет
+        if (!m_task) continue;
+
+        const std::function<void(size_t)>* task = m_task;
+        size_t count = m_count;
+        m_active++;
+        lock.unlock();
+        RunItems(task, count);
+        lock.lock();
+        m_active--;
+        if (m_active == 0) m_finished.notify_all();
+    }
+}
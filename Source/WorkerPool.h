@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+#include <cstdint>
+#include <cstddef>
+
+// Пул потоков для одной задачи, разбитой на независимые части (параллельный разбор JSON)
+// Части раздаются атомарным счётчиком потокам пула и вызывающему потоку, вызов возвращается после последней
+// Потоки пула объявляют роль Parse (ThreadPlacement)
+class WorkerPool {
+public:
+    // Дополнительных потоков: threads - 1 (вызывающий поток тоже работает)
+    explicit WorkerPool(size_t threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // Потоков, включая вызывающий
+    size_t GetThreadCount() const { return m_threads.size() + 1; }
+
+    // task(i) для i из [0, count); одновременно выполняется один ParallelFor (остальные ждут)
+    void ParallelFor(size_t count, const std::function<void(size_t)>& task);
+
+    // Потоков по умолчанию: логические процессоры, но не больше maxThreads
+    static size_t DefaultThreadCount(size_t maxThreads);
+
+private:
+    void WorkerThread();
+    void RunItems(const std::function<void(size_t)>* task, size_t count);
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_runMutex; // Один ParallelFor за раз
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_finished;
+    const std::function<void(size_t)>* m_task = nullptr; // nullptr - задачи нет
+    size_t m_count = 0;
+    uint64_t m_generation = 0;
+    size_t m_active = 0;            // Потоков пула внутри RunItems
+    std::atomic<size_t> m_nextItem{0};
+    std::atomic<size_t> m_doneItems{0};
+    bool m_stopping = false;
+};
@@ -6,7 +6,9 @@
 #include "imgui_impl_dx11.h"
 #include "UI.h"
 #include "JsonParser.h"
+#include "JsonWriter.h"
 #include "ApiFetcher.h"
+#include "ThreadPlacement.h"
 #include "FontEmbedded.h"
 #include "dictionary.hpp"
 #include <d3d11.h>
@@ -16,9 +18,9 @@
 #include <string>
 #include <vector>
 #include <mutex>
-#include <sstream>
-#include <iomanip>
+#include <atomic>
 #include <cstdio>
+#include <chrono>
 #include <windows.h>
 #include <dwmapi.h>
 
@@ -32,8 +34,10 @@ static ID3D11RenderTargetView*  g_mainRenderTargetView = nullptr;
 
 HWND                           g_hWnd = nullptr; // Глобальный handle окна (используется в UI.cpp)
 
-// JSON парсер (работает на отдельном ядре)
-static JsonParser*              g_jsonParser = nullptr;
+// JSON парсер (работает на отдельных потоках)
+JsonParser*                     g_jsonParser = nullptr; // Глобальный, используется в UI.cpp
+static size_t                   g_parseThreads = 0; // Потоки разбора больших документов ([Json] ParseThreads)
+static size_t                   g_parseWorkers = 0; // Потоки JsonParser ([Json] ParseWorkers)
 
 // API загрузчик (работает на отдельном потоке)
 ApiFetcher*                     g_apiFetcher = nullptr; // Глобальный, используется в UI.cpp
@@ -86,124 +90,128 @@ void CleanupRenderTarget();
 LRESULT WINAPI WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
 // Функция для отображения JSON значения в интерфейсе
+// Текст пишется потоково (Json::Writer) прямо в output, отступы начинаются с уровня depth
 void DisplayJsonValue(std::string& output, std::shared_ptr<Json::Value> value, const std::string& prefix = "", int depth = 0) {
+    output += prefix;
     if (!value) {
         output += "null";
         return;
     }
     
-    std::string indent(depth * 2, ' ');
-    std::ostringstream oss;
+    Json::StringSink sink(output);
+    Json::Writer writer(sink, Json::Writer::Style::Pretty, depth);
+    writer.Write(*value);
+}
+
+// Настройки производительности из config.ini:
+// [Threads] Io=, Parse=, Render= - правила размещения потоков (см. ThreadPlacement.h)
+// [Threads] Benchmark=N - попеременно старое и настроенное размещение по N секунд, результаты в дебаг режиме
+// [Json] ParseThreads=N - потоки разбора больших массивов по частям (0 - по числу ядер, до 8; 1 - без частей)
+// [Json] ParseWorkers=N - потоки JsonParser для ответов эндпоинтов (0 - по умолчанию, 2)
+static void LoadPerformanceSettings()
+{
+    char exePath[MAX_PATH];
+    GetModuleFileNameA(nullptr, exePath, MAX_PATH);
+    std::string configPath = exePath;
+    size_t lastSlash = configPath.find_last_of("\\/");
+    if (lastSlash != std::string::npos) {
+        configPath = configPath.substr(0, lastSlash + 1) + "config.ini";
+    } else {
+        configPath = "config.ini";
+    }
     
-    switch (value->type) {
-        case Json::ValueType::Null:
-            output += prefix + "null";
-            break;
-        case Json::ValueType::Boolean:
-            output += prefix + (value->asBool() ? "true" : "false");
-            break;
-        case Json::ValueType::Number:
-            oss << std::fixed << std::setprecision(6) << value->asNumber();
-            output += prefix + oss.str();
-            oss.str("");
-            oss.clear();
-            break;
-        case Json::ValueType::String:
-            output += prefix + "\"" + value->asString() + "\"";
-            break;
-        case Json::ValueType::Array:
-            output += prefix + "[\n";
-            for (size_t i = 0; i < value->arrayValue.size(); ++i) {
-                oss << indent << "  [" << i << "]: ";
-                output += oss.str();
-                oss.str("");
-                oss.clear();
-                DisplayJsonValue(output, value->arrayValue[i], "", depth + 1);
-                if (i < value->arrayValue.size() - 1) output += ",";
-                output += "\n";
-            }
-            output += indent + "]";
-            break;
-        case Json::ValueType::Object:
-            output += prefix + "{\n";
-            size_t idx = 0;
-            for (const auto& pair : value->objectValue) {
-                output += indent + "  \"" + pair.first + "\": ";
-                DisplayJsonValue(output, pair.second, "", depth + 1);
-                if (++idx < value->objectValue.size()) output += ",";
-                output += "\n";
-            }
-            output += indent + "}";
-            break;
+    static const char* roleKeys[(size_t)ThreadPlacement::Role::Count] = { "Io", "Parse", "Render" };
+    char buffer[256];
+    for (size_t i = 0; i < (size_t)ThreadPlacement::Role::Count; i++) {
+        GetPrivateProfileStringA("Threads", roleKeys[i], "any", buffer, sizeof(buffer), configPath.c_str());
+        ThreadPlacement::SetRule((ThreadPlacement::Role)i, buffer);
     }
+    
+    int benchmarkSeconds = GetPrivateProfileIntA("Threads", "Benchmark", 0, configPath.c_str());
+    if (benchmarkSeconds > 0) {
+        ThreadPlacement::StartBenchmark(benchmarkSeconds);
+    }
+    
+    // Параллельный разбор больших документов JsonParser
+    int parseThreads = GetPrivateProfileIntA("Json", "ParseThreads", 0, configPath.c_str());
+    g_parseThreads = parseThreads > 0 ? (size_t)parseThreads : 0;
+    int parseWorkers = GetPrivateProfileIntA("Json", "ParseWorkers", 0, configPath.c_str());
+    g_parseWorkers = parseWorkers > 0 ? (size_t)parseWorkers : 0;
 }
 
 // Main code
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow)
 {
-    // Привязываем главный поток к другому ядру (для интерфейса)
-    // Парсер будет на первом ядре, интерфейс на втором
-    #ifdef _WIN32
-    DWORD_PTR processAffinityMask = 0;
-    DWORD_PTR systemAffinityMask = 0;
-    if (GetProcessAffinityMask(GetCurrentProcess(), &processAffinityMask, &systemAffinityMask)) {
-        // Находим второе доступное ядро
-        DWORD_PTR core2 = 0x2;
-        if (processAffinityMask & core2) {
-            SetThreadAffinityMask(GetCurrentThread(), core2);
-        }
-    }
-    #endif
+    // Размещение потоков по ядрам (по умолчанию без привязки), главный поток - роль Render
+    LoadPerformanceSettings();
+    ThreadPlacement::ScopedRole renderPlacement(ThreadPlacement::Role::Render);
     
-    // Создаем JSON парсер (будет работать на отдельном потоке/ядре)
-    g_jsonParser = new JsonParser();
+    // Создаем JSON парсер (будет работать на отдельных потоках)
+    g_jsonParser = new JsonParser(g_parseWorkers, g_parseThreads);
     
     // Создаем API загрузчик (будет работать на отдельном потоке)
     g_apiFetcher = new ApiFetcher();
     
-    // Настраиваем callback'и для обработки данных
-    g_apiFetcher->SetChatCallback([](const std::string& jsonData) {
+    // Настраиваем callback'и для обработки данных (буфер ответа возвращается в пул после разбора)
+    // Снимки состояния (indicators, state, mission, map_info, map_obj) разбираются потоками JsonParser
+    // через ящик эндпоинта: неразобранный ответ заменяется новым, поток загрузчика только передаёт буфер
+    // Чат и события - сразу на потоке загрузчика (важен каждый ответ)
+    g_apiFetcher->SetChatCallback([](PooledBuffer jsonData, uint64_t) {
         // Парсим чат в отдельном потоке
         extern void ParseGameChat(const std::string& jsonData);
-        ParseGameChat(jsonData);
+        ParseGameChat(jsonData.Str());
     });
     
-    g_apiFetcher->SetEventCallback([](const std::string& jsonData) {
+    g_apiFetcher->SetEventCallback([](PooledBuffer jsonData, uint64_t) {
         // Парсим события в отдельном потоке
         extern void ParseHudMsg(const std::string& jsonData);
-        ParseHudMsg(jsonData);
+        ParseHudMsg(jsonData.Str());
     });
     
-    g_apiFetcher->SetIndicatorsCallback([](const std::string& jsonData) {
-        // Парсим indicators в отдельном потоке
-        extern void ParseIndicators(const std::string& jsonData);
-        ParseIndicators(jsonData);
+    g_apiFetcher->SetIndicatorsCallback([](PooledBuffer jsonData, uint64_t) {
+        g_jsonParser->DispatchLatestAsync("indicators", std::move(jsonData), [](PooledBuffer jsonData) {
+            // Парсим indicators в отдельном потоке
+            extern void ParseIndicators(const std::string& jsonData);
+            ParseIndicators(jsonData.Str());
+        });
     });
     
-    g_apiFetcher->SetStateCallback([](const std::string& jsonData) {
-        // Парсим state в отдельном потоке
-        extern void ParseState(const std::string& jsonData);
-        ParseState(jsonData);
+    g_apiFetcher->SetStateCallback([](PooledBuffer jsonData, uint64_t) {
+        g_jsonParser->DispatchLatestAsync("state", std::move(jsonData), [](PooledBuffer jsonData) {
+            // Парсим state в отдельном потоке
+            extern void ParseState(const std::string& jsonData);
+            ParseState(jsonData.Str());
+        });
     });
     
-    g_apiFetcher->SetMissionCallback([](const std::string& jsonData) {
-        // Парсим mission в отдельном потоке
-        extern void ParseMission(const std::string& jsonData);
-        ParseMission(jsonData);
+    g_apiFetcher->SetMissionCallback([](PooledBuffer jsonData, uint64_t) {
+        g_jsonParser->DispatchLatestAsync("mission", std::move(jsonData), [](PooledBuffer jsonData) {
+            // Парсим mission в отдельном потоке
+            extern void ParseMission(const std::string& jsonData);
+            ParseMission(jsonData.Str());
+        });
     });
     
-    g_apiFetcher->SetMapInfoCallback([](const std::string& jsonData) {
-        // Парсим map_info в отдельном потоке
-        extern void ParseMapInfo(const std::string& jsonData);
-        ParseMapInfo(jsonData);
+    g_apiFetcher->SetMapInfoCallback([](PooledBuffer jsonData, uint64_t) {
+        g_jsonParser->DispatchLatestAsync("map_info", std::move(jsonData), [](PooledBuffer jsonData) {
+            // Парсим map_info в отдельном потоке
+            extern void ParseMapInfo(const std::string& jsonData);
+            ParseMapInfo(jsonData.Str());
+        });
     });
     
-    g_apiFetcher->SetMapObjectsCallback([](const std::string& jsonData) {
-        // Парсим map_obj в отдельном потоке
-        extern void ParseMapObjects(const std::string& jsonData);
-        ParseMapObjects(jsonData);
+    g_apiFetcher->SetMapObjectsCallback([](PooledBuffer jsonData, uint64_t fingerprint) {
+        g_jsonParser->DispatchLatestAsync("map_obj", std::move(jsonData), [fingerprint](PooledBuffer jsonData) {
+            // Парсим map_obj в отдельном потоке (отпечаток - ключ списка, разобранного при приёме)
+            extern void ParseMapObjects(const std::string& jsonData, uint64_t fingerprint);
+            ParseMapObjects(jsonData.Str(), fingerprint);
+        });
     });
     
+    // Изменившийся map_obj разбирается по мере приёма тела (поток реактора), callback получает готовые объекты
+    extern ApiFetcher::EndpointStream* GetMapObjectsStream();
+    g_apiFetcher->SetEndpointStream(ApiEndpoint::MapObjects, GetMapObjectsStream());
+    
     // Запускаем загрузчик
     g_apiFetcher->Start();
     
@@ -389,10 +397,13 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
         // Handle window being minimized
         if (g_SwapChainOccluded && g_pSwapChain->Present(0, DXGI_PRESENT_TEST) == DXGI_STATUS_OCCLUDED)
         {
+            // Окно не видно - опрос API переходит на редкий профиль
+            g_apiFetcher->SetWindowVisible(false);
             ::Sleep(10);
             continue;
         }
         g_SwapChainOccluded = false;
+        g_apiFetcher->SetWindowVisible(true);
         
         // Handle window resize
         if (g_ResizeWidth != 0 && g_ResizeHeight != 0)
@@ -403,6 +414,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
             CreateRenderTarget();
         }
         
+        // Время подготовки кадра без ожидания VSync (для бенчмарка размещения потоков)
+        auto frameStart = std::chrono::steady_clock::now();
+        
         // Start the Dear ImGui frame
         ImGui_ImplDX11_NewFrame();
         ImGui_ImplWin32_NewFrame();
@@ -417,6 +431,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
         g_pd3dDeviceContext->OMSetRenderTargets(1, &g_mainRenderTargetView, nullptr);
         g_pd3dDeviceContext->ClearRenderTargetView(g_mainRenderTargetView, clear_color);
         ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+        ThreadPlacement::RecordFrame((uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - frameStart).count());
         
         // Present
         HRESULT hr = g_pSwapChain->Present(1, 0); // VSync
@@ -0,0 +1,69 @@
+#include "Test.h"
+#include "HttpClient.h"
+#include <string>
+
+namespace {
+    // Ответ целиком одной порцией; true - тело принято, false - ответ ошибочный
+    bool Read(Http::ResponseReader& reader, const std::string& response) {
+        reader.Reset();
+        reader.Feed(response.data(), response.size());
+        return reader.IsDone() && !reader.IsError();
+    }
+
+    std::string Chunked(const std::string& chunks) {
+        return "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n" + chunks;
+    }
+}
+
+TEST(ResponseReaderChunked) {
+    Http::ResponseReader reader;
+    REQUIRE(Read(reader, Chunked("3\r\nabc\r\nA;ext=1\r\n0123456789\r\n0\r\n\r\n")));
+    CHECK(reader.GetResponse().body.Str() == "abc0123456789");
+    CHECK(Read(reader, Chunked("4 \r\nabcd\r\n0\r\n\r\n")));
+}
+
+TEST(ResponseReaderRejectsChunkSize) {
+    Http::ResponseReader reader;
+    const char* const BROKEN[] = {
+        "\r\n",                           // Нет цифр
+        ";ext\r\n",
+        "-1\r\nabc\r\n0\r\n\r\n",         // strtoull принял бы и знак
+        "0x3\r\nabc\r\n0\r\n\r\n",
+        "3g\r\nabc\r\n0\r\n\r\n",
+        "FFFFFFFFFFFFFFFFFFFF\r\n",       // Переполнение size_t
+        "10000001\r\n",                   // Больше MAX_CONTENT_LENGTH
+        "2\r\nabc\r\n0\r\n\r\n",          // Данные длиннее объявленного размера
+    };
+    for (const char* chunks : BROKEN) {
+        if (Read(reader, Chunked(chunks)) || !reader.IsError()) FAIL("accepted chunk line %s", chunks);
+    }
+}
+
+TEST(ResponseReaderBodyLimit) {
+    Http::ResponseReader reader;
+    const size_t limit = Http::ResponseReader::MAX_CONTENT_LENGTH;
+
+    // Чанки по отдельности в пределе, вместе - больше
+    std::string header = Chunked("");
+    reader.Feed(header.data(), header.size());
+    std::string block(1024 * 1024, 'x');
+    char size[32];
+    std::snprintf(size, sizeof(size), "%zx\r\n", block.size());
+    for (size_t total = 0; total <= limit && !reader.IsError(); total += block.size()) {
+        std::string chunk = size + block + "\r\n";
+        reader.Feed(chunk.data(), chunk.size());
+    }
+    CHECK(reader.IsError());
+
+    // Тело до закрытия соединения
+    reader.Reset();
+    header = "HTTP/1.1 200 OK\r\n\r\n";
+    reader.Feed(header.data(), header.size());
+    for (size_t total = 0; total <= limit && !reader.IsError(); total += block.size()) {
+        reader.Feed(block.data(), block.size());
+    }
+    CHECK(reader.IsError());
+
+    CHECK(!Read(reader, "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(limit + 1) + "\r\n\r\n"));
+    CHECK(reader.IsError());
+}
@@ -0,0 +1,277 @@
+#include "Test.h"
+#include "Samples.h"
+#include "JsonIndex.h"
+#include "JsonParser.h"
+#include "JsonReader.h"
+#include "JsonWriter.h"
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::string_literals;
+
+namespace {
+    // Корпус соответствия: что Document обязан принять (и как это записывается обратно компактно)
+    // и что обязан отвергнуть. Строки - std::string, чтобы внутри мог быть '\0'
+    struct AcceptCase {
+        std::string json;
+        std::string compact; // Ожидаемый Writer::Style::Compact; пусто - совпадает с json
+    };
+
+    const AcceptCase ACCEPT[] = {
+        { "[]", "" },
+        { "{}", "" },
+        { "[[]]", "" },
+        { " \t\r\n[ ]\n", "[]" },
+        { "0", "" },
+        { "-0", "" },
+        { "123", "" },
+        { "-123", "" },
+        { "1.5", "" },
+        { "-1.5e1", "-15" },
+        { "1E+2", "100" },
+        { "1e-2", "0.01" },
+        { "0.0", "0" },
+        { "123456789012345678", "123456789012345680" },
+        { "1e-400", "0" },
+        { "true", "" },
+        { "false", "" },
+        { "null", "" },
+        { "\"\"", "" },
+        { "\"abc\"", "" },
+        { "\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"", "\"\\\"\\\\/\\b\\f\\n\\r\\t\"" },
+        { "\"\\u0041\\u00e9\"", "\"A\xC3\xA9\"" },
+        { "\"\\uD83D\\uDE00\"", "\"\xF0\x9F\x98\x80\"" },
+        { "\"\\u0000\"", "\"\\u0000\"" },
+        { "\"\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82\"", "" },
+        { "\"\\\\\"", "" },
+        { "[\"a\\\\\",\"b\"]", "" },
+        { "{\"a\":1,\"b\":[true,false,null],\"c\":{\"d\":\"e\"}}", "" },
+        { "{ \"a\" : 1 , \"b\" : [ ] }", "{\"a\":1,\"b\":[]}" },
+        { "{\"\":0}", "" },
+        { "{\"a\":1,\"a\":2}", "" },
+        { "[1,[2,[3,[4]]]]", "" },
+        { "[-0.5,1e3,2E-3]", "[-0.5,1000,0.002]" },
+        { "[\"{}[]:,\"]", "" },
+    };
+
+    const std::string REJECT[] = {
+        "",
+        " ",
+        "[",
+        "]",
+        "{",
+        "}",
+        "[1,]",
+        "[,1]",
+        "[1,,2]",
+        "[1 2]",
+        "{\"a\"}",
+        "{\"a\":}",
+        "{\"a\" 1}",
+        "{a:1}",
+        "{\"a\":1,}",
+        "{,}",
+        "{\"a\":1}}",
+        "[1]]",
+        "[1]x",
+        "[1][2]",
+        "[01]",
+        "[-]",
+        "[1.]",
+        "[.5]",
+        "[1e]",
+        "[1e+]",
+        "[+1]",
+        "[0x10]",
+        "[NaN]",
+        "[Infinity]",
+        "[tru]",
+        "[nul]",
+        "[True]",
+        "[truex]",
+        "['a']",
+        "\"abc",
+        "[\"abc]",
+        "[\"a\\\"]",
+        "[1\0]"s,
+        "{\"a\":1 \"b\":2}",
+        "[1:2]",
+        "{\"a\",\"b\"}",
+        "[\"\\e\"]",
+        "[\"\\-\"]",
+        "[\"\\x41\"]",
+        "[\"\\U0041\"]",
+        "[\"\\u438\"]",
+        "[\"\\u12G4\"]",
+        "\"\\u12\"",
+        "{\"\\q\":1}",
+    };
+
+    // Эталон первого прохода побайтно: '\' экранирует следующий байт в любом месте,
+    // кавычки без экранирования переключают строку; в индекс - структурные символы вне строк,
+    // обе кавычки строки и начало каждого другого участка вне строк
+    bool ReferenceIndex(std::string_view data, std::vector<uint32_t>& positions) {
+        positions.clear();
+        bool inString = false;
+        bool escaped = false;
+        bool inScalar = false;
+        for (size_t i = 0; i < data.size(); i++) {
+            char c = data[i];
+            bool wasEscaped = escaped;
+            escaped = !wasEscaped && c == '\\';
+
+            if (c == '"') {
+                inScalar = false;
+                if (wasEscaped) continue;
+                positions.push_back((uint32_t)i);
+                inString = !inString;
+                continue;
+            }
+            if (inString) continue;
+
+            bool whitespace = c == ' ' || c == '\t' || c == '\n' || c == '\r';
+            bool structural = c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',';
+            if (structural) positions.push_back((uint32_t)i);
+            if (whitespace || structural) {
+                inScalar = false;
+            } else if (!inScalar) {
+                positions.push_back((uint32_t)i);
+                inScalar = true;
+            }
+        }
+        return !inString;
+    }
+
+    std::vector<uint32_t> Positions(const Json::StructuralIndex& index) {
+        return std::vector<uint32_t>(index.Positions(), index.Positions() + index.Count());
+    }
+
+    // Векторный проход, скалярный и эталон дают одни и те же позиции
+    bool IndexesAgree(std::string_view data) {
+        Json::StructuralIndex vector;
+        Json::StructuralIndex scalar;
+        std::vector<uint32_t> reference;
+        bool vectorOk = vector.Build(data.data(), data.size());
+        bool scalarOk = scalar.BuildScalar(data.data(), data.size());
+        bool referenceOk = ReferenceIndex(data, reference);
+        return vectorOk == referenceOk && scalarOk == referenceOk
+            && Positions(vector) == reference && Positions(scalar) == reference;
+    }
+}
+
+TEST(JsonCorpusAccept) {
+    Json::Document document;
+    for (const AcceptCase& item : ACCEPT) {
+        if (!document.Parse(item.json)) {
+            FAIL("rejected %s: %s", item.json.c_str(), document.GetError().c_str());
+            continue;
+        }
+        const std::string& expected = item.compact.empty() ? item.json : item.compact;
+        std::string compact = Json::ToString(document.Root(), Json::Writer::Style::Compact);
+        if (compact != expected) FAIL("%s written as %s, expected %s", item.json.c_str(), compact.c_str(), expected.c_str());
+
+        // Без копирования строк - тот же результат
+        if (!document.ParseBorrowed(item.json)) {
+            FAIL("ParseBorrowed rejected %s", item.json.c_str());
+            continue;
+        }
+        compact = Json::ToString(document.Root(), Json::Writer::Style::Compact);
+        if (compact != expected) FAIL("borrowed %s written as %s", item.json.c_str(), compact.c_str());
+    }
+}
+
+TEST(JsonCorpusReject) {
+    Json::Document document;
+    for (const std::string& json : REJECT) {
+        if (document.Parse(json)) FAIL("accepted %s", json.c_str());
+        else if (document.GetError().empty()) FAIL("no error for %s", json.c_str());
+        if (document.ParseBorrowed(json)) FAIL("ParseBorrowed accepted %s", json.c_str());
+    }
+}
+
+TEST(JsonInvalidEscapeOffset) {
+    // Позиция в сообщении - '\' неверной последовательности, как у других синтаксических ошибок
+    const std::string json = "[1,\"ab\\e\"]";
+    Json::Document document;
+    CHECK(!document.Parse(json));
+    CHECK(document.GetError() == "Invalid escape at offset 6");
+    CHECK(!document.ParseBorrowed(json));
+    CHECK(document.GetError() == "Invalid escape at offset 6");
+
+    Json::Reader reader;
+    REQUIRE(reader.Reset(json) && reader.EnterArray() && reader.NextItem());
+    CHECK(reader.ReadNumber() == 1.0);
+    REQUIRE(reader.NextItem());
+    CHECK(reader.ReadStringView().empty());
+    CHECK(reader.GetError() == "Invalid escape at offset 6");
+
+    CHECK(Json::FindInvalidEscape("a\\u0041\\n", 9) == 9);
+    CHECK(Json::FindInvalidEscape("a\\u041", 6) == 1);
+    CHECK(Json::FindInvalidEscape("ab\\", 3) == 2);
+}
+
+TEST(JsonCorpusDepth) {
+    Json::Document document;
+    std::string deep = std::string(Json::Document::MAX_DEPTH, '[') + std::string(Json::Document::MAX_DEPTH, ']');
+    CHECK(document.Parse(deep));
+    std::string tooDeep = "[" + deep + "]";
+    CHECK(!document.Parse(tooDeep));
+}
+
+TEST(JsonSamplesParse) {
+    Json::Document document;
+    for (const Samples::Sample& sample : Samples::ALL) {
+        if (!document.Parse(sample.json.data(), sample.json.size())) {
+            FAIL("%s: %s", sample.url, document.GetError().c_str());
+            continue;
+        }
+        // Разбор записанного текста даёт тот же текст
+        std::string compact = Json::ToString(document.Root(), Json::Writer::Style::Compact);
+        Json::Document again;
+        CHECK(again.Parse(compact));
+        CHECK(Json::ToString(again.Root(), Json::Writer::Style::Compact) == compact);
+    }
+}
+
+TEST(JsonIndexScalarMatchesVector) {
+    for (const AcceptCase& item : ACCEPT) {
+        if (!IndexesAgree(item.json)) FAIL("index differs on %s", item.json.c_str());
+    }
+    for (const std::string& json : REJECT) {
+        if (!IndexesAgree(json)) FAIL("index differs on %s", json.c_str());
+    }
+    for (const Samples::Sample& sample : Samples::ALL) {
+        if (!IndexesAgree(sample.json)) FAIL("index differs on %s", sample.url);
+    }
+}
+
+TEST(JsonIndexRandomInput) {
+    // Случайные тексты из символов, важных первому проходу: серии '\' и кавычки на границах 64-байтных блоков,
+    // многобайтный UTF-8, управляющие символы
+    static const char ALPHABET[] = "\"\"\\\\\\{}[]:,  \t\n\rab1-.e\xD0\xBF\x01";
+    std::mt19937 random(14);
+    std::string text;
+    for (int iteration = 0; iteration < 20000; iteration++) {
+        size_t size = random() % 300;
+        text.clear();
+        for (size_t i = 0; i < size; i++) {
+            text += ALPHABET[random() % (sizeof(ALPHABET) - 1)];
+        }
+        if (!IndexesAgree(text)) {
+            FAIL("index differs on random input %d (%zu bytes)", iteration, size);
+            return;
+        }
+    }
+}
+
+TEST(JsonIndexEscapesAtBlockBoundary) {
+    // Серия '\' любой длины, заканчивающаяся на каждом байте вокруг границы блока
+    for (size_t end = 50; end < 140; end++) {
+        for (size_t run = 1; run <= 5; run++) {
+            std::string text = "[\"" + std::string(end - run - 2, 'x') + std::string(run, '\\') + "\"\"]";
+            if (!IndexesAgree(text)) FAIL("index differs: %zu backslashes ending at %zu", run, end);
+        }
+    }
+}
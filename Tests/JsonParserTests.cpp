@@ -0,0 +1,184 @@
+#include "Test.h"
+#include "JsonParser.h"
+#include "BufferPool.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr size_t PRODUCERS = 4;
+    constexpr size_t CHANNELS = 4;          // Половина - документы (ParseDocumentAsync), половина - ответы целиком
+    constexpr uint32_t POSTS_PER_CHANNEL = 5000;
+    constexpr uint32_t SENTINEL = 0xFFFFFFFFu; // Последний ответ канала после всех производителей
+
+    // Состояние канала со стороны обработчика: каналы разбираются по одному потоку за раз,
+    // поэтому lastSeq пишется без блокировки; busy ловит параллельный разбор одного канала
+    struct ChannelState {
+        std::atomic<bool> busy{false};
+        std::atomic<bool> overlapped{false};
+        std::atomic<bool> reordered{false};
+        std::atomic<bool> sentinelSeen{false};
+        std::atomic<uint64_t> callbacks{0};
+        uint32_t lastSeq[PRODUCERS + 1] = {};
+        bool seen[PRODUCERS + 1] = {};
+    };
+
+    std::string ChannelName(size_t channel) {
+        return "stress/" + std::to_string(channel);
+    }
+
+    PooledBuffer MakePayload(BufferPool& pool, size_t producer, uint32_t seq) {
+        std::string text = "{\"producer\":" + std::to_string(producer) + ",\"seq\":" + std::to_string(seq) + "}";
+        PooledBuffer buffer = pool.Acquire(text.size());
+        buffer.Str().assign(text);
+        return buffer;
+    }
+
+    void OnPayload(ChannelState& state, size_t producer, uint32_t seq) {
+        if (state.busy.exchange(true)) state.overlapped = true;
+        // От одного производителя ответы разбираются только по возрастанию: старый не обгоняет новый
+        if (state.seen[producer] && seq <= state.lastSeq[producer]) state.reordered = true;
+        state.seen[producer] = true;
+        state.lastSeq[producer] = seq;
+        if (seq == SENTINEL) state.sentinelSeen = true;
+        state.callbacks.fetch_add(1);
+        state.busy = false;
+    }
+
+    void Post(JsonParser& parser, BufferPool& pool, ChannelState* states, size_t channel, size_t producer, uint32_t seq) {
+        ChannelState& state = states[channel];
+        PooledBuffer payload = MakePayload(pool, producer, seq);
+        if (channel % 2 == 0) {
+            parser.ParseDocumentAsync(ChannelName(channel), std::move(payload), [&state](const Json::Document& document, bool success, const std::string&) {
+                if (!success) return;
+                OnPayload(state, (size_t)document.Root()["producer"].asNumber(), (uint32_t)document.Root()["seq"].asNumber());
+            });
+        } else {
+            parser.DispatchLatestAsync(ChannelName(channel), std::move(payload), [&state](PooledBuffer payload) {
+                Json::Document document;
+                if (!document.Parse(payload.Str())) return;
+                OnPayload(state, (size_t)document.Root()["producer"].asNumber(), (uint32_t)document.Root()["seq"].asNumber());
+            });
+        }
+    }
+
+    template <typename Condition>
+    bool WaitFor(Condition condition, std::chrono::milliseconds timeout) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    // Счётчики ящиков stress/*: положено == разобрано + заменено (когда в ящиках ничего не ждёт)
+    bool Balanced(const JsonParser& parser) {
+        size_t channels = 0;
+        for (const JsonParser::ChannelStats& stats : parser.GetChannelStats()) {
+            if (stats.channel.rfind("stress/", 0) != 0) continue;
+            channels++;
+            if (stats.pending || stats.posted != stats.processed + stats.dropped) return false;
+        }
+        return channels == CHANNELS;
+    }
+}
+
+TEST(JsonParserMailboxesUnderProducers) {
+    std::shared_ptr<BufferPool> pool = BufferPool::Create();
+    ChannelState states[CHANNELS];
+    {
+        JsonParser parser(3);
+        std::vector<std::thread> producers;
+        for (size_t producer = 0; producer < PRODUCERS; producer++) {
+            producers.emplace_back([&, producer] {
+                for (uint32_t seq = 0; seq < POSTS_PER_CHANNEL; seq++) {
+                    for (size_t channel = 0; channel < CHANNELS; channel++) {
+                        Post(parser, *pool, states, channel, producer, seq);
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : producers) thread.join();
+
+        // Последний ответ каждого канала обязан дойти до обработчика, сколько бы ни было замен до него
+        for (size_t channel = 0; channel < CHANNELS; channel++) {
+            Post(parser, *pool, states, channel, PRODUCERS, SENTINEL);
+        }
+        CHECK(WaitFor([&] {
+            for (const ChannelState& state : states) {
+                if (!state.sentinelSeen) return false;
+            }
+            return true;
+        }, std::chrono::seconds(10)));
+        CHECK(WaitFor([&] { return Balanced(parser); }, std::chrono::seconds(10)));
+
+        uint64_t processed = 0;
+        uint64_t dropped = 0;
+        for (const JsonParser::ChannelStats& stats : parser.GetChannelStats()) {
+            CHECK(stats.posted == (uint64_t)POSTS_PER_CHANNEL * PRODUCERS + 1);
+            processed += stats.processed;
+            dropped += stats.dropped;
+        }
+        uint64_t callbacks = 0;
+        for (const ChannelState& state : states) callbacks += state.callbacks;
+        CHECK(processed == callbacks);
+        CHECK(dropped > 0); // Производители быстрее разбора: ящики действительно заменяли ответы
+        CHECK(parser.GetQueueSize() == 0);
+    }
+
+    for (const ChannelState& state : states) {
+        CHECK(!state.overlapped);
+        CHECK(!state.reordered);
+    }
+    // Все ответы (разобранные и заменённые) вернули буферы в пул
+    CHECK(pool->GetStats().inUse == 0);
+}
+
+TEST(JsonParserStopWhileProducing) {
+    std::shared_ptr<BufferPool> pool = BufferPool::Create();
+    ChannelState states[CHANNELS];
+    std::atomic<bool> producing{true};
+    std::atomic<uint64_t> posts{0};
+    auto parser = std::make_unique<JsonParser>(3);
+
+    std::vector<std::thread> producers;
+    for (size_t producer = 0; producer < PRODUCERS; producer++) {
+        producers.emplace_back([&, producer] {
+            for (uint32_t seq = 0; producing; seq++) {
+                Post(*parser, *pool, states, seq % CHANNELS, producer, seq);
+                posts.fetch_add(1);
+            }
+        });
+    }
+
+    CHECK(WaitFor([&] { return posts.load() > 10000; }, std::chrono::seconds(10)));
+    auto stopStart = std::chrono::steady_clock::now();
+    parser->Stop();
+    auto stopTime = std::chrono::steady_clock::now() - stopStart;
+    CHECK(stopTime < std::chrono::milliseconds(100)); // Stop не ждёт разбора
+    CHECK(!parser->IsRunning());
+
+    // Производители продолжают слать в остановленный парсер: ответы отбрасываются сразу
+    uint64_t postsAtStop = posts.load();
+    CHECK(WaitFor([&] { return posts.load() > postsAtStop + 10000; }, std::chrono::seconds(10)));
+    producing = false;
+    for (std::thread& thread : producers) thread.join();
+
+    uint64_t postedAfterStop = 0;
+    for (const JsonParser::ChannelStats& stats : parser->GetChannelStats()) postedAfterStop += stats.posted;
+    parser.reset(); // Потоки разбора завершаются, неразобранные ответы освобождаются
+
+    uint64_t callbacks = 0;
+    for (const ChannelState& state : states) {
+        CHECK(!state.overlapped);
+        CHECK(!state.reordered);
+        callbacks += state.callbacks;
+    }
+    CHECK(callbacks <= postedAfterStop);
+    CHECK(postedAfterStop < posts.load()); // Ответы после Stop не считаются положенными
+    CHECK(pool->GetStats().inUse == 0);
+}
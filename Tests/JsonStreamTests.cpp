@@ -0,0 +1,147 @@
+#include "Test.h"
+#include "Samples.h"
+#include "JsonStream.h"
+#include "Hash.h"
+#include <string>
+#include <string_view>
+
+namespace {
+    // Итог разбора: число элементов и отпечаток их текстов по порядку (без хранения самих текстов)
+    struct Result {
+        bool fed = false;
+        bool finished = false;
+        uint64_t elements = 0;
+        uint64_t fingerprint = 0;
+
+        bool operator==(const Result& other) const {
+            return fed == other.fed && finished == other.finished && elements == other.elements && fingerprint == other.fingerprint;
+        }
+    };
+
+    class Collector {
+    public:
+        Collector() {
+            m_parser.SetElementCallback([this](std::string_view element) {
+                m_hash.Update(element.data(), element.size());
+                m_hash.Update("\n", 1);
+            });
+        }
+
+        // Вход порциями по разрезам cuts (возрастающие позиции внутри json)
+        Result Run(std::string_view json, const size_t* cuts, size_t cutCount) {
+            m_parser.Reset();
+            m_hash.Reset();
+            Result result;
+            result.fed = true;
+            size_t begin = 0;
+            for (size_t i = 0; i <= cutCount; i++) {
+                size_t end = i < cutCount ? cuts[i] : json.size();
+                result.fed = m_parser.Feed(json.data() + begin, end - begin) && result.fed;
+                begin = end;
+            }
+            result.finished = m_parser.Finish();
+            result.elements = m_parser.GetElements();
+            result.fingerprint = m_hash.Digest();
+            return result;
+        }
+
+    private:
+        Json::StreamParser m_parser;
+        Hash64 m_hash;
+    };
+
+    // Кроме примеров документации - то, чего в них нет: escape-последовательности (и '\' перед кавычкой),
+    // многобайтный UTF-8, вложенные массивы, числа и литералы в конце входа, корень не массив
+    const char* const EXTRA[] = {
+        "[]",
+        " [ ] ",
+        "[1,-2.5e+3,true,false,null]",
+        "[\"a\\\"b\",\"\\\\\",\"\\u0438\\n\",\"\xD0\xBF\xD1\x80\xD0\xB8\"]",
+        "[[1,[2,[3]]],{\"a\":{\"b\":[\"]\"]}},\"}\"]",
+        "[ {\"k\" : \"v\"} , 12345 ,\"x\" ]",
+        "{\"root\":\"object\",\"items\":[1,2]}",
+        "\"just a string\"",
+        "123456",
+        "true",
+    };
+
+    // Документы, которые должны ломать структуру корня при любой нарезке
+    const char* const BROKEN[] = {
+        "[1 2]",
+        "[1,,2]",
+        "[,1]",
+        "[1]]",
+        "[1] x",
+        "[",
+        "[\"unterminated",
+    };
+
+    // Каждая позиция разреза на две порции; для коротких входов - ещё и каждая пара разрезов на три порции
+    void CheckEverySplit(std::string_view json, const char* name, bool expectValid) {
+        Collector collector;
+        Result whole = collector.Run(json, nullptr, 0);
+        if ((whole.fed && whole.finished) != expectValid) {
+            FAIL("%s: whole input %s", name, expectValid ? "rejected" : "accepted");
+            return;
+        }
+
+        for (size_t cut = 0; cut <= json.size(); cut++) {
+            Result split = collector.Run(json, &cut, 1);
+            if (!(split == whole)) {
+                FAIL("%s: split at %zu gives %llu elements, whole input %llu", name, cut,
+                    (unsigned long long)split.elements, (unsigned long long)whole.elements);
+                return;
+            }
+        }
+
+        if (json.size() > 256) return;
+        for (size_t first = 0; first <= json.size(); first++) {
+            for (size_t second = first; second <= json.size(); second++) {
+                size_t cuts[2] = { first, second };
+                if (!(collector.Run(json, cuts, 2) == whole)) {
+                    FAIL("%s: splits at %zu and %zu differ from whole input", name, first, second);
+                    return;
+                }
+            }
+        }
+    }
+}
+
+TEST(StreamParserSamplesEverySplit) {
+    for (const Samples::Sample& sample : Samples::ALL) {
+        CheckEverySplit(sample.json, sample.url, true);
+    }
+}
+
+TEST(StreamParserExtraEverySplit) {
+    for (const char* json : EXTRA) {
+        CheckEverySplit(json, json, true);
+    }
+}
+
+TEST(StreamParserBrokenEverySplit) {
+    for (const char* json : BROKEN) {
+        CheckEverySplit(json, json, false);
+    }
+}
+
+TEST(StreamParserByteAtATime) {
+    // Порции по одному байту: элементы те же, что у целого входа, и по тексту
+    const Samples::Sample* sample = Samples::Find("/map_obj.json");
+    REQUIRE(sample);
+    std::string whole;
+    std::string bytewise;
+    Json::StreamParser parser;
+    parser.SetElementCallback([&whole](std::string_view element) { whole.append(element).append("\n"); });
+    REQUIRE(parser.Feed(sample->json.data(), sample->json.size()));
+    REQUIRE(parser.Finish());
+
+    parser.Reset();
+    parser.SetElementCallback([&bytewise](std::string_view element) { bytewise.append(element).append("\n"); });
+    for (char c : sample->json) {
+        REQUIRE(parser.Feed(&c, 1));
+    }
+    REQUIRE(parser.Finish());
+    CHECK(parser.GetElements() > 1);
+    CHECK(bytewise == whole);
+}
@@ -0,0 +1,46 @@
+// Сгенерировано tools/generate_schema.py из vendor/WarThunder-localhost-documentation-master/*/*.md - не править вручную
+
+#include "Samples.h"
+
+namespace Samples {
+    namespace {
+        constexpr char GAMECHAT[] =
+            "[\n\t{\n\t\t\"id\": 70,\n\t\t\"msg\": \"hahaha\",\n\t\t\"sender\": \"pecusgaming\",\n\t\t\"enemy\": false,\n\t\t\"mode\": \"All\"\n\t},\n\t{\n\t\t\"id\": 71,\n\t\t\"msg\": \"this thing is slightly op tbh\",\n\t\t\"sender\": \"pecusgaming\",\n\t\t\"enemy\": false,\n\t\t\"mode\": \"All\"\n\t}\n]";
+        constexpr char HUDMSG[] =
+            "{\n\t\"events\": [],\n\t\"damage\": [\n\t\t{\n\t\t\t\"id\": 161,\n\t\t\t\"msg\": \"percusiones1r (Spitfire) set afire *shino_rs (Spitfire)\",\n\t\t\t\"sender\": \"\",\n\t\t\t\"enemy\": false,\n\t\t\t\"mode\": \"\"\n\t\t},\n\t\t{\n\t\t\t\"id\": 162,\n\t\t\t\"msg\": \"*shino_rs (Spitfire) has crashed.\",\n\t\t\t\"sender\": \"\",\n\t\t\t\"enemy\": false,\n\t\t\t\"mode\": \"\"\n\t\t}\n\t]\n}";
+        constexpr char INDICATORS[] =
+            "{\n\t\"valid\": true,\n\t\"type\": \"so_4050_vautour_2a_iaf\",\n\t\"speed\": 0.0,\n\t\"pedals\": 0.0,\n\t\"pedals1\": 0.0,\n\t\"pedals2\": 0.0,\n\t\"pedals3\": 0.0,\n\t\"stick_elevator\": 0.0,\n\t\"stick_elevator1\": 0.0,\n\t\"stick_ailerons\": -0.0,\n\t\"vario\": 0.0,\n\t\"altitude_hour\": 63.055698,\n\t\"altitude_min\": 63.055698,\n\t\"altitude_10k\": 63.055698,\n\t\"aviahorizon_roll\": -0.083683,\n\t\"aviahorizon_pitch\": -4.278834,\n\t\"bank\": 0.083683,\n\t\"turn\": 0.0,\n\t\"compass\": 355.831299,\n\t\"compass1\": 355.831299,\n\t\"compass2\": 355.831299,\n\t\"clock_hour\": 9.166667,\n\t\"clock_min\": 10.0,\n\t\"clock_sec\": 13.0,\n\t\"rpm_min\": 897.0,\n\t\"rpm1_min\": 915.0,\n\t\"rpm_hour\": 2897.420898,\n\t\"rpm1_hour\": 2915.319092,\n\t\"oil_pressure\": 51.979767,\n\t\"oil_pressure1\": 52.032928,\n\t\"head_temperature\": 529.008423,\n\t\"head_temperature1\": 529.614746,\n\t\"fuel\": 3182.0,\n\t\"fuel1\": 3182.0,\n\t\"fuel_pressure\": 0.0,\n\t\"fuel_pressure1\": 0.0,\n\t\"airbrake_lever\": 0.0,\n\t\"airbrake_indicator\": 0.0,\n\t\"gears\": 0.5,\n\t\"gears1\": 0.5,\n\t\"gears_lamp\": 0.0,\n\t\"flaps\": 0.0,\n\t\"flaps1\": 0.0,\n\t\"throttle\": 0.0,\n\t\"throttle1\": 0.0,\n\t\"weapon2\": 0.0,\n\t\"weapon3\": 0.0,\n\t\"mach\": 0.0,\n\t\"g_meter\": 0.919596,\n\t\"g_meter_min\": 0.075778,\n\t\"g_meter_max\": 43.741905,\n\t\"blister1\": 1.0,\n\t\"blister2\": 1.0,\n\t\"blister3\": 1.0,\n\t\"blister4\": 1.0,\n\t\"blister5\": 1.0,\n\t\"blister6\": 1.0,\n\t\"blister7\": 1.0\n}";
+        constexpr char MAPOBJECTS[] =
+            "[\n\t{\n\t\t\"type\": \"airfield\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"none\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"sx\": 0.511711,\n\t\t\"sy\": 0.679166,\n\t\t\"ex\": 0.508293,\n\t\t\"ey\": 0.653914\n\t},\n\t{\n\t\t\"type\": \"airfield\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"none\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"sx\": 0.491362,\n\t\t\"sy\": 0.316519,\n\t\t\"ex\": 0.492964,\n\t\t\"ey\": 0.34195\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.535131,\n\t\t\"y\": 0.489011,\n\t\t\"dx\": -0.888831,\n\t\t\"dy\": -0.458235\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.536331,\n\t\t\"y\": 0.491303,\n\t\t\"dx\": -0.92912,\n\t\t\"dy\": -0.369779\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.533449,\n\t\t\"y\": 0.497469,\n\t\t\"dx\": -0.943204,\n\t\t\"dy\": -0.332214\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.533528,\n\t\t\"y\": 0.489605,\n\t\t\"dx\": -0.931145,\n\t\t\"dy\": -0.36465\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.538263,\n\t\t\"y\": 0.485532,\n\t\t\"dx\": -0.940439,\n\t\t\"dy\": -0.339962\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.532689,\n\t\t\"y\": 0.501428,\n\t\t\"dx\": -0.954651,\n\t\t\"dy\": -0.297726\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.538706,\n\t\t\"y\": 0.484404,\n\t\t\"dx\": -0.855865,\n\t\t\"dy\": -0.517199\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.540036,\n\t\t\"y\": 0.491065,\n\t\t\"dx\": -0.916857,\n\t\t\"dy\": -0.399216\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.53516,\n\t\t\"y\": 0.479163,\n\t\t\"dx\": -0.750457,\n\t\t\"dy\": -0.660919\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.536626,\n\t\t\"y\": 0.49971,\n\t\t\"dx\": -0.947473,\n\t\t\"dy\": -0.319835\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.460245,\n\t\t\"y\": 0.501279,\n\t\t\"dx\": 0.720985,\n\t\t\"dy\": 0.69295\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.463398,\n\t\t\"y\": 0.494143,\n\t\t\"dx\": 0.787867,\n\t\t\"dy\": 0.615846\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.457604,\n\t\t\"y\": 0.502833,\n\t\t\"dx\": 0.743692,\n\t\t\"dy\": 0.668522\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.458832,\n\t\t\"y\": 0.500498,\n\t\t\"dx\": 0.759916,\n\t\t\"dy\": 0.650022\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.460936,\n\t\t\"y\": 0.493616,\n\t\t\"dx\": 0.804292,\n\t\t\"dy\": 0.594235\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.471355,\n\t\t\"y\": 0.484262,\n\t\t\"dx\": 0.863713,\n\t\t\"dy\": 0.503983\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n"
+            "\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.462614,\n\t\t\"y\": 0.494151,\n\t\t\"dx\": 0.793931,\n\t\t\"dy\": 0.608008\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.455471,\n\t\t\"y\": 0.501529,\n\t\t\"dx\": 0.765325,\n\t\t\"dy\": 0.643644\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.465296,\n\t\t\"y\": 0.48997,\n\t\t\"dx\": 0.819215,\n\t\t\"dy\": 0.573487\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.459296,\n\t\t\"y\": 0.495469,\n\t\t\"dx\": 0.783994,\n\t\t\"dy\": 0.620768\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.4538,\n\t\t\"y\": 0.501141,\n\t\t\"dx\": 0.763969,\n\t\t\"dy\": 0.645253\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.460232,\n\t\t\"y\": 0.493069,\n\t\t\"dx\": 0.814946,\n\t\t\"dy\": 0.579537\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.529542,\n\t\t\"y\": 0.529253,\n\t\t\"dx\": 0.974783,\n\t\t\"dy\": 0.223156\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#24D921\",\n\t\t\"color[]\": [\n\t\t\t36,\n\t\t\t217,\n\t\t\t33\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Player\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.347845,\n\t\t\"y\": 0.590858,\n\t\t\"dx\": -0.939718,\n\t\t\"dy\": -0.34195\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.456552,\n\t\t\"y\": 0.459456,\n\t\t\"dx\": 0.910576,\n\t\t\"dy\": 0.413341\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.424389,\n\t\t\"y\": 0.46869,\n\t\t\"dx\": -0.051207,\n\t\t\"dy\": -0.998688\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#24D921\",\n\t\t\"color[]\": [\n\t\t\t36,\n\t\t\t217,\n\t\t\t33\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.461967,\n\t\t\"y\": 0.466274,\n\t\t\"dx\": -0.593581,\n\t\t\"dy\": -0.804774\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.436091,\n\t\t\"y\": 0.396236,\n\t\t\"dx\": 0.844801,\n\t\t\"dy\": -0.535081\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.48875,\n\t\t\"y\": 0.480384,\n\t\t\"dx\": -0.774395,\n\t\t\"dy\": 0.632702\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.479127,\n\t\t\"y\": 0.481116,\n\t\t\"dx\": -0.393706,\n\t\t\"dy\": -0.919237\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.412599,\n\t\t\"y\": 0.427941,\n\t\t\"dx\": -0.640105,\n\t\t\"dy\": 0.768288\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.456445,\n\t\t\"y\": 0.499996,\n\t\t\"dx\": -0.326926,\n\t\t\"dy\": -0.94505\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.511548,\n\t\t\"y\": 0.502258,\n\t\t\"dx\": -0.588973,\n\t\t\"dy\": -0.808153\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.405526,\n\t\t\"y\": 0.479363,\n\t\t\"dx\": -0.574781,\n\t\t\"dy\": -0.818308\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.543054,\n\t\t\"y\": 0.486553,\n\t\t\"dx\": -0.9"
+            "15341,\n\t\t\"dy\": -0.402679\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.54393,\n\t\t\"y\": 0.502175,\n\t\t\"dx\": -0.941082,\n\t\t\"dy\": -0.338177\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.49722,\n\t\t\"y\": 0.491311,\n\t\t\"dx\": -0.35717,\n\t\t\"dy\": 0.934039\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.389838,\n\t\t\"y\": 0.43455,\n\t\t\"dx\": -0.863712,\n\t\t\"dy\": -0.503986\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.475307,\n\t\t\"y\": 0.482161,\n\t\t\"dx\": -0.181349,\n\t\t\"dy\": 0.983419\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.402661,\n\t\t\"y\": 0.417556,\n\t\t\"dx\": -0.768329,\n\t\t\"dy\": 0.640055\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.519623,\n\t\t\"y\": 0.534389,\n\t\t\"dx\": 0.895701,\n\t\t\"dy\": -0.444656\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.520059,\n\t\t\"y\": 0.525212,\n\t\t\"dx\": -0.82403,\n\t\t\"dy\": 0.566547\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Assault\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.50707,\n\t\t\"y\": 0.496506,\n\t\t\"dx\": 0.609693,\n\t\t\"dy\": 0.792638\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.479892,\n\t\t\"y\": 0.564186,\n\t\t\"dx\": -0.248289,\n\t\t\"dy\": -0.968686\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.483377,\n\t\t\"y\": 0.466587,\n\t\t\"dx\": -0.287307,\n\t\t\"dy\": 0.957839\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.481083,\n\t\t\"y\": 0.457683,\n\t\t\"dx\": -0.917524,\n\t\t\"dy\": 0.397682\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.498311,\n\t\t\"y\": 0.559228,\n\t\t\"dx\": -0.217574,\n\t\t\"dy\": -0.976044\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.51855,\n\t\t\"y\": 0.536206,\n\t\t\"dx\": 0.580185,\n\t\t\"dy\": -0.814485\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.502116,\n\t\t\"y\": 0.575078,\n\t\t\"dx\": 0.023329,\n\t\t\"dy\": -0.999728\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.500103,\n\t\t\"y\": 0.634676,\n\t\t\"dx\": 0.04707,\n\t\t\"dy\": -0.998892\n\t},\n\t{\n\t\t\"type\": \"aircraft\",\n\t\t\"color\": \"#145CFF\",\n\t\t\"color[]\": [\n\t\t\t20,\n\t\t\t92,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.499884,\n\t\t\"y\": 0.588305,\n\t\t\"dx\": -0.018434,\n\t\t\"dy\": -0.99983\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.472717,\n\t\t\"y\": 0.481426\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.471689,\n\t\t\"y\": 0.482305\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"ic"
+            "on_bg\": \"none\",\n\t\t\"x\": 0.473983,\n\t\t\"y\": 0.480976\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.471588,\n\t\t\"y\": 0.481391\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.473734,\n\t\t\"y\": 0.480335\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.521665,\n\t\t\"y\": 0.473948\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.52097,\n\t\t\"y\": 0.473514\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.522814,\n\t\t\"y\": 0.474704\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.519762,\n\t\t\"y\": 0.47249\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.522441,\n\t\t\"y\": 0.473305\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.520382,\n\t\t\"y\": 0.47363\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.522528,\n\t\t\"y\": 0.4737\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.500138,\n\t\t\"y\": 0.538097\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.533624,\n\t\t\"y\": 0.520275\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.531297,\n\t\t\"y\": 0.476932\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.499581,\n\t\t\"y\": 0.459823\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.463985,\n\t\t\"y\": 0.479311\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.497594,\n\t\t\"y\": 0.475134\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.496622,\n\t\t\"y\": 0.474872\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.497853,\n\t\t\"y\": 0.472884\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.494673,\n\t\t\"y\": 0.475199\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.497141,\n\t\t\"y\": 0.473307\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.496642,\n\t\t\"y\": 0.475713\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.498578,\n\t\t\"y\": 0.472251\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t24"
+            "0,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.494358,\n\t\t\"y\": 0.47455\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.473091,\n\t\t\"y\": 0.483538\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.475682,\n\t\t\"y\": 0.483553\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.475418,\n\t\t\"y\": 0.483318\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.519218,\n\t\t\"y\": 0.478347\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.51882,\n\t\t\"y\": 0.477987\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.519912,\n\t\t\"y\": 0.478738\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.520768,\n\t\t\"y\": 0.475761\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.519064,\n\t\t\"y\": 0.477471\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.52043,\n\t\t\"y\": 0.478081\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.497711,\n\t\t\"y\": 0.474337\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.496434,\n\t\t\"y\": 0.47471\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Wheeled\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.497595,\n\t\t\"y\": 0.474083\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.500124,\n\t\t\"y\": 0.538967\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.534241,\n\t\t\"y\": 0.52089\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.531926,\n\t\t\"y\": 0.476349\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.49969,\n\t\t\"y\": 0.458967\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.503429,\n\t\t\"y\": 0.648425\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.506451,\n\t\t\"y\": 0.668608\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.506843,\n\t\t\"y\": 0.68578\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.520797,\n\t\t\"y\": 0.685028\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.518712,\n\t\t\"y\": 0.66796\n\t"
+            "},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.515521,\n\t\t\"y\": 0.653629\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.497746,\n\t\t\"y\": 0.664893\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.50088,\n\t\t\"y\": 0.695685\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.519896,\n\t\t\"y\": 0.660469\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.517872,\n\t\t\"y\": 0.64378\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.478338,\n\t\t\"y\": 0.532686\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.479254,\n\t\t\"y\": 0.532779\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.477854,\n\t\t\"y\": 0.533289\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.493525,\n\t\t\"y\": 0.462784\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.49219,\n\t\t\"y\": 0.463486\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.493174,\n\t\t\"y\": 0.46314\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.49183,\n\t\t\"y\": 0.462916\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.524945,\n\t\t\"y\": 0.468107\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.524945,\n\t\t\"y\": 0.466195\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.525478,\n\t\t\"y\": 0.466438\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.524709,\n\t\t\"y\": 0.465501\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.469366,\n\t\t\"y\": 0.475009\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.468419,\n\t\t\"y\": 0.475746\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.468767,\n\t\t\"y\": 0.474847\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Tracked\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.468499,\n\t\t\"y\": 0.475254\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.514671,\n\t\t\"y\": 0.462683\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon"
+            "\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.481158,\n\t\t\"y\": 0.461869\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.532386,\n\t\t\"y\": 0.477872\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.53031,\n\t\t\"y\": 0.476298\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.515792,\n\t\t\"y\": 0.463814\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.51322,\n\t\t\"y\": 0.463393\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.501019,\n\t\t\"y\": 0.459843\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.498416,\n\t\t\"y\": 0.459962\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.482748,\n\t\t\"y\": 0.461941\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.480573,\n\t\t\"y\": 0.463375\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.464893,\n\t\t\"y\": 0.478184\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#f01E00\",\n\t\t\"color[]\": [\n\t\t\t240,\n\t\t\t30,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 1,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.463381,\n\t\t\"y\": 0.480307\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.534225,\n\t\t\"y\": 0.519272\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.53275,\n\t\t\"y\": 0.52142\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.501269,\n\t\t\"y\": 0.537802\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.498707,\n\t\t\"y\": 0.538274\n\t},\n\t{\n\t\t\"type\": \"ground_model\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"Airdefence\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.466205,\n\t\t\"y\": 0.519219\n\t},\n\t{\n\t\t\"type\": \"defending_point\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"defending_point\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.358463,\n\t\t\"y\": 0.584135\n\t},\n\t{\n\t\t\"type\": \"bombing_point\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"bombing_point\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.634161,\n\t\t\"y\": 0.393387\n\t},\n\t{\n\t\t\"type\": \"defending_point\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"defending_point\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.563007,\n\t\t\"y\": 0.600426\n\t},\n\t{\n\t\t\"type\": \"bombing_point\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"bombing_point\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.579187,\n\t\t\"y\": 0.414266\n\t},\n\t{\n\t\t\"type\": \"defending_point\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"defending_point\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.642489,\n\t\t\"y\": 0.575685\n\t},\n\t{\n\t\t\"type\": \"bombing_point\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"bombing_point\",\n\t\t\"icon_bg\": \"no"
+            "ne\",\n\t\t\"x\": 0.361541,\n\t\t\"y\": 0.418501\n\t},\n\t{\n\t\t\"type\": \"defending_point\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"defending_point\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.415718,\n\t\t\"y\": 0.606006\n\t},\n\t{\n\t\t\"type\": \"bombing_point\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"bombing_point\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.421365,\n\t\t\"y\": 0.394176\n\t},\n\t{\n\t\t\"type\": \"respawn_base_fighter\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"respawn_base_fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.500008,\n\t\t\"y\": 0.590881,\n\t\t\"dx\": 2.3e-05,\n\t\t\"dy\": -300.0\n\t},\n\t{\n\t\t\"type\": \"respawn_base_fighter\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"respawn_base_fighter\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.499986,\n\t\t\"y\": 0.407975,\n\t\t\"dx\": 2.3e-05,\n\t\t\"dy\": 300.0\n\t},\n\t{\n\t\t\"type\": \"respawn_base_bomber\",\n\t\t\"color\": \"#185AFF\",\n\t\t\"color[]\": [\n\t\t\t24,\n\t\t\t90,\n\t\t\t255\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"respawn_base_bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.499978,\n\t\t\"y\": 0.651926,\n\t\t\"dx\": 2.3e-05,\n\t\t\"dy\": -300.0\n\t},\n\t{\n\t\t\"type\": \"respawn_base_bomber\",\n\t\t\"color\": \"#fa3200\",\n\t\t\"color[]\": [\n\t\t\t250,\n\t\t\t50,\n\t\t\t0\n\t\t],\n\t\t\"blink\": 0,\n\t\t\"icon\": \"respawn_base_bomber\",\n\t\t\"icon_bg\": \"none\",\n\t\t\"x\": 0.499998,\n\t\t\"y\": 0.346863,\n\t\t\"dx\": 2.3e-05,\n\t\t\"dy\": 300.0\n\t}\n]";
+        constexpr char MAPINFO[] =
+            "{\n\t\"grid_steps\": [\n\t\t\"3250.0\",\n\t\t\"3250.0\"\n\t],\n\t\"grid_zero\": [\n\t\t\"-32768.0\",\n\t\t\"32768.0\"\n\t],\n\t\"map_generation\": \"1\",\n\t\"map_max\": [\n\t\t\"32768.0\",\n\t\t\"32768.0\"\n\t],\n\t\"map_min\": [\n\t\t\"-32768.0\",\n\t\t\"-32768.0\"\n\t]\n}";
+        constexpr char MISSION[] =
+            "{\n\t\"objectives\": [\n\t\t{\n\t\t\t\"primary\": true,\n\t\t\t\"status\": \"in_progress\",\n\t\t\t\"text\": \"Decole\"\n\t\t}\n\t],\n\t\"status\": \"running\"\n}";
+        constexpr char STATE[] =
+            "{\n\t\"valid\": true,\n\t\"aileron, %\": 0,\n\t\"elevator, %\": -20,\n\t\"rudder, %\": 0,\n\t\"flaps, %\": 0,\n\t\"H, m\": 4936,\n\t\"TAS, km/h\": 237,\n\t\"IAS, km/h\": 185,\n\t\"M\": 0.2,\n\t\"AoA, deg\": 1.1,\n\t\"AoS, deg\": -0.1,\n\t\"Ny\": 1.0,\n\t\"Vy, m/s\": 3.2,\n\t\"Wx, deg/s\": 0,\n\t\"Mfuel, kg\": 750,\n\t\"Mfuel0, kg\": 2620,\n\t\"throttle 1, %\": 100,\n\t\"mixture 1, %\": 100,\n\t\"magneto 1\": 3,\n\t\"power 1, hp\": 484.0,\n\t\"RPM 1\": 1957,\n\t\"manifold pressure 1, atm\": 0.81,\n\t\"oil temp 1, C\": 73,\n\t\"pitch 1, deg\": 28.2,\n\t\"thrust 1, kgs\": 473,\n\t\"efficiency 1, %\": 85,\n\t\"throttle 2, %\": 100,\n\t\"mixture 2, %\": 100,\n\t\"magneto 2\": 3,\n\t\"power 2, hp\": 501.2,\n\t\"RPM 2\": 2016,\n\t\"manifold pressure 2, atm\": 0.82,\n\t\"oil temp 2, C\": 75,\n\t\"pitch 2, deg\": 28.2,\n\t\"thrust 2, kgs\": 488,\n\t\"efficiency 2, %\": 84,\n\t\"throttle 3, %\": 100,\n\t\"mixture 3, %\": 100,\n\t\"magneto 3\": 3,\n\t\"power 3, hp\": 483.9,\n\t\"RPM 3\": 1957,\n\t\"manifold pressure 3, atm\": 0.81,\n\t\"oil temp 3, C\": 73,\n\t\"pitch 3, deg\": 28.2,\n\t\"thrust 3, kgs\": 473,\n\t\"efficiency 3, %\": 85\n}";
+    }
+
+    const Sample ALL[COUNT] = {
+        { "GameChat", "/gamechat", std::string_view(GAMECHAT, sizeof(GAMECHAT) - 1) },
+        { "Hudmsg", "/hudmsg", std::string_view(HUDMSG, sizeof(HUDMSG) - 1) },
+        { "Indicators", "/indicators", std::string_view(INDICATORS, sizeof(INDICATORS) - 1) },
+        { "MapObjects", "/map_obj.json", std::string_view(MAPOBJECTS, sizeof(MAPOBJECTS) - 1) },
+        { "MapInfo", "/map_info.json", std::string_view(MAPINFO, sizeof(MAPINFO) - 1) },
+        { "Mission", "/mission.json", std::string_view(MISSION, sizeof(MISSION) - 1) },
+        { "State", "/state", std::string_view(STATE, sizeof(STATE) - 1) },
+    };
+
+    const Sample* Find(std::string_view url) {
+        for (const Sample& sample : ALL) {
+            if (url == sample.url) return &sample;
+        }
+        return nullptr;
+    }
+}
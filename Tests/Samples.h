@@ -0,0 +1,21 @@
+#pragma once
+
+// Сгенерировано tools/generate_schema.py из vendor/WarThunder-localhost-documentation-master/*/*.md - не править вручную
+
+#include <string_view>
+#include <cstddef>
+
+// Примеры ответов эндпоинтов из документации (пропущенные запятые исправлены), с отступами табуляцией
+namespace Samples {
+    struct Sample {
+        const char* name; // Структура Schema корня
+        const char* url;
+        std::string_view json;
+    };
+
+    constexpr size_t COUNT = 7;
+    extern const Sample ALL[COUNT];
+
+    // Пример по URL эндпоинта ("/map_obj.json"); nullptr - нет такого
+    const Sample* Find(std::string_view url);
+}
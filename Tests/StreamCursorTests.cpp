@@ -0,0 +1,70 @@
+#include "Test.h"
+#include "StreamCursor.h"
+
+TEST(StreamCursorFollowsFeed) {
+    StreamCursor cursor;
+    CHECK(cursor.GetRequestId() == 0);
+    CHECK(cursor.Resolve(3, 1, 3) == 0);
+    CHECK(cursor.GetRequestId() == 3);
+    CHECK(cursor.Resolve(2, 4, 5) == 3);
+    CHECK(cursor.Resolve(0, 0, 0) == 5); // Пустой ответ курсор не двигает
+
+    StreamCursor::Stats stats = cursor.GetStats();
+    CHECK(stats.lastId == 5);
+    CHECK(stats.gaps == 0);
+    CHECK(stats.resets == 0);
+}
+
+TEST(StreamCursorCountsGaps) {
+    StreamCursor cursor;
+    cursor.Resolve(5, 1, 5);
+    CHECK(cursor.Resolve(2, 8, 9) == 5);
+    CHECK(cursor.GetStats().gaps == 1);
+    CHECK(cursor.GetStats().resets == 0);
+}
+
+TEST(StreamCursorResetBelowCursor) {
+    StreamCursor cursor;
+    cursor.Resolve(10, 41, 50);
+    // Новая нумерация ещё не дошла до курсора
+    CHECK(cursor.Resolve(3, 1, 3) == 0);
+    CHECK(cursor.GetStats().resets == 1);
+    CHECK(cursor.GetRequestId() == 3);
+}
+
+TEST(StreamCursorResetPastCursor) {
+    StreamCursor cursor;
+    cursor.Resolve(21, 30, 50);
+    // Игра перезапущена, новая нумерация обогнала курсор: проверочный ответ с начала ленты
+    cursor.RequestVerify();
+    CHECK(cursor.GetRequestId() == 0);
+    CHECK(cursor.Resolve(80, 1, 80) == 0);
+    CHECK(cursor.GetStats().resets == 1);
+    CHECK(cursor.GetRequestId() == 80);
+
+    // Дальше - обычное продолжение новой нумерации
+    CHECK(cursor.Resolve(2, 81, 82) == 80);
+    CHECK(cursor.GetStats().resets == 1);
+}
+
+TEST(StreamCursorVerifyWithSlidingWindow) {
+    StreamCursor cursor;
+    cursor.Resolve(10, 1, 10);
+    // Сервер отбросил старые элементы: окно сдвинулось, нумерация та же
+    cursor.RequestVerify();
+    CHECK(cursor.Resolve(10, 5, 14) == 10);
+    StreamCursor::Stats stats = cursor.GetStats();
+    CHECK(stats.resets == 0);
+    CHECK(stats.gaps == 0);
+    CHECK(stats.verifications == 1);
+    CHECK(stats.lastId == 14);
+}
+
+TEST(StreamCursorResetClearsWindow) {
+    StreamCursor cursor;
+    cursor.Resolve(10, 41, 50);
+    cursor.Reset();
+    CHECK(cursor.GetRequestId() == 0);
+    CHECK(cursor.Resolve(5, 1, 5) == 0);
+    CHECK(cursor.GetStats().resets == 0); // После Reset нумерация начинается без сравнения со старой
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdio>
+
+// Минимальный набор для тестов без сторонних библиотек
+// TEST(Name) регистрирует функцию; CHECK отмечает ошибку и продолжает тест, REQUIRE - прерывает его
+// Запуск: Tests [подстрока имени]; код возврата 1, если хотя бы одна проверка не прошла
+namespace Test {
+    using Function = void (*)();
+
+    struct Registration {
+        Registration(const char* name, Function function);
+    };
+
+    // false - проверка не прошла (сообщение уже выведено)
+    bool Check(bool passed, const char* expression, const char* file, int line);
+
+    // Ошибка с пояснением (printf-формат): номер разреза, имя примера и т.п.
+    void Fail(const char* file, int line, const char* format, ...);
+}
+
+#define TEST(name) \
+    static void name(); \
+    static Test::Registration name##Registration(#name, name); \
+    static void name()
+
+#define CHECK(expression) Test::Check((expression), #expression, __FILE__, __LINE__)
+#define REQUIRE(expression) do { if (!CHECK(expression)) return; } while (0)
+#define FAIL(...) Test::Fail(__FILE__, __LINE__, __VA_ARGS__)
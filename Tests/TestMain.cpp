@@ -0,0 +1,77 @@
+#include "Test.h"
+#include <cstdarg>
+#include <cstring>
+#include <chrono>
+#include <vector>
+
+namespace Test {
+    namespace {
+        struct Entry {
+            const char* name;
+            Function function;
+        };
+
+        // Регистрации из статических конструкторов разных единиц: вектор создаётся при первом обращении
+        std::vector<Entry>& Registry() {
+            static std::vector<Entry> entries;
+            return entries;
+        }
+
+        // Сообщений на тест: проверка в цикле по тысячам разрезов не должна заваливать вывод
+        constexpr int MAX_MESSAGES = 20;
+
+        int g_failures = 0;
+        int g_messages = 0;
+    }
+
+    Registration::Registration(const char* name, Function function) {
+        Registry().push_back(Entry{ name, function });
+    }
+
+    bool Check(bool passed, const char* expression, const char* file, int line) {
+        if (passed) return true;
+        g_failures++;
+        if (g_messages++ < MAX_MESSAGES) {
+            std::printf("  %s:%d: CHECK(%s)\n", file, line, expression);
+        }
+        return false;
+    }
+
+    void Fail(const char* file, int line, const char* format, ...) {
+        g_failures++;
+        if (g_messages++ >= MAX_MESSAGES) return;
+        std::printf("  %s:%d: ", file, line);
+        va_list args;
+        va_start(args, format);
+        std::vprintf(format, args);
+        va_end(args);
+        std::printf("\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    int run = 0;
+    int failed = 0;
+    for (const Test::Entry& entry : Test::Registry()) {
+        if (filter && !std::strstr(entry.name, filter)) continue;
+        std::printf("[ RUN  ] %s\n", entry.name);
+        std::fflush(stdout);
+
+        Test::g_failures = 0;
+        Test::g_messages = 0;
+        auto start = std::chrono::steady_clock::now();
+        entry.function();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        run++;
+        if (Test::g_failures > 0) {
+            failed++;
+            std::printf("[ FAIL ] %s (%d, %.0f ms)\n", entry.name, Test::g_failures, ms);
+        } else {
+            std::printf("[  OK  ] %s (%.0f ms)\n", entry.name, ms);
+        }
+    }
+    std::printf("%d tests, %d failed\n", run, failed);
+    return failed > 0 ? 1 : 0;
+}
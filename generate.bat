@@ -10,6 +10,23 @@ if not exist "Build" mkdir "Build"
 if not exist "Bin" mkdir "Bin"
 if not exist "Source" mkdir "Source"
 
+:: Генерация типизированных декодеров JSON (Source\Schema.h, Source\Schema.cpp) и примеров ответов для тестов (Tests\Samples.h, Tests\Samples.cpp) из документации vendor
+:: Generating typed JSON decoders (Source\Schema.h, Source\Schema.cpp) and test samples (Tests\Samples.h, Tests\Samples.cpp) from the vendor documentation
+echo Generating JSON schema decoders...
+where python >nul 2>nul
+if %ERRORLEVEL% EQU 0 (
+    python tools\generate_schema.py
+    if errorlevel 1 (
+        echo.
+        echo [ERROR] Failed to generate JSON schema decoders!
+        pause
+        exit /b 1
+    )
+) else (
+    echo [WARNING] Python not found, using committed Source\Schema.* and Tests\Samples.*
+)
+echo.
+
 :: Запуск Premake5 для генерации VS2026 solution
 :: Running Premake5 to generate a VS2026 solution
 echo Running Premake5...
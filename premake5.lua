@@ -59,6 +59,7 @@ project "WarThunderAdvanced"
         "dxgi",
         "d3dcompiler",
         "dwmapi",
+        "ws2_32",
         "wininet",
         "windowscodecs",
         "ole32"
@@ -79,3 +80,52 @@ project "WarThunderAdvanced"
         buildoptions { "/utf-8" }  -- UTF-8 кодировка для исходных файлов
         
     filter {}
+
+-- Общий код приложения без окна, UI и DirectX (JSON, HTTP, реактор, потоки): основа тестов и бенчмарков
+local coreFiles = { "Source/**.h", "Source/**.cpp" }
+local appOnlyFiles = { "Source/main.cpp", "Source/UI.h", "Source/UI.cpp", "Source/Translator.h", "Source/Translator.cpp" }
+
+-- Консольная программа на общем коде; собирается и на Linux:
+--   premake5 gmake2 && make -C Build config=main Tests Bench && Bin/Main/Tests && Bin/Main/Bench
+local function ConsoleProject(name, directory)
+    project(name)
+        location "Build"
+        kind "ConsoleApp"
+        language "C++"
+        cppdialect "C++20"
+        targetdir ("Bin/%{cfg.buildcfg}")
+        objdir ("Build/Intermediate/%{prj.name}/%{cfg.buildcfg}")
+
+        files(coreFiles)
+        removefiles(appOnlyFiles)
+        -- Примеры ответов из документации (генерирует tools/generate_schema.py)
+        files { "Tests/Samples.h", "Tests/Samples.cpp" }
+        files { directory .. "/**.h", directory .. "/**.cpp" }
+        includedirs { "Source", "Tests", directory }
+
+        filter "action:vs*"
+            toolset "v145"
+
+        filter "configurations:Main"
+            defines { "NDEBUG" }
+            symbols "On"
+            optimize "Full"
+            runtime "Release"
+
+        filter "system:windows"
+            systemversion "latest"
+            defines { "PLATFORM_WINDOWS", "_CRT_SECURE_NO_WARNINGS", "WIN32_LEAN_AND_MEAN" }
+            buildoptions { "/utf-8" }
+            links { "ws2_32" }
+
+        filter "system:linux"
+            links { "pthread" }
+
+        filter {}
+end
+
+-- Тесты (Tests [подстрока имени]; код возврата 1 при ошибках)
+ConsoleProject("Tests", "Tests")
+
+-- Бенчмарки (Bench [подстрока имени]; отчёт в stdout)
+ConsoleProject("Bench", "Bench")
@@ -0,0 +1,771 @@
+#
+# Генератор типизированных декодеров эндпоинтов localhost:8111 (Source/Schema.h, Source/Schema.cpp)
+# Схема - таблицы полей и примеры ответов из vendor/WarThunder-localhost-documentation-master/*/*.md
+# Исправленные примеры ответов - входы тестов и бенчмарков (Tests/Samples.h, Tests/Samples.cpp)
+#
+# Запуск: python tools/generate_schema.py (generate.bat вызывает его перед premake)
+#
+
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DOCS = os.path.join(ROOT, 'vendor', 'WarThunder-localhost-documentation-master')
+OUTPUT_HEADER = os.path.join(ROOT, 'Source', 'Schema.h')
+OUTPUT_SOURCE = os.path.join(ROOT, 'Source', 'Schema.cpp')
+OUTPUT_SAMPLES_HEADER = os.path.join(ROOT, 'Tests', 'Samples.h')
+OUTPUT_SAMPLES_SOURCE = os.path.join(ROOT, 'Tests', 'Samples.cpp')
+
+# Длина одного строкового литерала примера (MSVC ограничивает литерал 16 КБ, склейку - 64 КБ)
+SAMPLE_LITERAL_CHUNK = 4000
+
+# Поля "... _N_ ..." (двигатели state): номера 1..MAX_ENGINES
+MAX_ENGINES = 8
+# Ёмкость массива чисел/строк, если в примере его нет
+DEFAULT_ARRAY_CAPACITY = 4
+
+# Эндпоинты: (структура, файл документации, URL, структура элемента для корневого массива)
+ENDPOINTS = [
+    ('GameChat', 'Gamechat/GameChat.md', '/gamechat', 'GameChatMessage'),
+    ('Hudmsg', 'Hudmsg/Hudmsg.md', '/hudmsg', None),
+    ('Indicators', 'Indicators/Indicators.md', '/indicators', None),
+    ('MapObjects', 'MapObjects/MapObjects.md', '/map_obj.json', 'MapObject'),
+    ('MapInfo', 'Mapinfo/MapInfo.md', '/map_info.json', None),
+    ('Mission', 'Mission/Mission.md', '/mission.json', None),
+    ('State', 'State/State.md', '/state', None),
+]
+
+# Поправки к документации (сверено с живыми ответами)
+TYPE_OVERRIDES = {
+    # В таблице "array of string", в примере и в ответах - числа 0..255
+    ('MapObjects', 'color[]'): 'array of integer',
+    # В таблице "string", но это положение рычага, как у остальных рычагов; число читается и из строки
+    ('Indicators', 'wing_sweep_lever'): 'float',
+}
+EXTRA_FIELDS = {
+    # Нет в документации, но приходят в каждом ответе (карта загружена, тип HUD: авиа/танки)
+    'MapInfo': [('valid', 'boolean', 'map is loaded'), ('hud_type', 'integer', 'HUD type (aircraft/tanks)')],
+}
+# Имена вложенных структур: (структура, поле) -> имя
+STRUCT_NAMES = {
+    ('Mission', 'objectives'): 'MissionObjective',
+    ('Hudmsg', 'damage'): 'HudMessage',
+}
+# Массив без элементов в примере: элементы как у другого поля той же структуры
+SAME_AS = {
+    # events в примере пуст; по описанию - те же сообщения, что damage
+    ('Hudmsg', 'events'): 'damage',
+}
+
+CPP_KEYWORDS = {'bool', 'int', 'float', 'double', 'char', 'class', 'struct', 'default', 'delete', 'new', 'this',
+                'switch', 'case', 'if', 'else', 'for', 'while', 'do', 'return', 'true', 'false', 'auto', 'const'}
+
+SCALARS = {
+    'bool': ('bool', 'false', 'ReadBool', 'asBool'),
+    'int': ('int', '0', 'ReadInt', 'asInt'),
+    'float': ('float', '0.0f', 'ReadFloat', 'asFloat'),
+    'string': ('std::string_view', None, 'ReadStringView', 'asStringView'),
+}
+
+
+def fail(message):
+    print(f'generate_schema: {message}', file=sys.stderr)
+    sys.exit(1)
+
+
+def fnv1a(text):
+    value = 2166136261
+    for byte in text.encode('utf-8'):
+        value ^= byte
+        value = (value * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def identifier(key):
+    text = key.replace('_N_', ' ').replace('%', ' pct ').replace('[]', ' array ')
+    text = re.sub(r'[^0-9A-Za-z]+', '_', text).strip('_').lower()
+    if not text or text[0].isdigit() or text in CPP_KEYWORDS:
+        text = 'field_' + text
+    return text
+
+
+def cpp_string(text):
+    return '"' + text.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def cpp_comment(text):
+    text = text.replace('**', '').replace('$', '').replace('\\texttt', '').replace('\\', '')
+    text = re.sub(r'\s+', ' ', text).strip()
+    return text
+
+
+class Field:
+    def __init__(self, key, kind, description=''):
+        self.key = key
+        self.kind = kind            # bool, int, float, string, array, objects
+        self.element = None         # Тип элемента array (скаляр) или Struct для objects
+        self.capacity = 0
+        self.description = description
+        self.template = '_N_' in key
+        self.name = identifier(key)
+
+    @property
+    def prefix(self):
+        return self.key.split('_N_')[0]
+
+    @property
+    def suffix(self):
+        return self.key.split('_N_')[1]
+
+
+class Struct:
+    def __init__(self, name, description):
+        self.name = name
+        self.description = description
+        self.fields = []
+
+    def find(self, key):
+        for field in self.fields:
+            if field.key == key:
+                return field
+        return None
+
+    def templates(self):
+        return [field for field in self.fields if field.template]
+
+    def has_vectors(self):
+        return any(field.kind == 'objects' for field in self.fields)
+
+
+# ===== Разбор документации =====
+
+def read_sample(text, path):
+    match = re.search(r'```json\s*(.*?)```', text, re.S)
+    if not match:
+        return None
+    sample = match.group(1)
+    # Примеры набраны вручную: пропущенные запятые между значением и следующим ключом/элементом
+    sample = re.sub(r'([0-9"\]}el])[ \t]*\n(\s*)(["{\[])', r'\1,\n\2\3', sample)
+    sample = re.sub(r',(\s*[\]}])', r'\1', sample)
+    try:
+        return json.loads(sample)
+    except json.JSONDecodeError as error:
+        fail(f'{path}: sample is not JSON after repair: {error}')
+
+
+def read_table(text):
+    # [(отступ, ключ, тип, описание)]
+    entries = []
+    lines = text.split('\n')
+    for index, line in enumerate(lines):
+        match = re.match(r'^(\s*)- name: \*\*(.+?)\*\*', line)
+        if not match:
+            continue
+        indent = len(match.group(1))
+        key = match.group(2)
+        kind = ''
+        description = ''
+        for next_line in lines[index + 1:]:
+            if re.match(r'^\s*- name:', next_line):
+                break
+            attribute = re.match(r'^\s*[*-] (contains|type|description|descruption):\s*(.*)$', next_line)
+            if not attribute:
+                continue
+            if attribute.group(1) in ('contains', 'type'):
+                kind = attribute.group(2).strip()
+            elif not description:
+                description = attribute.group(2).strip()
+        entries.append((indent, key, kind, description))
+    return entries
+
+
+def scalar_kind(type_text):
+    text = type_text.lower()
+    if text in ('bool', 'boolean'):
+        return 'bool'
+    if text in ('int', 'integer'):
+        return 'int'
+    if text in ('float', 'decimal'):
+        return 'float'
+    if text in ('str', 'string'):
+        return 'string'
+    return None
+
+
+def sample_kind(value):
+    if isinstance(value, bool):
+        return 'bool'
+    if isinstance(value, int):
+        return 'int'
+    if isinstance(value, float):
+        return 'float'
+    if isinstance(value, str):
+        return 'string'
+    return None
+
+
+def make_field(owner, key, type_text, description, sample_value):
+    text = type_text.lower()
+    kind = scalar_kind(text)
+    if kind:
+        return Field(key, kind, description)
+    array = re.match(r'array of (\w+?)s?$', text)
+    if array:
+        field = Field(key, 'array', description)
+        field.element = scalar_kind(array.group(1))
+        if not field.element:
+            fail(f'{owner}.{key}: unknown array element type "{type_text}"')
+        field.capacity = len(sample_value) if isinstance(sample_value, list) and sample_value else DEFAULT_ARRAY_CAPACITY
+        return field
+    if 'array' in text:
+        return Field(key, 'objects', description)
+    fail(f'{owner}.{key}: unknown type "{type_text}"')
+
+
+def field_from_sample(owner, key, value):
+    kind = sample_kind(value)
+    if kind:
+        return Field(key, kind)
+    if isinstance(value, list):
+        if value and all(isinstance(item, dict) for item in value):
+            return Field(key, 'objects')
+        if value:
+            field = Field(key, 'array')
+            field.element = sample_kind(value[0])
+            field.capacity = len(value)
+            return field
+        return Field(key, 'objects')  # Пустой массив: элементы задаёт SAME_AS
+    fail(f'{owner}.{key}: cannot infer type from sample')
+
+
+def numbered_template(key):
+    # "mixture 1, %" -> "mixture _N_, %"
+    match = re.match(r'^(.* )(\d+)((?:,.*)?)$', key)
+    if not match:
+        return None
+    return match.group(1) + '_N_' + match.group(3)
+
+
+def matches_template(field, key):
+    if not field.template:
+        return False
+    pattern = re.escape(field.prefix) + r'\d+' + re.escape(field.suffix) + '$'
+    return re.match(pattern, key) is not None
+
+
+def sample_objects(sample):
+    # Объекты примера для структуры: сам объект или элементы массива
+    if isinstance(sample, dict):
+        return [sample]
+    if isinstance(sample, list):
+        return [item for item in sample if isinstance(item, dict)]
+    return []
+
+
+def build_struct(endpoint, name, description, entries, samples, structs):
+    struct = Struct(name, description)
+    # Таблица: поля этого уровня, вложенные (больший отступ) - детям последнего массива объектов
+    index = 0
+    base = entries[0][0] if entries else 0
+    while index < len(entries):
+        indent, key, type_text, field_description = entries[index]
+        children = []
+        index += 1
+        while index < len(entries) and entries[index][0] > base:
+            children.append(entries[index])
+            index += 1
+        type_text = TYPE_OVERRIDES.get((endpoint, key), type_text)
+        sample_value = next((item[key] for item in samples if key in item), None)
+        field = make_field(name, key, type_text, field_description, sample_value)
+        if field.kind == 'objects':
+            child_samples = [element for value in (item.get(key) for item in samples) if isinstance(value, list)
+                             for element in value if isinstance(element, dict)]
+            field.element = build_struct(endpoint, STRUCT_NAMES.get((endpoint, key), name + identifier(key).title().replace('_', '')),
+                                         f'Элемент {name}.{key}', children, child_samples, structs)
+        struct.fields.append(field)
+
+    for key, type_text, field_description in EXTRA_FIELDS.get(name, []):
+        struct.fields.append(make_field(name, key, type_text, field_description, None))
+
+    # Поля примера, которых нет в таблице
+    for item in samples:
+        for key, value in item.items():
+            if struct.find(key) or any(matches_template(field, key) for field in struct.fields):
+                continue
+            template = numbered_template(key)
+            if template:
+                if struct.find(template):
+                    continue
+                field = field_from_sample(name, template, value)
+            else:
+                field = field_from_sample(name, key, value)
+            if field.kind == 'objects' and (endpoint, key) not in SAME_AS:
+                child_samples = [element for element in value if isinstance(element, dict)]
+                field.element = build_struct(endpoint, STRUCT_NAMES.get((endpoint, key), name + identifier(key).title().replace('_', '')),
+                                             f'Элемент {name}.{key}', [], child_samples, structs)
+            struct.fields.append(field)
+
+    for field in struct.fields:
+        same = SAME_AS.get((endpoint, field.key))
+        if same:
+            field.element = struct.find(same).element
+
+    names = [field.name for field in struct.fields]
+    duplicates = {name for name in names if names.count(name) > 1}
+    if duplicates:
+        fail(f'{name}: duplicate member names {sorted(duplicates)}')
+    if struct.templates():
+        for field in struct.templates():
+            if field.kind not in SCALARS:
+                fail(f'{name}.{field.key}: numbered fields must be scalars')
+    structs.append(struct)
+    return struct
+
+
+def load_endpoints():
+    structs = []
+    roots = []
+    samples = []
+    for name, path, url, element in ENDPOINTS:
+        full_path = os.path.join(DOCS, path)
+        with open(full_path, encoding='utf-8') as file:
+            text = file.read()
+        sample = read_sample(text, path)
+        title = re.search(r'^- (.+)$', text, re.M)
+        where = f'{url}, элемент корневого массива' if element else url
+        description = f'{where}: {title.group(1).strip()}' if title else where
+        entries = read_table(text)
+        struct = build_struct(name, element or name, description, entries, sample_objects(sample), structs)
+        roots.append((name, url, struct, element is not None))
+        samples.append((name, url, sample))
+    return structs, roots, samples
+
+
+# ===== Вывод =====
+
+def member_comment(field):
+    # Ключ ответа, если он не совпадает с именем члена, и описание из документации
+    parts = []
+    if field.template or field.name != field.key:
+        parts.append(f'"{field.key}"')
+    if field.description:
+        parts.append(cpp_comment(field.description))
+    return f' // {": ".join(parts)}' if parts else ''
+
+
+def member_declaration(field):
+    comment = member_comment(field)
+    if field.kind in SCALARS:
+        cpp_type, default, _, _ = SCALARS[field.kind]
+        if field.template:
+            return f'{cpp_type} {field.name}[MAX_ENGINES] = {{}};{comment}'
+        value = f' = {default}' if default else ''
+        return f'{cpp_type} {field.name}{value};{comment}'
+    if field.kind == 'array':
+        cpp_type = SCALARS[field.element][0]
+        return (f'{cpp_type} {field.name}[{field.capacity}] = {{}};{comment}\n'
+                f'        size_t {field.name}_count = 0; // Элементов в ответе (сохраняется не больше {field.capacity})')
+    return f'std::vector<{field.element.name}> {field.name};{comment}'
+
+
+def emit_header(structs, roots):
+    out = []
+    out.append('#pragma once')
+    out.append('')
+    out.append('// Сгенерировано tools/generate_schema.py из vendor/WarThunder-localhost-documentation-master/*/*.md - не править вручную')
+    out.append('')
+    out.append('#include <string_view>')
+    out.append('#include <vector>')
+    out.append('#include <cstdint>')
+    out.append('#include <cstddef>')
+    out.append('')
+    out.append('#include "JsonReader.h"')
+    out.append('')
+    out.append('// Типизированные ответы localhost:8111: все поля из документации эндпоинтов')
+    out.append('// Read - один проход курсора Json::Reader, ключ выбирается switch по хешу Json::Key; без дерева и без выделений:')
+    out.append('// строки - string_view в буфер ответа или арену Reader (действительны до следующего Reset),')
+    out.append('// векторы очищаются с сохранением ёмкости. Отсутствующие поля - значения по умолчанию')
+    out.append('namespace Schema {')
+    out.append(f'    constexpr size_t MAX_ENGINES = {MAX_ENGINES}; // Поля с номером двигателя ("RPM 1"): номера 1..MAX_ENGINES')
+    out.append('')
+    for struct in structs:
+        if struct.description:
+            out.append(f'    // {cpp_comment(struct.description)}')
+        out.append(f'    struct {struct.name} {{')
+        out.append(f'        static constexpr size_t FIELDS = {len(struct.fields)};')
+        out.append('')
+        for field in struct.fields:
+            out.append(f'        {member_declaration(field)}')
+        if struct.templates():
+            out.append('        size_t engines = 0; // Наибольший номер двигателя в ответе')
+        out.append('')
+        out.append('        void Clear(); // Значения по умолчанию (ёмкость векторов сохраняется)')
+        out.append('    };')
+        out.append('')
+    out.append('    // Эндпоинты:')
+    for name, url, struct, is_list in roots:
+        root_type = f'std::vector<{struct.name}>' if is_list else struct.name
+        out.append(f'    //   {url} - {root_type}')
+    out.append('')
+    out.append('    // Следующее значение курсора; false - не объект (пропущен) или ошибка чтения')
+    for struct in structs:
+        out.append(f'    bool Read(Json::Reader& reader, {struct.name}& out);')
+    out.append('')
+    out.append('    // Массив объектов (корень /gamechat и /map_obj.json); элементы-не объекты пропускаются')
+    for name, url, struct, is_list in roots:
+        if is_list:
+            out.append(f'    bool ReadList(Json::Reader& reader, std::vector<{struct.name}>& out);')
+    out.append('')
+    out.append('    // Те же поля поиском по ключам в готовом документе (сравнение в Bench SchemaDecode)')
+    for struct in structs:
+        out.append(f'    void Lookup(Json::View view, {struct.name}& out);')
+    for name, url, struct, is_list in roots:
+        if is_list:
+            out.append(f'    void LookupList(Json::View view, std::vector<{struct.name}>& out);')
+    out.append('}')
+    out.append('')
+    return '\n'.join(out)
+
+
+def emit_clear(struct):
+    out = [f'    void {struct.name}::Clear() {{']
+    for field in struct.fields:
+        if field.kind in SCALARS:
+            cpp_type, default, _, _ = SCALARS[field.kind]
+            value = default if default else 'std::string_view()'
+            if field.template:
+                out.append(f'        std::fill(std::begin({field.name}), std::end({field.name}), {value});')
+            else:
+                out.append(f'        {field.name} = {value};')
+        elif field.kind == 'array':
+            out.append(f'        std::fill(std::begin({field.name}), std::end({field.name}), {SCALARS[field.element][1] or "std::string_view()"});')
+            out.append(f'        {field.name}_count = 0;')
+        else:
+            out.append(f'        {field.name}.clear();')
+    if struct.templates():
+        out.append('        engines = 0;')
+    out.append('    }')
+    return out
+
+
+def group_by_hash(fields):
+    groups = {}
+    for field in fields:
+        groups.setdefault(fnv1a(field.key), []).append(field)
+    return groups
+
+
+def emit_read_value(field, indent):
+    pad = ' ' * indent
+    if field.kind in SCALARS:
+        return [f'{pad}out.{field.name} = reader.{SCALARS[field.kind][2]}();']
+    if field.kind == 'array':
+        return [f'{pad}ReadArray(reader, out.{field.name}, out.{field.name}_count);']
+    return [f'{pad}ReadObjects(reader, out.{field.name});']
+
+
+def emit_read(struct):
+    out = []
+    templates = struct.templates()
+    if templates:
+        numbered = []
+        numbered.append(f'    // Поле с номером двигателя: хеш ключа с номером, заменённым на _N_, сравнивается с описанными')
+        numbered.append(f'    bool ReadNumbered(Json::Reader& reader, std::string_view key, {struct.name}& out) {{')
+        numbered.append('        std::string_view prefix;')
+        numbered.append('        std::string_view suffix;')
+        numbered.append('        size_t number = 0;')
+        numbered.append('        if (!SplitNumbered(key, prefix, number, suffix) || number == 0 || number > MAX_ENGINES) return false;')
+        numbered.append('        size_t index = number - 1;')
+        numbered.append('        switch (TemplateHash(prefix, suffix)) {')
+        for hash_value, group in group_by_hash(templates).items():
+            numbered.append(f'            case Json::Key::Hash({cpp_string(group[0].key)}):')
+            for field in group:
+                numbered.append(f'                if (prefix == {cpp_string(field.prefix)} && suffix == {cpp_string(field.suffix)}) {{')
+                numbered.append(f'                    out.{field.name}[index] = reader.{SCALARS[field.kind][2]}();')
+                numbered.append('                    break;')
+                numbered.append('                }')
+            numbered.append('                return false;')
+        numbered.append('            default:')
+        numbered.append('                return false;')
+        numbered.append('        }')
+        numbered.append('        out.engines = std::max(out.engines, number);')
+        numbered.append('        return true;')
+        numbered.append('    }')
+        out.append('    namespace {')
+        out.extend('    ' + line for line in numbered)
+        out.append('    }')
+        out.append('')
+
+    fixed = [field for field in struct.fields if not field.template]
+    out.append(f'    bool Read(Json::Reader& reader, {struct.name}& out) {{')
+    out.append('        out.Clear();')
+    out.append('        if (reader.Peek() != Json::ValueType::Object) {')
+    out.append('            reader.Skip();')
+    out.append('            return false;')
+    out.append('        }')
+    out.append('        reader.EnterObject();')
+    out.append('        while (reader.NextMember()) {')
+    out.append('            std::string_view key = reader.GetKey();')
+    out.append('            switch (reader.GetKeyHash()) {')
+    for hash_value, group in group_by_hash(fixed).items():
+        out.append(f'                case Json::Key::Hash({cpp_string(group[0].key)}):')
+        for field in group:
+            out.append(f'                    if (key == {cpp_string(field.key)}) {{')
+            out.extend(emit_read_value(field, 24))
+            out.append('                        continue;')
+            out.append('                    }')
+        out.append('                    break;')
+    out.append('                default:')
+    out.append('                    break;')
+    out.append('            }')
+    if templates:
+        out.append('            if (ReadNumbered(reader, key, out)) continue;')
+    out.append('            reader.Skip();')
+    out.append('        }')
+    out.append('        return !reader.HasError();')
+    out.append('    }')
+    return out
+
+
+def emit_lookup(struct):
+    out = [f'    void Lookup(Json::View view, {struct.name}& out) {{', '        out.Clear();']
+    for field in struct.fields:
+        if field.template:
+            continue
+        key = cpp_string(field.key)
+        if field.kind in SCALARS:
+            out.append(f'        out.{field.name} = view[{key}].{SCALARS[field.kind][3]}();')
+        elif field.kind == 'array':
+            out.append('        {')
+            out.append(f'            Json::View items = view[{key}];')
+            out.append(f'            out.{field.name}_count = items.size();')
+            out.append(f'            for (size_t i = 0; i < items.size() && i < {field.capacity}; i++) out.{field.name}[i] = items[i].{SCALARS[field.element][3]}();')
+            out.append('        }')
+        else:
+            out.append(f'        LookupObjects(view[{key}], out.{field.name});')
+    templates = struct.templates()
+    if templates:
+        out.append('        char key[64];')
+        out.append('        for (size_t number = 1; number <= MAX_ENGINES; number++) {')
+        for field in templates:
+            out.append(f'            Json::View {field.name} = view[NumberedKey(key, sizeof(key), {cpp_string(field.prefix)}, number, {cpp_string(field.suffix)})];')
+            out.append(f'            if (!{field.name}.isNull()) {{')
+            out.append(f'                out.{field.name}[number - 1] = {field.name}.{SCALARS[field.kind][3]}();')
+            out.append('                out.engines = std::max(out.engines, number);')
+            out.append('            }')
+        out.append('        }')
+    out.append('    }')
+    return out
+
+
+HELPERS = '''    namespace {
+        template <typename T>
+        T ReadScalar(Json::Reader& reader);
+@SCALARS@
+
+        // Массив скаляров: первые N элементов, count - все элементы ответа
+        template <typename T, size_t N>
+        void ReadArray(Json::Reader& reader, T (&values)[N], size_t& count) {
+            count = 0;
+            if (reader.Peek() != Json::ValueType::Array) {
+                reader.Skip();
+                return;
+            }
+            reader.EnterArray();
+            while (reader.NextItem()) {
+                T value = ReadScalar<T>(reader);
+                if (count < N) values[count] = value;
+                count++;
+            }
+        }
+
+        template <typename T>
+        void ReadObjects(Json::Reader& reader, std::vector<T>& out) {
+            out.clear();
+            if (reader.Peek() != Json::ValueType::Array) {
+                reader.Skip();
+                return;
+            }
+            reader.EnterArray();
+            while (reader.NextItem()) {
+                out.emplace_back();
+                if (!Read(reader, out.back())) out.pop_back();
+            }
+        }
+
+        template <typename T>
+        void LookupObjects(Json::View items, std::vector<T>& out) {
+            out.clear();
+            for (size_t i = 0; i < items.size(); i++) {
+                if (!items[i].isObject()) continue;
+                out.emplace_back();
+                Lookup(items[i], out.back());
+            }
+        }
+
+        // "RPM 12" -> "RPM ", 12, ""; номер - последнее число после пробела, дальше конец ключа или запятая
+        bool SplitNumbered(std::string_view key, std::string_view& prefix, size_t& number, std::string_view& suffix) {
+            size_t end = key.find(',');
+            if (end == std::string_view::npos) end = key.size();
+            size_t start = end;
+            while (start > 0 && key[start - 1] >= '0' && key[start - 1] <= '9') start--;
+            if (start == end || start == 0 || key[start - 1] != ' ' || end - start > 3) return false;
+            number = 0;
+            for (size_t i = start; i < end; i++) number = number * 10 + (size_t)(key[i] - '0');
+            prefix = key.substr(0, start);
+            suffix = key.substr(end);
+            return true;
+        }
+
+        // Json::Key::Hash(prefix + "_N_" + suffix) без сборки строки
+        uint32_t TemplateHash(std::string_view prefix, std::string_view suffix) {
+            uint32_t hash = 2166136261u;
+            for (std::string_view part : { prefix, std::string_view("_N_"), suffix }) {
+                for (char c : part) {
+                    hash ^= (unsigned char)c;
+                    hash *= 16777619u;
+                }
+            }
+            return hash;
+        }
+
+        std::string_view NumberedKey(char* buffer, size_t capacity, std::string_view prefix, size_t number, std::string_view suffix) {
+            int size = snprintf(buffer, capacity, "%.*s%zu%.*s", (int)prefix.size(), prefix.data(), number, (int)suffix.size(), suffix.data());
+            return std::string_view(buffer, size > 0 ? std::min((size_t)size, capacity - 1) : 0);
+        }
+    }
+'''
+
+
+def emit_source(structs, roots):
+    out = []
+    out.append('// Сгенерировано tools/generate_schema.py из vendor/WarThunder-localhost-documentation-master/*/*.md - не править вручную')
+    out.append('')
+    out.append('#include "Schema.h"')
+    out.append('#include <algorithm>')
+    out.append('#include <iterator>')
+    out.append('#include <cstdio>')
+    out.append('')
+    out.append('namespace Schema {')
+    # Специализации только для типов элементов массивов (остальные - неиспользуемые функции)
+    kinds = sorted({field.element for struct in structs for field in struct.fields if field.kind == 'array'})
+    scalars = [f'        template <> {SCALARS[kind][0]} ReadScalar<{SCALARS[kind][0]}>(Json::Reader& reader) {{ return reader.{SCALARS[kind][2]}(); }}'
+               for kind in kinds]
+    out.append(HELPERS.replace('@SCALARS@', '\n'.join(scalars)))
+    for struct in structs:
+        out.extend(emit_clear(struct))
+        out.append('')
+    for struct in structs:
+        out.extend(emit_read(struct))
+        out.append('')
+    for name, url, struct, is_list in roots:
+        if is_list:
+            out.append(f'    bool ReadList(Json::Reader& reader, std::vector<{struct.name}>& out) {{')
+            out.append('        ReadObjects(reader, out);')
+            out.append('        return !reader.HasError();')
+            out.append('    }')
+            out.append('')
+    for struct in structs:
+        out.extend(emit_lookup(struct))
+        out.append('')
+    for name, url, struct, is_list in roots:
+        if is_list:
+            out.append(f'    void LookupList(Json::View view, std::vector<{struct.name}>& out) {{')
+            out.append('        LookupObjects(view, out);')
+            out.append('    }')
+            out.append('')
+    out[-1] = '}'
+    out.append('')
+    return '\n'.join(out)
+
+
+def emit_samples_header(samples):
+    out = []
+    out.append('#pragma once')
+    out.append('')
+    out.append('// Сгенерировано tools/generate_schema.py из vendor/WarThunder-localhost-documentation-master/*/*.md - не править вручную')
+    out.append('')
+    out.append('#include <string_view>')
+    out.append('#include <cstddef>')
+    out.append('')
+    out.append('// Примеры ответов эндпоинтов из документации (пропущенные запятые исправлены), с отступами табуляцией')
+    out.append('namespace Samples {')
+    out.append('    struct Sample {')
+    out.append('        const char* name; // Структура Schema корня')
+    out.append('        const char* url;')
+    out.append('        std::string_view json;')
+    out.append('    };')
+    out.append('')
+    out.append(f'    constexpr size_t COUNT = {len(samples)};')
+    out.append('    extern const Sample ALL[COUNT];')
+    out.append('')
+    out.append('    // Пример по URL эндпоинта ("/map_obj.json"); nullptr - нет такого')
+    out.append('    const Sample* Find(std::string_view url);')
+    out.append('}')
+    out.append('')
+    return '\n'.join(out)
+
+
+def emit_samples_source(samples):
+    out = []
+    out.append('// Сгенерировано tools/generate_schema.py из vendor/WarThunder-localhost-documentation-master/*/*.md - не править вручную')
+    out.append('')
+    out.append('#include "Samples.h"')
+    out.append('')
+    out.append('namespace Samples {')
+    out.append('    namespace {')
+    for name, url, sample in samples:
+        text = json.dumps(sample, ensure_ascii=False, indent='\t')
+        out.append(f'        constexpr char {identifier(name).upper()}[] =')
+        chunks = [text[i:i + SAMPLE_LITERAL_CHUNK] for i in range(0, len(text), SAMPLE_LITERAL_CHUNK)]
+        for chunk in chunks:
+            literal = cpp_string(chunk).replace('\t', '\\t').replace('\n', '\\n')
+            out.append(f'            {literal}')
+        out[-1] += ';'
+    out.append('    }')
+    out.append('')
+    out.append('    const Sample ALL[COUNT] = {')
+    for name, url, sample in samples:
+        constant = identifier(name).upper()
+        out.append(f'        {{ {cpp_string(name)}, {cpp_string(url)}, std::string_view({constant}, sizeof({constant}) - 1) }},')
+    out.append('    };')
+    out.append('')
+    out.append('    const Sample* Find(std::string_view url) {')
+    out.append('        for (const Sample& sample : ALL) {')
+    out.append('            if (url == sample.url) return &sample;')
+    out.append('        }')
+    out.append('        return nullptr;')
+    out.append('    }')
+    out.append('}')
+    out.append('')
+    return '\n'.join(out)
+
+
+def write_if_changed(path, text):
+    # Без изменений файл не трогается (сборка не пересобирает зависимые единицы)
+    if os.path.exists(path):
+        with open(path, encoding='utf-8', newline='') as file:
+            if file.read() == text:
+                return False
+    with open(path, 'w', encoding='utf-8', newline='\n') as file:
+        file.write(text)
+    return True
+
+
+def main():
+    structs, roots, samples = load_endpoints()
+    header = emit_header(structs, roots)
+    source = emit_source(structs, roots)
+    outputs = ((OUTPUT_HEADER, header), (OUTPUT_SOURCE, source),
+               (OUTPUT_SAMPLES_HEADER, emit_samples_header(samples)), (OUTPUT_SAMPLES_SOURCE, emit_samples_source(samples)))
+    for path, text in outputs:
+        state = 'written' if write_if_changed(path, text) else 'unchanged'
+        print(f'{os.path.relpath(path, ROOT)}: {state}')
+    fields = sum(len(struct.fields) for struct in structs)
+    print(f'{len(roots)} endpoints, {len(structs)} structs, {fields} fields')
+
+
+if __name__ == '__main__':
+    main()